@@ -42,18 +42,14 @@ typedef struct gd_GCE
     uint8_t transparency;
 } gd_GCE;
 
-typedef struct gd_Entry
-{
-    int32_t length;
-    uint16_t prefix;
-    uint8_t suffix;
-} gd_Entry;
-
+/* LZW code table, one row per code (struct of arrays) */
 typedef struct gd_Table
 {
-    int16_t bulk;
-    int16_t nentries;
-    gd_Entry *entries;
+    uint16_t prefix[0x1000];
+    uint8_t suffix[0x1000];
+    uint8_t first[0x1000];
+    uint16_t length[0x1000];
+    uint8_t stack[0x1000]; /* expanded string of the current code */
 } gd_Table;
 
 typedef struct gd_GIF
@@ -75,6 +71,14 @@ typedef struct gd_GIF
     uint16_t fx, fy, fw, fh;
     uint8_t bgindex;
     gd_Table *table;
+    /* Optional: receive only the pixels whose colour changed since the
+     * previous frame, as horizontal runs in GIF canvas coordinates. The
+     * first frame after gd_open_gif() is sent in full. */
+    void (*draw_span)(struct gd_GIF *gif, uint16_t x, uint16_t y, uint16_t *pixels, uint16_t w);
+    void *draw_arg; /* for the draw_span callback */
+    uint16_t *span;
+    uint16_t prev_colors[256];
+    uint8_t redraw;
 } gd_GIF;
 
 class GifClass
@@ -139,6 +143,12 @@ public:
         gif->bgindex = bgidx;
         gif->anim_start = file_pos; // fd->position();
         gif->table = new_table();
+        if (!gif->table)
+        {
+            free(gif);
+            return NULL;
+        }
+        gif->redraw = 1;
         return gif;
     }
 
@@ -195,6 +205,7 @@ public:
     {
         gif->fd->close();
         free(gif->table);
+        free(gif->span);
         free(gif);
     }
 
@@ -387,19 +398,13 @@ private:
 
     gd_Table *new_table()
     {
-        // uint16_t key;
-        // int16_t init_bulk = MAX(1 << (key_size + 1), 0x100);
-        // Table *table = (Table*) malloc(sizeof(*table) + sizeof(Entry) * init_bulk);
-        // if (table) {
-        //     table->bulk = init_bulk;
-        //     table->nentries = (1 << key_size) + 2;
-        //     table->entries = (Entry *) &table[1];
-        //     for (key = 0; key < (1 << key_size); key++)
-        //         table->entries[key] = (Entry) {1, 0xFFF, key};
-        // }
-        // return table;
-        int32_t s = sizeof(gd_Table) + (sizeof(gd_Entry) * 4096);
+        int32_t s = sizeof(gd_Table);
+#if defined(ESP32)
+        /* Hot decode state: keep it out of PSRAM */
+        gd_Table *table = (gd_Table *)heap_caps_malloc(s, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
         gd_Table *table = (gd_Table *)malloc(s);
+#endif
         if (table)
         {
             Serial.print(F("new_table() malloc: "));
@@ -410,68 +415,20 @@ private:
             Serial.print(F("new_table() malloc failed: "));
             Serial.println(s);
         }
-        table->entries = (gd_Entry *)&table[1];
         return table;
     }
 
     void reset_table(gd_Table *table, uint16_t key_size)
     {
-        table->nentries = (1 << key_size) + 2;
         for (uint16_t key = 0; key < (1 << key_size); key++)
         {
-            table->entries[key] = (gd_Entry){1, 0xFFF, (uint8_t)key};
+            table->prefix[key] = 0xFFF;
+            table->suffix[key] = (uint8_t)key;
+            table->first[key] = (uint8_t)key;
+            table->length[key] = 1;
         }
     }
 
-    /* Add table entry. Return value:
- *  0 on success
- *  +1 if key size must be incremented after this addition
- *  -1 if could not realloc table */
-    int32_t add_entry(gd_Table *table, int32_t length, uint16_t prefix, uint8_t suffix)
-    {
-        // Table *table = *tablep;
-        // if (table->nentries == table->bulk) {
-        //     table->bulk *= 2;
-        //     table = (Table*) realloc(table, sizeof(*table) + sizeof(Entry) * table->bulk);
-        //     if (!table) return -1;
-        //     table->entries = (Entry *) &table[1];
-        //     *tablep = table;
-        // }
-        table->entries[table->nentries] = (gd_Entry){length, prefix, suffix};
-        table->nentries++;
-        if ((table->nentries & (table->nentries - 1)) == 0)
-            return 1;
-        return 0;
-    }
-
-    uint16_t get_key(gd_GIF *gif, uint16_t key_size, uint8_t *sub_len, uint8_t *shift, uint8_t *byte)
-    {
-        int16_t bits_read;
-        int16_t rpad;
-        int16_t frag_size;
-        uint16_t key;
-
-        key = 0;
-        for (bits_read = 0; bits_read < key_size; bits_read += frag_size)
-        {
-            rpad = (*shift + bits_read) % 8;
-            if (rpad == 0)
-            {
-                /* Update byte. */
-                if (*sub_len == 0)
-                    gif_buf_read(gif->fd, sub_len, 1); /* Must be nonzero! */
-                gif_buf_read(gif->fd, byte, 1);
-                (*sub_len)--;
-            }
-            frag_size = MIN(key_size - bits_read, 8 - rpad);
-            key |= ((uint16_t)((*byte) >> rpad)) << bits_read;
-        }
-        /* Clear extra bits to the left. */
-        key &= (1 << key_size) - 1;
-        *shift = (*shift + key_size) % 8;
-        return key;
-    }
-
     /* Compute output index of y-th input line, in frame of height h. */
     int16_t interlaced_line_index(int16_t h, int16_t y)
     {
@@ -493,101 +450,209 @@ private:
         return y * 2 + 1;
     }
 
+    /* Point the output cursor at the start of input line out_row. */
+    void set_out_row(gd_GIF *gif, int16_t interlace, uint8_t *frame)
+    {
+        out_y = gif->fy + (interlace ? interlaced_line_index((int16_t)gif->fh, out_row) : out_row);
+        out_dst = frame + (int32_t)out_y * gif->width + gif->fx;
+        /* Clip frames that stick out of the logical screen */
+        if ((out_row >= gif->fh) || (out_y >= gif->height) || (gif->fx >= gif->width))
+            out_w = 0;
+        else
+            out_w = MIN(gif->fw, gif->width - gif->fx);
+    }
+
+    /* Hand the pending run of changed pixels to draw_span. */
+    void flush_span(gd_GIF *gif)
+    {
+        if (run_len)
+        {
+            gif->draw_span(gif, gif->fx + run_x, out_y, gif->span, run_len);
+            run_len = 0;
+        }
+    }
+
+    /* Store n pixels of one input line at the cursor. Transparent pixels
+     * are skipped as whole runs; with draw_span set, pixels whose colour
+     * differs from what the previous frame showed are collected into runs. */
+    void put_row(gd_GIF *gif, const uint8_t *s, uint16_t n)
+    {
+        uint16_t x = out_x;
+        uint16_t end = MIN(out_x + n, out_w);
+        uint8_t *dst = out_dst;
+        uint8_t tindex = gif->gce.transparency ? gif->gce.tindex : 0;
+        bool transparent = gif->gce.transparency;
+
+        if (!gif->draw_span)
+        {
+            while (x < end)
+            {
+                uint8_t idx = *s++;
+                if (!transparent || idx != tindex)
+                    dst[x] = idx;
+                x++;
+            }
+            return;
+        }
+
+        const uint16_t *colors = gif->palette->colors;
+        const uint16_t *prev = gif->prev_colors;
+        bool redraw = gif->redraw;
+        while (x < end)
+        {
+            uint8_t idx = *s;
+            if (transparent && idx == tindex)
+            {
+                flush_span(gif);
+                do
+                {
+                    s++;
+                    x++;
+                } while ((x < end) && (*s == tindex));
+                continue;
+            }
+            uint16_t c = colors[idx];
+            if (redraw || (c != prev[dst[x]]))
+            {
+                if (run_len == 0)
+                    run_x = x;
+                gif->span[run_len++] = c;
+            }
+            else
+            {
+                flush_span(gif);
+            }
+            dst[x] = idx;
+            s++;
+            x++;
+        }
+    }
+
+    /* Lay a decoded string out over as many lines as it spans. */
+    void put_pixels(gd_GIF *gif, int16_t interlace, uint8_t *frame, const uint8_t *s, uint16_t n)
+    {
+        while (n && (out_row < gif->fh))
+        {
+            uint16_t k = MIN(n, gif->fw - out_x);
+            put_row(gif, s, k);
+            s += k;
+            n -= k;
+            out_x += k;
+            if (out_x == gif->fw)
+            {
+                if (gif->draw_span)
+                    flush_span(gif);
+                out_x = 0;
+                out_row++;
+                set_out_row(gif, interlace, frame);
+            }
+        }
+    }
+
     /* Decompress image pixels.
- * Return 0 on success or -1 on out-of-memory (w.r.t. LZW code table). */
+ * The code table stores each string's length and first byte next to its
+ * prefix/suffix link, so a code expands with one backward walk into
+ * table->stack and is then copied out line by line; there is no per-pixel
+ * division or table fix-up.
+ * Return 0 on success or -1 on a corrupt code stream. */
     int8_t read_image_data(gd_GIF *gif, int16_t interlace, uint8_t *frame)
     {
-        uint8_t sub_len, shift, byte, table_is_full = 0;
-        uint16_t init_key_size, key_size;
-        int32_t frm_off, str_len = 0, p, x, y;
-        uint16_t key, clear, stop;
-        int32_t ret;
-        gd_Entry entry = {0, 0, 0};
-
-        // Serial.println("Read key size");
-        gif_buf_read(gif->fd, &byte, 1);
-        key_size = (uint16_t)byte;
-        // Serial.println("Set pos, discard sub blocks");
-        // start = gif->fd->position();
-        // discard_sub_blocks(gif);
-        // end = gif->fd->position();
-        // gif_buf_seek(gif->fd, start, SeekSet);
-        clear = 1 << key_size;
+        gd_Table *table = gif->table;
+        uint8_t min_key_size, key_size, sub_len = 0, nbits = 0;
+        uint32_t bits = 0;
+        uint16_t key, clear, stop, next;
+        int32_t prev = -1;
+        int8_t ret = 0;
+
+        gif_buf_read(gif->fd, &min_key_size, 1);
+        if ((min_key_size < 1) || (min_key_size > 11))
+        {
+            return -1;
+        }
+        clear = 1 << min_key_size;
         stop = clear + 1;
-        // Serial.println("New LZW table");
-        // table = new_table(key_size);
-        reset_table(gif->table, key_size);
-        key_size++;
-        init_key_size = key_size;
-        sub_len = shift = 0;
-        // Serial.println("Get init key");
-        key = get_key(gif, key_size, &sub_len, &shift, &byte); /* clear code */
-        frm_off = 0;
-        ret = 0;
+        reset_table(table, min_key_size);
+        key_size = min_key_size + 1;
+        next = clear + 2;
+
+        if (gif->draw_span && !gif->span)
+        {
+            gif->span = (uint16_t *)malloc(gif->width * 2);
+            if (!gif->span)
+                gif->draw_span = NULL;
+        }
+        if (gif->redraw)
+        {
+            /* Nothing on screen yet: start from a known canvas */
+            memset(frame, gif->gce.transparency ? gif->gce.tindex : gif->bgindex, (int32_t)gif->width * gif->height);
+        }
+        out_x = out_row = 0;
+        run_len = 0;
+        set_out_row(gif, interlace, frame);
+
         while (1)
         {
-            if (key == clear)
+            /* Refill the bit accumulator from the data sub-blocks */
+            while (nbits < key_size)
             {
-                // Serial.println("Clear key, reset nentries");
-                key_size = init_key_size;
-                gif->table->nentries = (1 << (key_size - 1)) + 2;
-                table_is_full = 0;
-            }
-            else if (!table_is_full)
-            {
-                // Serial.println("Add entry to table");
-                ret = add_entry(gif->table, str_len + 1, key, entry.suffix);
-                // if (ret == -1) {
-                //     // Serial.println("Table entry add failure");
-                //     free(table);
-                //     return -1;
-                // }
-                if (gif->table->nentries == 0x1000)
+                if (sub_len == 0)
                 {
-                    // Serial.println("Table is full");
-                    ret = 0;
-                    table_is_full = 1;
+                    gif_buf_read(gif->fd, &sub_len, 1);
+                    if (sub_len == 0) /* block terminator before the stop code */
+                        goto done;
                 }
+                bits |= (uint32_t)gif_buf_read(gif->fd) << nbits;
+                nbits += 8;
+                sub_len--;
             }
-            // Serial.println("Get key");
-            key = get_key(gif, key_size, &sub_len, &shift, &byte);
+            key = bits & ((1 << key_size) - 1);
+            bits >>= key_size;
+            nbits -= key_size;
+
             if (key == clear)
+            {
+                key_size = min_key_size + 1;
+                next = clear + 2;
+                prev = -1;
                 continue;
+            }
             if (key == stop)
                 break;
-            if (ret == 1)
-                key_size++;
-            entry = gif->table->entries[key];
-            str_len = entry.length;
-            uint8_t tindex = gif->gce.tindex;
-            // Serial.println("Interpret key");
-            while (1)
+            if ((key > next) || ((prev < 0) && (key >= clear)))
             {
-                p = frm_off + entry.length - 1;
-                x = p % gif->fw;
-                y = p / gif->fw;
-                if (interlace)
-                {
-                    y = interlaced_line_index((int16_t)gif->fh, y);
-                }
-                if (tindex != entry.suffix)
-                {
-                    frame[(gif->fy + y) * gif->width + gif->fx + x] = entry.suffix;
-                }
-                if (entry.prefix == 0xFFF)
-                    break;
-                else
-                    entry = gif->table->entries[entry.prefix];
+                ret = -1;
+                break;
             }
-            frm_off += str_len;
-            if (key < gif->table->nentries - 1 && !table_is_full)
-                gif->table->entries[gif->table->nentries - 1].suffix = entry.suffix;
-        }
-        // Serial.println("Done w/ img data, free table and seek to end");
-        // free(table);
-        gif_buf_read(gif->fd, &sub_len, 1); /* Must be zero! */
-        // gif_buf_seek(gif->fd, end, SeekSet);
-        return 0;
+            if ((prev >= 0) && (next < 0x1000))
+            {
+                /* key == next is the KwKwK case: its first byte is prev's */
+                table->prefix[next] = prev;
+                table->suffix[next] = table->first[(key < next) ? key : prev];
+                table->first[next] = table->first[prev];
+                table->length[next] = table->length[prev] + 1;
+                next++;
+                if ((next == (1 << key_size)) && (key_size < 12))
+                    key_size++;
+            }
+
+            uint16_t len = table->length[key];
+            uint8_t *s = table->stack + len;
+            for (uint16_t c = key; s > table->stack; c = table->prefix[c])
+                *--s = table->suffix[c];
+            put_pixels(gif, interlace, frame, table->stack, len);
+            prev = key;
+        }
+        /* Skip the rest of the current sub-block and the terminator */
+        gif_buf_seek(gif->fd, sub_len);
+        discard_sub_blocks(gif);
+    done:
+        if (gif->draw_span)
+        {
+            flush_span(gif);
+            memcpy(gif->prev_colors, gif->palette->colors, sizeof(gif->prev_colors));
+        }
+        gif->redraw = 0;
+        return ret;
     }
 
     /* Read image.
@@ -645,6 +710,11 @@ private:
 
     int16_t gif_buf_last_idx, gif_buf_idx, file_pos;
     uint8_t gif_buf[GIF_BUF_SIZE];
+
+    /* read_image_data() output cursor */
+    uint8_t *out_dst;
+    uint16_t out_x, out_row, out_y, out_w;
+    uint16_t run_x, run_len;
 };
 
 #endif /* _GIFCLASS_H_ */
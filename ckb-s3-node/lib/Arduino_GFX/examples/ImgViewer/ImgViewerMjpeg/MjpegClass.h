@@ -46,6 +46,28 @@ public:
     return true;
   }
 
+  /*!
+    @brief  Retarget framing at another frame buffer, e.g. to alternate
+            between buffers while the previous frame is still decoding
+    @param  mjpeg_buf  buffer for the next frame
+    @param  size       buffer size; frame bytes beyond it are dropped so the
+                       stream stays in sync. 0 = unchecked (as in setup())
+  */
+  void setMjpegBuf(uint8_t *mjpeg_buf, int32_t size)
+  {
+    _mjpeg_buf = mjpeg_buf;
+    _mjpeg_buf_size = size;
+  }
+
+  /*!
+    @brief  Length of the frame framed by the last readMjpegBuf(); larger
+            than the buffer size if the frame was truncated
+  */
+  int32_t getMjpegBufLen()
+  {
+    return _mjpeg_buf_len;
+  }
+
   bool readMjpegBuf()
   {
     if (_inputindex == 0)
@@ -54,6 +76,7 @@ public:
       _inputindex += _buf_read;
     }
     _mjpeg_buf_offset = 0;
+    _mjpeg_buf_len = 0;
     int i = 0;
     bool found_FFD8 = false;
     while ((_buf_read > 0) && (!found_FFD8))
@@ -104,8 +127,14 @@ public:
         }
 
         // Serial.printf("i: %d\n", i);
-        memcpy(_mjpeg_buf + _mjpeg_buf_offset, _p, i);
-        _mjpeg_buf_offset += i;
+        int32_t n = i;
+        if ((_mjpeg_buf_size > 0) && (_mjpeg_buf_offset + n > _mjpeg_buf_size))
+        {
+          n = _mjpeg_buf_size - _mjpeg_buf_offset;
+        }
+        memcpy(_mjpeg_buf + _mjpeg_buf_offset, _p, n);
+        _mjpeg_buf_offset += n;
+        _mjpeg_buf_len += i;
         size_t o = _buf_read - i;
         if (o > 0)
         {
@@ -197,6 +226,8 @@ private:
 
   uint8_t *_read_buf;
   int32_t _mjpeg_buf_offset = 0;
+  int32_t _mjpeg_buf_size = 0;
+  int32_t _mjpeg_buf_len = 0;
 
   JPEGDEC _jpeg;
   int _scale = -1;
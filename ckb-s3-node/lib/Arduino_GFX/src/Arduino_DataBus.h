@@ -8,6 +8,7 @@
 #include <Arduino.h>
 
 #define GFX_NOT_DEFINED -1
+#define GFX_SKIP_OUTPUT_BEGIN -2 // canvas begin() leaves an already running output alone
 
 #if defined(__AVR__)
 #define LITTLE_FOOT_PRINT // reduce program size for limited flash MCU
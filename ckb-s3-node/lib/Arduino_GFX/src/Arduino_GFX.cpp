@@ -30,16 +30,21 @@ Arduino_GFX::Arduino_GFX(int16_t w, int16_t h) : Arduino_G(w, h)
 {
   _width = WIDTH;
   _height = HEIGHT;
-  _max_x = _width - 1;  ///< x zero base bound
-  _max_y = _height - 1; ///< y zero base bound
+  resetClipRect();
   _rotation = 0;
   cursor_y = cursor_x = 0;
   textsize_x = textsize_y = 1;
   text_pixel_margin = 0;
   textcolor = textbgcolor = 0xFFFF;
   wrap = true;
+#if !defined(LITTLE_FOOT_PRINT)
+  memset(_span_cache_r, 0, sizeof(_span_cache_r));
+  _span_cache_next = 0;
+#endif // !defined(LITTLE_FOOT_PRINT)
 #if !defined(ATTINY_CORE)
   gfxFont = NULL;
+  gfxFontRle = false;
+  gfxFontRemap = NULL;
 #if defined(U8G2_FONT_SUPPORT)
   u8g2Font = NULL;
 #endif // defined(U8G2_FONT_SUPPORT)
@@ -111,22 +116,26 @@ void Arduino_GFX::writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   int16_t dy = _diff(y1, y0);
   int16_t err = dx >> 1;
   int16_t step = (y0 < y1) ? 1 : -1;
+  int16_t xs = x0;
 
+  // Emit each run of pixels sharing a row (column if steep) as one span,
+  // so clipping happens once per run
   for (; x0 <= x1; x0++)
   {
-    if (steep)
-    {
-      writePixel(y0, x0, color);
-    }
-    else
-    {
-      writePixel(x0, y0, color);
-    }
     err -= dy;
-    if (err < 0)
+    if ((err < 0) || (x0 == x1))
     {
+      if (steep)
+      {
+        writeFastVLine(y0, xs, x0 - xs + 1, color);
+      }
+      else
+      {
+        writeFastHLine(xs, y0, x0 - xs + 1, color);
+      }
       err += dx;
       y0 += step;
+      xs = x0 + 1;
     }
   }
 }
@@ -142,7 +151,7 @@ INLINE void Arduino_GFX::startWrite()
 
 void Arduino_GFX::writePixel(int16_t x, int16_t y, uint16_t color)
 {
-  if (_ordered_in_range(x, 0, _max_x) && _ordered_in_range(y, 0, _max_y))
+  if (_ordered_in_range(x, _min_x, _max_x) && _ordered_in_range(y, _min_y, _max_y))
   {
     writePixelPreclipped(x, y, color);
   }
@@ -239,21 +248,21 @@ void Arduino_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
       if (y <= _max_y)
       { // Not off bottom
         int16_t x2 = x + w - 1;
-        if (x2 >= 0)
+        if (x2 >= _min_x)
         { // Not off left
           int16_t y2 = y + h - 1;
-          if (y2 >= 0)
+          if (y2 >= _min_y)
           { // Not off top
-            // Rectangle partly or fully overlaps screen
-            if (x < 0)
+            // Rectangle partly or fully overlaps clip rect
+            if (x < _min_x)
             {
-              x = 0;
-              w = x2 + 1;
+              x = _min_x;
+              w = x2 - _min_x + 1;
             } // Clip left
-            if (y < 0)
+            if (y < _min_y)
             {
-              y = 0;
-              h = y2 + 1;
+              y = _min_y;
+              h = y2 - _min_y + 1;
             } // Clip top
             if (x2 > _max_x)
             {
@@ -502,11 +511,124 @@ void Arduino_GFX::drawEllipseHelper(int32_t x, int32_t y,
 void Arduino_GFX::fillCircle(int16_t x, int16_t y,
                              int16_t r, uint16_t color)
 {
+  const uint8_t *spans = getCircleSpans(r);
   startWrite();
-  fillEllipseHelper(x, y, r, r, 3, 0, color);
+  if (spans)
+  {
+    writeFastHLine(x - r, y, (r << 1) + 1, color);
+    for (int16_t dy = 1; dy <= r; dy++)
+    {
+      int16_t xt = spans[dy];
+      writeFastHLine(x - xt, y - dy, (xt << 1) + 1, color);
+      writeFastHLine(x - xt, y + dy, (xt << 1) + 1, color);
+    }
+  }
+  else
+  {
+    fillEllipseHelper(x, y, r, r, 3, 0, color);
+  }
   endWrite();
 }
 
+#if !defined(LITTLE_FOOT_PRINT)
+// Same midpoint walk as fillEllipseHelper(), but records the half width of
+// each row instead of drawing it
+static void build_circle_spans(int32_t r, uint8_t *w)
+{
+  int32_t xt, yt, i;
+  int32_t r2 = r * r;
+  int32_t s;
+
+  memset(w, 0, r + 1);
+  w[0] = r;
+  i = 0;
+  yt = 0;
+  xt = r;
+  s = (r2 << 1) + r2 * (1 - (r << 1));
+  do
+  {
+    while (s < 0)
+    {
+      s += r2 * ((++yt << 2) + 2);
+    }
+    for (int32_t dy = i + 1; dy <= yt && dy <= r; dy++)
+    {
+      if (xt > w[dy])
+      {
+        w[dy] = xt;
+      }
+    }
+    i = yt;
+    s -= (--xt) * r2 << 2;
+  } while (yt <= xt);
+
+  xt = 0;
+  yt = r;
+  s = (r2 << 1) + r2 * (1 - (r << 1));
+  do
+  {
+    while (s < 0)
+    {
+      s += r2 * ((++xt << 2) + 2);
+    }
+    if (yt >= 0 && yt <= r && xt > w[yt])
+    {
+      w[yt] = xt;
+    }
+    s -= (--yt) * r2 << 2;
+  } while (xt <= yt);
+}
+#endif // !defined(LITTLE_FOOT_PRINT)
+
+/**************************************************************************/
+/*!
+  @brief  Half width of every row of a filled circle, from this instance's
+          span cache (one instance is drawn from one task at a time)
+  @param  r       Radius of circle
+  @return Table of r + 1 half widths indexed by distance from the center
+          row, or NULL if r is not cacheable
+*/
+/**************************************************************************/
+const uint8_t *Arduino_GFX::getCircleSpans(int16_t r)
+{
+#if !defined(LITTLE_FOOT_PRINT)
+  if (r < 1 || r > SPAN_CACHE_MAX_R)
+  {
+    return NULL;
+  }
+  for (uint8_t i = 0; i < SPAN_CACHE_SLOTS; i++)
+  {
+    if (_span_cache_r[i] == r)
+    {
+      return _span_cache_w[i];
+    }
+  }
+  uint8_t slot = _span_cache_next;
+  _span_cache_next = (_span_cache_next + 1) % SPAN_CACHE_SLOTS;
+  build_circle_spans(r, _span_cache_w[slot]);
+  _span_cache_r[slot] = r;
+  return _span_cache_w[slot];
+#else
+  UNUSED(r);
+  return NULL;
+#endif // !defined(LITTLE_FOOT_PRINT)
+}
+
+/**************************************************************************/
+/*!
+  @brief  Build span tables ahead of time for the radii a screen uses
+  @param  radii   Array of circle / corner radii
+  @param  count   Number of entries in radii
+*/
+/**************************************************************************/
+void Arduino_GFX::prewarmRadii(const int16_t *radii, uint8_t count)
+{
+  while (count--)
+  {
+    getCircleSpans(*radii++);
+  }
+}
+
 /**************************************************************************/
 /*!
   @brief  Quarter-circle drawer with fill, used for circles and roundrects
@@ -682,6 +804,8 @@ void Arduino_GFX::drawArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float st
   @param  start   degree of arc start
   @param  end     degree of arc end
   @param  color   16-bit 5-6-5 Color to fill with
+  @note   Floating point per pixel; fillRingSector() is the fixed point
+          version for gauges that redraw often
 */
 /**************************************************************************/
 void Arduino_GFX::fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color)
@@ -822,6 +946,205 @@ void Arduino_GFX::fillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t
   } while (++y <= ye);
 }
 
+// Quarter-wave sine, 64 steps over 90 degrees, Q14
+static const int16_t arc_sin_q14[65] PROGMEM = {
+    0, 402, 804, 1205, 1606, 2006, 2404, 2801,
+    3196, 3590, 3981, 4370, 4756, 5139, 5520, 5897,
+    6270, 6639, 7005, 7366, 7723, 8076, 8423, 8765,
+    9102, 9434, 9760, 10080, 10394, 10702, 11003, 11297,
+    11585, 11866, 12140, 12406, 12665, 12916, 13160, 13395,
+    13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978,
+    15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986,
+    16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379,
+    16384};
+
+// sin() of a binary angle (65536 per turn), Q14, linearly interpolated
+static int32_t arc_sin(uint16_t a)
+{
+  uint16_t q = a >> 14;
+  uint16_t p = a & 0x3FFF;
+  if (q & 1)
+  {
+    p = 0x4000 - p;
+  }
+  uint16_t i = p >> 8;
+  uint16_t f = p & 0xFF;
+  int32_t v = (int16_t)pgm_read_word(&arc_sin_q14[i]);
+  if (f)
+  {
+    v += (((int32_t)(int16_t)pgm_read_word(&arc_sin_q14[i + 1]) - v) * f) >> 8;
+  }
+  return (q & 2) ? -v : v;
+}
+
+static int32_t arc_floor_div(int32_t a, int32_t b) // b > 0
+{
+  return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+// Columns [lo, hi] of row y on one side of the ray (dx, dy): the clockwise
+// side including the ray itself when start is set (cross >= 0), otherwise
+// the counter-clockwise side excluding it (cross < 0). Boundaries shared by
+// adjacent sectors therefore split pixels without gaps or overlap.
+static void arc_half_row(int32_t dx, int32_t dy, int32_t y, bool start, int32_t *lo, int32_t *hi)
+{
+  int32_t c = dx * y;
+  *lo = INT16_MIN;
+  *hi = INT16_MAX;
+  if (dy > 0)
+  {
+    int32_t t = arc_floor_div(c, dy);
+    if (start)
+      *hi = t;
+    else
+      *lo = t + 1;
+  }
+  else if (dy < 0)
+  {
+    int32_t t = -arc_floor_div(c, -dy);
+    if (start)
+      *lo = t;
+    else
+      *hi = t - 1;
+  }
+  else if (start ? (c < 0) : (c >= 0))
+  {
+    *lo = 1;
+    *hi = 0;
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Fill a sector of a ring with horizontal spans, no floating point
+  @param  x       Center-point x coordinate
+  @param  y       Center-point y coordinate
+  @param  r1      Outer radius of ring
+  @param  r2      Inner radius of ring
+  @param  start   Start angle, 65536 per turn, 0 at 3 o'clock, clockwise
+  @param  sweep   Sector size in the same units, ARC_FULL for the whole ring
+  @param  color   16-bit 5-6-5 Color to fill with
+  @note   Sectors are half-open, [start, start + sweep): a gauge can grow
+          by filling only the wedge between its old and new value
+*/
+/**************************************************************************/
+void Arduino_GFX::fillRingSector(int16_t x, int16_t y, int16_t r1, int16_t r2, uint16_t start, uint32_t sweep, uint16_t color)
+{
+  if (r1 < r2)
+  {
+    _swap_int16_t(r1, r2);
+  }
+  if (r1 < 1 || sweep == 0)
+  {
+    return;
+  }
+  if (r2 < 1)
+  {
+    r2 = 1;
+  }
+  if (sweep == (ARC_FULL >> 1))
+  {
+    // both half-plane forms include the whole diameter, split it instead
+    fillRingSector(x, y, r1, r2, start, ARC_FULL >> 2, color);
+    fillRingSector(x, y, r1, r2, start + (ARC_FULL >> 2), ARC_FULL >> 2, color);
+    return;
+  }
+
+  bool full = sweep >= ARC_FULL;
+  bool wide = sweep > (ARC_FULL >> 1);
+  uint16_t end = start + sweep;
+  int32_t sdx = arc_sin(start + 0x4000), sdy = arc_sin(start);
+  int32_t edx = arc_sin(end + 0x4000), edy = arc_sin(end);
+
+  // pixel is in the ring when r2 * r2 - r2 <= x * x + y * y < r1 * r1 + r1
+  int32_t or2 = (int32_t)r1 * r1 + r1;
+  int32_t ir2 = (int32_t)r2 * r2 - r2;
+  int32_t xo = r1;
+  int32_t xi = 0;
+  while (xi * xi < ir2)
+  {
+    ++xi;
+  }
+
+  startWrite();
+  for (int32_t dy = 0; dy <= r1; dy++)
+  {
+    int32_t dy2 = dy * dy;
+    while (xo * xo + dy2 >= or2)
+    {
+      --xo;
+    }
+    while (xi > 0 && (xi - 1) * (xi - 1) + dy2 >= ir2)
+    {
+      --xi;
+    }
+    // ring row: [-xo, -xi] and [xi, xo], or one span once past the hole
+    int32_t alo[2] = {-xo, xi};
+    int32_t ahi[2] = {-xi, xo};
+    uint8_t an = 2;
+    if (xi == 0)
+    {
+      ahi[0] = xo;
+      an = 1;
+    }
+
+    for (int32_t ry = -dy; ry <= dy; ry += (dy << 1))
+    {
+      int32_t slo[2], shi[2];
+      uint8_t sn = 1;
+      if (full)
+      {
+        slo[0] = INT16_MIN;
+        shi[0] = INT16_MAX;
+      }
+      else
+      {
+        int32_t lo1, hi1, lo2, hi2;
+        arc_half_row(sdx, sdy, ry, true, &lo1, &hi1);
+        arc_half_row(edx, edy, ry, false, &lo2, &hi2);
+        if (!wide)
+        {
+          // sector is the intersection of both half planes
+          slo[0] = (lo1 > lo2) ? lo1 : lo2;
+          shi[0] = (hi1 < hi2) ? hi1 : hi2;
+        }
+        else if (lo1 > hi1 || lo2 > hi2 || lo2 > hi1 + 1 || lo1 > hi2 + 1)
+        {
+          // over half a turn it is the union, disjoint or with an empty side
+          slo[0] = lo1;
+          shi[0] = hi1;
+          slo[1] = lo2;
+          shi[1] = hi2;
+          sn = 2;
+        }
+        else
+        {
+          slo[0] = (lo1 < lo2) ? lo1 : lo2;
+          shi[0] = (hi1 > hi2) ? hi1 : hi2;
+        }
+      }
+
+      for (uint8_t a = 0; a < an; a++)
+      {
+        for (uint8_t s = 0; s < sn; s++)
+        {
+          int32_t lo = (alo[a] > slo[s]) ? alo[a] : slo[s];
+          int32_t hi = (ahi[a] < shi[s]) ? ahi[a] : shi[s];
+          if (lo <= hi)
+          {
+            writeFastHLine(x + lo, y + ry, hi - lo + 1, color);
+          }
+        }
+      }
+      if (dy == 0)
+      {
+        break;
+      }
+    }
+  }
+  endWrite();
+}
+
 /**************************************************************************/
 /*!
   @brief  Draw a rectangle with no fill color
@@ -892,11 +1215,35 @@ void Arduino_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
   if (r > max_radius)
     r = max_radius;
   // smarter version
+  const uint8_t *spans = getCircleSpans(r);
   startWrite();
   writeFillRect(x, y + r, w, h - (r << 1), color);
-  // draw four corners
-  fillEllipseHelper(x + r, y + r, r, r, 1, w - 2 * r - 1, color);
-  fillEllipseHelper(x + r, y + h - r - 1, r, r, 2, w - 2 * r - 1, color);
+  if (spans)
+  {
+    // corner rows straight from the span table
+    int16_t delta = w - (r << 1) - 1;
+    int16_t cx = x + r;
+    int16_t top = y + r;
+    int16_t bottom = y + h - r - 1;
+    if (h <= (r << 1))
+    {
+      // no middle band to cover the center rows
+      writeFastHLine(x, top, (r << 1) + 1, color);
+      writeFastHLine(x, bottom, (r << 1) + 1, color);
+    }
+    for (int16_t dy = 1; dy <= r; dy++)
+    {
+      int16_t xt = spans[dy];
+      writeFastHLine(cx - xt, top - dy, (xt << 1) + 1 + delta, color);
+      writeFastHLine(cx - xt, bottom + dy, (xt << 1) + 1 + delta, color);
+    }
+  }
+  else
+  {
+    // draw four corners
+    fillEllipseHelper(x + r, y + r, r, r, 1, w - 2 * r - 1, color);
+    fillEllipseHelper(x + r, y + h - r - 1, r, r, 2, w - 2 * r - 1, color);
+  }
   endWrite();
 }
 
@@ -1899,8 +2246,11 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // newlines, returns, non-printable characters, etc.  Calling
     // drawChar() directly with 'bad' characters of font may cause mayhem!
 
-    c -= (uint8_t)pgm_read_byte(&gfxFont->first);
-    GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c);
+    GFXglyph *glyph = getGlyph(c);
+    if (!glyph)
+    {
+      return;
+    }
     uint8_t *bitmap = pgm_read_bitmap_ptr(gfxFont);
 
     uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
@@ -1911,7 +2261,7 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
             baseline = yAdvance * 2 / 3; // TODO: baseline is an arbitrary currently, may be define in font file
     int8_t xo = pgm_read_byte(&glyph->xOffset),
            yo = pgm_read_byte(&glyph->yOffset);
-    uint8_t xx, yy, bits = 0, bit = 0;
+    uint8_t yy, bits = 0, bit = 0;
     int16_t xo16 = xo, yo16 = yo;
 
     if (xAdvance < w)
@@ -1921,11 +2271,38 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 
     block_w = xAdvance * textsize_x;
     block_h = yAdvance * textsize_y;
+
+    // Reject against what is actually painted: the glyph box, plus the
+    // background block when one is filled
+    int16_t x1 = x + xo16 * textsize_x;
+    int16_t y1 = y + yo16 * textsize_y;
+    int16_t x2 = x1 + w * textsize_x - 1;
+    int16_t y2 = y1 + h * textsize_y - 1;
+    if (bg != color)
+    {
+      int16_t by = y - (baseline * textsize_y);
+      if (x < x1)
+      {
+        x1 = x;
+      }
+      if (by < y1)
+      {
+        y1 = by;
+      }
+      if ((x + block_w - 1) > x2)
+      {
+        x2 = x + block_w - 1;
+      }
+      if ((by + block_h - 1) > y2)
+      {
+        y2 = by + block_h - 1;
+      }
+    }
     if (
-        (x > _max_x) ||            // Clip right
-        (y > _max_y) ||            // Clip bottom
-        ((x + block_w - 1) < 0) || // Clip left
-        ((y + block_h - 1) < 0)    // Clip top
+        (x1 > _max_x) || // Clip right
+        (y1 > _max_y) || // Clip bottom
+        (x2 < _min_x) || // Clip left
+        (y2 < _min_y)    // Clip top
     )
     {
       return;
@@ -1938,27 +2315,115 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     {
       writeFillRect(x, y - (baseline * textsize_y), block_w, block_h, bg);
     }
+    if (gfxFontRle)
+    {
+      // Runs alternate background/foreground; each foreground run is
+      // emitted as horizontal spans, whole rows merged into one rect
+      uint16_t total = (uint16_t)w * h;
+      uint16_t pos = 0;
+      int16_t col = 0, row = 0;
+      bool fg = false;
+      while (pos < total)
+      {
+        uint16_t run = pgm_read_byte(&bitmap[bo++]);
+        if (run > total - pos)
+        {
+          run = total - pos; // corrupt stream, don't run past the box
+        }
+        pos += run;
+        if (fg)
+        {
+          while (run)
+          {
+            int16_t span;
+            int16_t rows = 1;
+            if ((col == 0) && (run >= w))
+            {
+              rows = run / w;
+              span = w;
+            }
+            else
+            {
+              span = w - col;
+              if (span > run)
+              {
+                span = run;
+              }
+            }
+            if (textsize_x == 1 && textsize_y == 1)
+            {
+              if (rows == 1)
+              {
+                writeFastHLine(x + xo + col, y + yo + row, span, color);
+              }
+              else
+              {
+                writeFillRect(x + xo, y + yo + row, w, rows, color);
+              }
+            }
+            else
+            {
+              writeFillRect(x + (xo16 + col) * textsize_x, y + (yo16 + row) * textsize_y,
+                            span * textsize_x, rows * textsize_y, color);
+            }
+            run -= span * rows;
+            col += span;
+            if (col >= w)
+            {
+              col = 0;
+              row += rows;
+            }
+          }
+        }
+        else
+        {
+          col += run;
+          while (col >= w)
+          {
+            col -= w;
+            row++;
+          }
+        }
+        fg = !fg;
+      }
+      endWrite();
+      return;
+    }
+    // Set bits are gathered into horizontal runs, each clipped and filled
+    // as one span; a pixel margin keeps every pixel separate
     for (yy = 0; yy < h; yy++)
     {
-      for (xx = 0; xx < w; xx++)
+      int16_t run_x = -1;
+      for (int16_t col = 0; col <= w; col++)
       {
-        if (!(bit++ & 7))
+        bool set = false;
+        if (col < w)
         {
-          bits = pgm_read_byte(&bitmap[bo++]);
+          if (!(bit++ & 7))
+          {
+            bits = pgm_read_byte(&bitmap[bo++]);
+          }
+          set = bits & 0x80;
+          bits <<= 1;
         }
-        if (bits & 0x80)
+        if (set && (run_x < 0))
         {
+          run_x = col;
+        }
+        if ((run_x >= 0) && (!set || text_pixel_margin))
+        {
+          int16_t run_w = (set ? col + 1 : col) - run_x;
           if (textsize_x == 1 && textsize_y == 1)
           {
-            writePixel(x + xo + xx, y + yo + yy, color);
+            writeFastHLine(x + xo + run_x, y + yo + yy, run_w, color);
           }
           else
           {
-            writeFillRect(x + (xo16 + xx) * textsize_x, y + (yo16 + yy) * textsize_y,
-                          textsize_x - text_pixel_margin, textsize_y - text_pixel_margin, color);
+            writeFillRect(x + (xo16 + run_x) * textsize_x, y + (yo16 + yy) * textsize_y,
+                          run_w * textsize_x - text_pixel_margin, textsize_y - text_pixel_margin, color);
           }
+          run_x = -1;
         }
-        bits <<= 1;
       }
     }
     endWrite();
@@ -2004,52 +2469,73 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     block_w = 6 * textsize_x;
     block_h = 8 * textsize_y;
     if (
-        (x > _max_x) ||            // Clip right
-        (y > _max_y) ||            // Clip bottom
-        ((x + block_w - 1) < 0) || // Clip left
-        ((y + block_h - 1) < 0)    // Clip top
+        (x > _max_x) ||                 // Clip right
+        (y > _max_y) ||                 // Clip bottom
+        ((x + block_w - 1) < _min_x) || // Clip left
+        ((y + block_h - 1) < _min_y)    // Clip top
     )
     {
       return;
     }
 
     startWrite();
-    for (int8_t i = 0; i < 5; i++)
-    { // Char bitmap = 5 columns
-      uint8_t line = pgm_read_byte(&font[c * 5 + i]);
-      for (int8_t j = 0; j < 8; j++, line >>= 1)
+    if (text_pixel_margin == 0)
+    {
+      // Each column goes out as vertical runs of foreground (and, if
+      // opaque, background) pixels, one clipped span per run
+      for (int8_t i = 0; i < 5; i++)
       {
-        if (line & 1)
+        uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+        int8_t j = 0;
+        while (j < 8)
         {
-          if (textsize_x == 1 && textsize_y == 1)
+          uint8_t set = line & 1;
+          int8_t run = 1;
+          while (((j + run) < 8) && (((line >> run) & 1) == set))
           {
-            writePixel(x + i, y + j, color);
+            run++;
           }
-          else
+          if (set || (bg != color))
           {
-            if (text_pixel_margin > 0)
+            writeFillRect(x + i * textsize_x, y + j * textsize_y, textsize_x, run * textsize_y, set ? color : bg);
+          }
+          line >>= run;
+          j += run;
+        }
+      }
+    }
+    else
+    {
+      for (int8_t i = 0; i < 5; i++)
+      { // Char bitmap = 5 columns
+        uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+        for (int8_t j = 0; j < 8; j++, line >>= 1)
+        {
+          if (line & 1)
+          {
+            if (textsize_x == 1 && textsize_y == 1)
+            {
+              writePixel(x + i, y + j, color);
+            }
+            else
             {
               writeFillRect(x + (i * textsize_x), y + j * textsize_y, textsize_x - text_pixel_margin, textsize_y - text_pixel_margin, color);
               writeFillRect(x + ((i + 1) * textsize_x) - text_pixel_margin, y + j * textsize_y, text_pixel_margin, textsize_y, bg);
               writeFillRect(x + (i * textsize_x), y + ((j + 1) * textsize_y) - text_pixel_margin, textsize_x - text_pixel_margin, text_pixel_margin, bg);
             }
+          }
+          else if (bg != color)
+          {
+            if (textsize_x == 1 && textsize_y == 1)
+            {
+              writePixel(x + i, y + j, bg);
+            }
             else
             {
-              writeFillRect(x + i * textsize_x, y + j * textsize_y, textsize_x, textsize_y, color);
+              writeFillRect(x + i * textsize_x, y + j * textsize_y, textsize_x, textsize_y, bg);
             }
           }
         }
-        else if (bg != color)
-        {
-          if (textsize_x == 1 && textsize_y == 1)
-          {
-            writePixel(x + i, y + j, bg);
-          }
-          else
-          {
-            writeFillRect(x + i * textsize_x, y + j * textsize_y, textsize_x, textsize_y, bg);
-          }
-        }
       }
     }
     if (bg != color)
@@ -2086,13 +2572,12 @@ size_t Arduino_GFX::write(uint8_t c)
     }
     else if (c != '\r')
     {
-      uint8_t first = pgm_read_byte(&gfxFont->first);
-      if ((c >= first) && (c <= (uint8_t)pgm_read_byte(&gfxFont->last)))
+      GFXglyph *glyph = getGlyph(c);
+      if (glyph)
       {
-        GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
         uint8_t w = pgm_read_byte(&glyph->xAdvance);
         // int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset); // sic
-        if (wrap && ((cursor_x + (textsize_x * w) - 1) > _max_x))
+        if (wrap && ((cursor_x + (textsize_x * w) - 1) > (_width - 1)))
         {
           cursor_x = 0;
           cursor_y += (int16_t)textsize_y *
@@ -2239,7 +2724,7 @@ size_t Arduino_GFX::write(uint8_t c)
 
           if (_u8g2_char_width > 0)
           {
-            if (wrap && ((cursor_x + (textsize_x * _u8g2_char_width) - 1) > _max_x))
+            if (wrap && ((cursor_x + (textsize_x * _u8g2_char_width) - 1) > (_width - 1)))
             {
               cursor_x = 0;
               cursor_y += (int16_t)textsize_y * _u8g2_max_char_height;
@@ -2262,7 +2747,7 @@ size_t Arduino_GFX::write(uint8_t c)
     }
     else if (c != '\r')
     { // Ignore carriage returns
-      if (wrap && ((cursor_x + (textsize_x * 6) - 1) > _max_x))
+      if (wrap && ((cursor_x + (textsize_x * 6) - 1) > (_width - 1)))
       {                             // Off right?
         cursor_x = 0;               // Reset x to zero,
         cursor_y += textsize_y * 8; // advance y one line
@@ -2327,17 +2812,135 @@ void Arduino_GFX::setRotation(uint8_t r)
   case 3:
     _width = HEIGHT;
     _height = WIDTH;
-    _max_x = _width - 1;  ///< x zero base bound
-    _max_y = _height - 1; ///< y zero base bound
     break;
   case 2:
   default: // case 0:
     _width = WIDTH;
     _height = HEIGHT;
-    _max_x = _width - 1;  ///< x zero base bound
-    _max_y = _height - 1; ///< y zero base bound
     break;
   }
+  resetClipRect();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Narrow the clip rectangle until the matching popClipRect().
+          The new clip is the intersection with the current one, so nested
+          widgets can never draw outside their parent.
+  @param  x   Left edge
+  @param  y   Top edge
+  @param  w   Width in pixels
+  @param  h   Height in pixels
+  @return false if GFX_CLIP_STACK_DEPTH is exceeded; the clip is then left
+          as it was, but the call must still be paired with popClipRect()
+*/
+/**************************************************************************/
+bool Arduino_GFX::pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (_clip_depth >= GFX_CLIP_STACK_DEPTH)
+  {
+    _clip_overflow++;
+    return false;
+  }
+  int16_t *saved = _clip_stack[_clip_depth++];
+  saved[0] = _min_x;
+  saved[1] = _min_y;
+  saved[2] = _max_x;
+  saved[3] = _max_y;
+
+  int32_t x2 = (int32_t)x + w - 1;
+  int32_t y2 = (int32_t)y + h - 1;
+  if (x > _min_x)
+  {
+    _min_x = x;
+  }
+  if (y > _min_y)
+  {
+    _min_y = y;
+  }
+  if (x2 < _max_x)
+  {
+    _max_x = x2;
+  }
+  if (y2 < _max_y)
+  {
+    _max_y = y2;
+  }
+  if ((w <= 0) || (h <= 0) || (_min_x > _max_x) || (_min_y > _max_y))
+  { // Empty: no coordinate satisfies min <= v <= max
+    _min_x = _min_y = INT16_MAX;
+    _max_x = _max_y = INT16_MIN;
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Restore the clip rectangle saved by the last pushClipRect()
+*/
+/**************************************************************************/
+void Arduino_GFX::popClipRect(void)
+{
+  if (_clip_overflow)
+  {
+    _clip_overflow--;
+  }
+  else if (_clip_depth)
+  {
+    const int16_t *saved = _clip_stack[--_clip_depth];
+    _min_x = saved[0];
+    _min_y = saved[1];
+    _max_x = saved[2];
+    _max_y = saved[3];
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Drop every pushed clip rectangle and clip to the screen edges
+*/
+/**************************************************************************/
+void Arduino_GFX::resetClipRect(void)
+{
+  _clip_depth = 0;
+  _clip_overflow = 0;
+  _min_x = 0;
+  _min_y = 0;
+  _max_x = _width - 1;
+  _max_y = _height - 1;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Get the current clip rectangle
+  @param  x   Left edge
+  @param  y   Top edge
+  @param  w   Width in pixels, 0 if everything is clipped away
+  @param  h   Height in pixels, 0 if everything is clipped away
+*/
+/**************************************************************************/
+void Arduino_GFX::getClipRect(int16_t *x, int16_t *y, int16_t *w, int16_t *h) const
+{
+  if (_min_x > _max_x)
+  {
+    *x = *y = *w = *h = 0;
+    return;
+  }
+  *x = _min_x;
+  *y = _min_y;
+  *w = _max_x - _min_x + 1;
+  *h = _max_y - _min_y + 1;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Whether drawing is currently clipped to less than the screen
+  @return true inside a pushClipRect() narrower than the screen
+*/
+/**************************************************************************/
+bool Arduino_GFX::isClipped(void) const
+{
+  return (_min_x > 0) || (_min_y > 0) || (_max_x < _width - 1) || (_max_y < _height - 1);
 }
 
 #if !defined(ATTINY_CORE)
@@ -2350,11 +2953,61 @@ void Arduino_GFX::setRotation(uint8_t r)
 void Arduino_GFX::setFont(const GFXfont *f)
 {
   gfxFont = (GFXfont *)f;
+  gfxFontRle = false;
+  gfxFontRemap = NULL;
 #if defined(U8G2_FONT_SUPPORT)
   u8g2Font = NULL;
 #endif // defined(U8G2_FONT_SUPPORT)
 }
 
+/**************************************************************************/
+/*!
+  @brief  Set a character subset font, glyphs are looked up via its remap
+          table if it has one; run-length encoded glyphs are drawn as spans
+  @param  f   The GFXsubfont object, if NULL use built in 6x8 font
+*/
+/**************************************************************************/
+void Arduino_GFX::setFont(const GFXsubfont *f)
+{
+  setFont(f ? &f->font : (const GFXfont *)NULL);
+  if (f)
+  {
+    gfxFontRle = pgm_read_byte(&f->rle);
+#ifdef __AVR__
+    gfxFontRemap = (uint8_t *)pgm_read_pointer(&f->remap);
+#else
+    // pgm_read_pointer() reads 32 bits, too few for a pointer on 64-bit hosts
+    gfxFontRemap = (uint8_t *)f->remap;
+#endif // __AVR__
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Look up the glyph for a character in the current custom font
+  @param  c   The 8-bit font-indexed character (likely ascii)
+  @return Pointer to the glyph, or NULL if the font has no such character
+*/
+/**************************************************************************/
+GFXglyph *Arduino_GFX::getGlyph(uint8_t c)
+{
+  uint8_t first = pgm_read_byte(&gfxFont->first);
+  if ((c < first) || (c > (uint8_t)pgm_read_byte(&gfxFont->last)))
+  {
+    return NULL;
+  }
+  c -= first;
+  if (gfxFontRemap)
+  {
+    c = pgm_read_byte(&gfxFontRemap[c]);
+    if (c == GFX_SUBFONT_MISSING)
+    {
+      return NULL;
+    }
+  }
+  return pgm_read_glyph_ptr(gfxFont, c);
+}
+
 /**************************************************************************/
 /*!
   @brief  flush framebuffer to output (for Canvas or NeoPixel sub-class)
@@ -2448,17 +3101,15 @@ void Arduino_GFX::charBounds(char c, int16_t *x, int16_t *y,
     }
     else if (c != '\r')
     { // Not a carriage return; is normal char
-      uint8_t first = pgm_read_byte(&gfxFont->first),
-              last = pgm_read_byte(&gfxFont->last);
-      if ((c >= first) && (c <= last))
+      GFXglyph *glyph = getGlyph(c);
+      if (glyph)
       { // Char present in this font?
-        GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
         uint8_t gw = pgm_read_byte(&glyph->width),
                 gh = pgm_read_byte(&glyph->height),
                 xa = pgm_read_byte(&glyph->xAdvance);
         int8_t xo = pgm_read_byte(&glyph->xOffset),
                yo = pgm_read_byte(&glyph->yOffset);
-        if (wrap && ((*x + (((int16_t)xo + gw) * textsize_x) - 1) > _max_x))
+        if (wrap && ((*x + (((int16_t)xo + gw) * textsize_x) - 1) > (_width - 1)))
         {
           *x = 0; // Reset x to zero, advance y by one line
           *y += textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
@@ -2507,7 +3158,7 @@ void Arduino_GFX::charBounds(char c, int16_t *x, int16_t *y,
     }
     else if (c != '\r')
     { // Normal char; ignore carriage returns
-      if (wrap && ((*x + (textsize_x * 6) - 1) > _max_x))
+      if (wrap && ((*x + (textsize_x * 6) - 1) > (_width - 1)))
       {                       // Off right?
         *x = 0;               // Reset x to zero,
         *y += textsize_y * 8; // advance y one line
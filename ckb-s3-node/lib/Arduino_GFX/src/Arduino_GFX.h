@@ -14,6 +14,19 @@
 #include "gfxfont.h"
 #endif // !defined(ATTINY_CORE)
 
+#ifndef SPAN_CACHE_SLOTS
+#define SPAN_CACHE_SLOTS 8 ///< Radii kept in the circle span cache
+#endif
+#ifndef SPAN_CACHE_MAX_R
+#define SPAN_CACHE_MAX_R 32 ///< Larger radii use the midpoint algorithm directly
+#endif
+#ifndef GFX_CLIP_STACK_DEPTH
+#define GFX_CLIP_STACK_DEPTH 8 ///< Nesting depth of pushClipRect()
+#endif
+
+#define ARC_FULL 65536UL                              ///< Sweep of a whole ring, in binary angle units
+#define ARC_ANGLE(deg) ((uint32_t)(deg) * ARC_FULL / 360) ///< Whole degrees to binary angle units
+
 #ifndef DEGTORAD
 #define DEGTORAD 0.017453292519943295769236907684886F
 #endif
@@ -164,6 +177,15 @@ public:
   virtual void displayOn();
   virtual void displayOff();
 
+  // CLIP API
+  // Every primitive and glyph is clipped to the intersection of the
+  // pushed rectangles, one span at a time.
+  bool pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h);
+  void popClipRect(void);
+  void resetClipRect(void);
+  void getClipRect(int16_t *x, int16_t *y, int16_t *w, int16_t *h) const;
+  bool isClipped(void) const;
+
   // BASIC DRAW API
   // These MAY be overridden by the subclass to provide device-specific
   // optimized code.  Otherwise 'generic' versions are used.
@@ -200,6 +222,8 @@ public:
 
 #if !defined(ATTINY_CORE)
   void setFont(const GFXfont *f = NULL);
+  void setFont(const GFXsubfont *f);
+  void setFont(decltype(nullptr)) { setFont((const GFXfont *)NULL); } // keeps setFont(nullptr) unambiguous
 #if defined(U8G2_FONT_SUPPORT)
   void setFont(const uint8_t *font);
   void setUTF8Print(bool isEnable);
@@ -219,6 +243,8 @@ public:
   void drawArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color);
   void fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color);
   void fillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color);
+  void fillRingSector(int16_t x, int16_t y, int16_t r1, int16_t r2, uint16_t start, uint32_t sweep, uint16_t color);
+  void prewarmRadii(const int16_t *radii, uint8_t count);
 
 // TFT optimization code, too big for ATMEL family
 #if defined(LITTLE_FOOT_PRINT)
@@ -358,12 +384,18 @@ public:
   }
 
 protected:
+  const uint8_t *getCircleSpans(int16_t r);
+#if !defined(ATTINY_CORE)
+  GFXglyph *getGlyph(uint8_t c);
+#endif // !defined(ATTINY_CORE)
   void charBounds(char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy);
   int16_t
       _width,   ///< Display width as modified by current rotation
       _height,  ///< Display height as modified by current rotation
-      _max_x,   ///< x zero base bound (_width - 1)
-      _max_y,   ///< y zero base bound (_height - 1)
+      _min_x,   ///< Clip left edge (0 when unclipped)
+      _min_y,   ///< Clip top edge (0 when unclipped)
+      _max_x,   ///< Clip right edge (_width - 1 when unclipped)
+      _max_y,   ///< Clip bottom edge (_height - 1 when unclipped)
       cursor_x, ///< x location to start print()ing text
       cursor_y; ///< y location to start print()ing text
   uint16_t
@@ -376,8 +408,20 @@ protected:
       _rotation;         ///< Display rotation (0 thru 3)
   bool
       wrap; ///< If set, 'wrap' text at right edge of display
+  int16_t _clip_stack[GFX_CLIP_STACK_DEPTH][4]; ///< Saved min x, min y, max x, max y per push
+  uint8_t _clip_depth;                          ///< Entries used in _clip_stack
+  uint8_t _clip_overflow;                       ///< Pushes past GFX_CLIP_STACK_DEPTH, ignored until popped
+#if !defined(LITTLE_FOOT_PRINT)
+  // Circle span cache, per instance: canvases and panels may be drawn from
+  // different tasks
+  int16_t _span_cache_r[SPAN_CACHE_SLOTS];                   ///< Radius per slot, 0 = empty
+  uint8_t _span_cache_w[SPAN_CACHE_SLOTS][SPAN_CACHE_MAX_R + 1]; ///< Half width per row
+  uint8_t _span_cache_next;                                  ///< Slot replaced next
+#endif // !defined(LITTLE_FOOT_PRINT)
 #if !defined(ATTINY_CORE)
   GFXfont *gfxFont; ///< Pointer to special font
+  bool gfxFontRle;  ///< gfxFont bitmap holds run lengths (GFXsubfont::rle)
+  uint8_t *gfxFontRemap; ///< Char to glyph index table (GFXsubfont), or NULL
 #endif              // !defined(ATTINY_CORE)
 
 #if defined(U8G2_FONT_SUPPORT)
@@ -65,7 +65,7 @@ void Arduino_TFT::writeRepeat(uint16_t color, uint32_t len)
 void Arduino_TFT::writeFastVLine(int16_t x, int16_t y, int16_t h,
                                  uint16_t color)
 {
-  if (_ordered_in_range(x, 0, _max_x) && h)
+  if (_ordered_in_range(x, _min_x, _max_x) && h)
   { // X on screen, nonzero height
     if (h < 0)
     {             // If negative height...
@@ -75,13 +75,13 @@ void Arduino_TFT::writeFastVLine(int16_t x, int16_t y, int16_t h,
     if (y <= _max_y)
     { // Not off bottom
       int16_t y2 = y + h - 1;
-      if (y2 >= 0)
+      if (y2 >= _min_y)
       { // Not off top
         // Line partly or fully overlaps screen
-        if (y < 0)
+        if (y < _min_y)
         {
-          y = 0;
-          h = y2 + 1;
+          y = _min_y;
+          h = y2 - _min_y + 1;
         } // Clip top
         if (y2 > _max_y)
         {
@@ -108,7 +108,7 @@ void Arduino_TFT::writeFastVLine(int16_t x, int16_t y, int16_t h,
 void Arduino_TFT::writeFastHLine(int16_t x, int16_t y, int16_t w,
                                  uint16_t color)
 {
-  if (_ordered_in_range(y, 0, _max_y) && w)
+  if (_ordered_in_range(y, _min_y, _max_y) && w)
   { // Y on screen, nonzero width
     if (w < 0)
     {             // If negative width...
@@ -118,13 +118,13 @@ void Arduino_TFT::writeFastHLine(int16_t x, int16_t y, int16_t w,
     if (x <= _max_x)
     { // Not off right
       int16_t x2 = x + w - 1;
-      if (x2 >= 0)
+      if (x2 >= _min_x)
       { // Not off left
         // Line partly or fully overlaps screen
-        if (x < 0)
+        if (x < _min_x)
         {
-          x = 0;
-          w = x2 + 1;
+          x = _min_x;
+          w = x2 - _min_x + 1;
         } // Clip left
         if (x2 > _max_x)
         {
@@ -295,11 +295,11 @@ void Arduino_TFT::writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     {
       if (steep)
       {
-        writeFillRectPreclipped(y0, xs, 1, len, color);
+        writeFastVLine(y0, xs, len, color);
       }
       else
       {
-        writeFillRectPreclipped(xs, y0, len, 1, color);
+        writeFastHLine(xs, y0, len, color);
       }
       err += dx;
       y0 += step;
@@ -356,17 +356,17 @@ void Arduino_TFT::drawBitmap(int16_t x, int16_t y,
                              uint16_t color, uint16_t bg)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -412,17 +412,17 @@ void Arduino_TFT::drawBitmap(int16_t x, int16_t y,
                              uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -465,17 +465,17 @@ void Arduino_TFT::drawGrayscaleBitmap(int16_t x, int16_t y,
                                       const uint8_t bitmap[], int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -511,17 +511,17 @@ void Arduino_TFT::drawGrayscaleBitmap(int16_t x, int16_t y,
                                       uint8_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -558,17 +558,17 @@ void Arduino_TFT::drawIndexedBitmap(int16_t x, int16_t y,
                                     uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -602,17 +602,17 @@ void Arduino_TFT::draw16bitRGBBitmap(int16_t x, int16_t y,
                                      uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -677,17 +677,17 @@ void Arduino_TFT::draw16bitRGBBitmap(int16_t x, int16_t y,
                                      const uint16_t bitmap[], int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -722,17 +722,17 @@ void Arduino_TFT::draw16bitRGBBitmap(int16_t x, int16_t y,
                                      uint16_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -763,17 +763,17 @@ void Arduino_TFT::draw16bitBeRGBBitmap(int16_t x, int16_t y,
                                        uint16_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -803,17 +803,17 @@ void Arduino_TFT::draw24bitRGBBitmap(int16_t x, int16_t y,
                                      const uint8_t bitmap[], int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -849,17 +849,17 @@ void Arduino_TFT::draw24bitRGBBitmap(int16_t x, int16_t y,
                                      uint8_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -903,8 +903,16 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
     // Character is assumed previously filtered by write() to eliminate
     // newlines, returns, non-printable characters, etc.  Calling
     // drawChar() directly with 'bad' characters of font may cause mayhem!
-    uint8_t first = pgm_read_byte(&gfxFont->first);
-    GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+    if (gfxFontRle) // run-length glyphs, only the parent span renderer decodes them
+    {
+      Arduino_GFX::drawChar(x, y, c, color, bg);
+      return;
+    }
+    GFXglyph *glyph = getGlyph(c);
+    if (!glyph)
+    {
+      return;
+    }
     uint8_t *bitmap = pgm_read_bitmap_ptr(gfxFont);
 
     uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
@@ -934,8 +942,8 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
     block_h = yAdvance * textsize_y;
     int16_t x1 = (xo < 0) ? (x + xo) : x;
     if (
-        (x1 < 0) ||                             // Clip left
-        ((y - baseline) < 0) ||                 // Clip top
+        (x1 < _min_x) ||                        // Clip left
+        ((y - baseline) < _min_y) ||            // Clip top
         ((x1 + block_w - 1) > _max_x) ||        // Clip right
         ((y - baseline + block_h - 1) > _max_y) // Clip bottom
     )
@@ -1071,8 +1079,8 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
     block_w = 6 * textsize_x;
     block_h = 8 * textsize_y;
     if (
-        (x < 0) ||                      // Clip left
-        (y < 0) ||                      // Clip top
+        (x < _min_x) ||                 // Clip left
+        (y < _min_y) ||                 // Clip top
         ((x + block_w - 1) > _max_x) || // Clip right
         ((y + block_h - 1) > _max_y)    // Clip bottom
     )
@@ -5,11 +5,13 @@
 #define _ARDUINO_CANVAS_H_
 
 #include "../Arduino_GFX.h"
+#include "Arduino_DirtyRegion.h"
 
 class Arduino_Canvas : public Arduino_GFX
 {
 public:
   Arduino_Canvas(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0);
+  ~Arduino_Canvas();
 
   void begin(int32_t speed = GFX_NOT_DEFINED) override;
   void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
@@ -19,11 +21,14 @@ public:
   void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
   void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
   void flush(void) override;
+  void flushAll(void);
+  uint16_t *getFramebuffer(void);
 
 protected:
   uint16_t *_framebuffer;
   Arduino_G *_output;
   int16_t _output_x, _output_y;
+  Arduino_DirtyRegion _dirty;
 
 private:
 };
@@ -0,0 +1,40 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_DIRTYREGION_H_
+#define _ARDUINO_DIRTYREGION_H_
+
+#include <Arduino.h>
+
+#ifndef DIRTY_RECT_MAX
+#define DIRTY_RECT_MAX 8
+#endif
+
+/// Inclusive rectangle, x1/y1 top left, x2/y2 bottom right
+struct Arduino_DirtyRect
+{
+  int16_t x1, y1, x2, y2;
+};
+
+/// Bounded list of dirty rectangles. Overlapping, touching or nearly
+/// touching rectangles are merged as they are added; once the list is full
+/// a new rectangle is merged into the entry it grows the least.
+class Arduino_DirtyRegion
+{
+public:
+  void add(int16_t x, int16_t y, int16_t w, int16_t h);
+  void clear() { _count = 0; }
+  uint8_t count() const { return _count; }
+  const Arduino_DirtyRect &get(uint8_t i) const { return _rects[i]; }
+
+protected:
+  void absorb(uint8_t i);
+
+  Arduino_DirtyRect _rects[DIRTY_RECT_MAX];
+  uint8_t _count = 0;
+  uint8_t _last = 0;
+};
+
+#endif // _ARDUINO_DIRTYREGION_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
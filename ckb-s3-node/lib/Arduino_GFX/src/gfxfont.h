@@ -28,4 +28,21 @@ typedef struct
 	uint8_t yAdvance; ///< Newline distance (y axis)
 } GFXfont;
 
+/// Character subset of a font. Only the glyphs of a declared character set
+/// are stored densely; remap[c - first] gives the glyph index for c, or
+/// GFX_SUBFONT_MISSING when c is not part of the subset. A NULL remap keeps
+/// every glyph from first to last, for a font that is only run-length encoded.
+///
+/// With rle set, each glyph's bitmapOffset points into a stream of
+/// alternating background/foreground run lengths (background first,
+/// row-major across the glyph box). A run longer than 255 is split as
+/// 255, 0, remainder.
+#define GFX_SUBFONT_MISSING 0xFF
+typedef struct
+{
+	GFXfont font;		///< Dense glyph table, first/last span the subset
+	uint8_t *remap; ///< (last - first + 1) glyph indexes, or NULL
+	bool rle;				///< bitmap holds run lengths, not packed bits
+} GFXsubfont;
+
 #endif // _GFXFONT_H_
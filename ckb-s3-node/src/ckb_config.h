@@ -3,30 +3,55 @@
  * ====================================================
  * Drop into any CKB dashboard project.
  *
- * On boot, listens 3s for a browser config session:
+ * A background task listens on Serial for a browser config session at
+ * any time, so boot never waits for one:
  *   Browser → "CKBCFG\n"
- *   Device  → "READY\n"
- *   Browser → JSON blob + "\nEND\n"
- *   Device  → "OK\n" then reboots
+ *   Device  → "READY:<board id>\n"
+ *   Browser → "LEN <n>\n" + exactly n bytes of JSON      (framed)
+ *        or → JSON lines + "\nEND\n"                      (line mode, older pages)
+ *   Device  → "OK\n", or "ERR <reason>\n" / "TIMEOUT\n"
+ *
+ * Messages go into one fixed CKB_CFG_BUF buffer, with no String and no
+ * heap. A session idle for CKB_CFG_TIMEOUT_MS is dropped, and the task
+ * goes back to waiting for the magic.
  *
  * JSON keys (all optional):
  *   wifi_ssid    string
  *   wifi_pass    string
  *   node_url     string   e.g. "http://192.168.1.5:8114"
+ *   nodes        string   multi-node watch list, or extra failover endpoints in the
+ *                         single-node build, e.g. "a=http://10.0.0.2:8114,b=http://10.0.0.3:9000"
  *   accent_r     0-255
  *   accent_g     0-255
  *   accent_b     0-255
  *   bg_r         0-255
  *   bg_g         0-255
  *   bg_b         0-255
+ *   api_token    string   enables POST /config on :8080 (Authorization: Bearer <token>);
+ *                         serial only, POST /config refuses it
+ *   quiet        string   quiet hours, local time, e.g. "23:00-07:00"; "" = none
+ *   tz           string   POSIX TZ for quiet hours, e.g. "CET-1CEST,M3.5.0,M10.5.0/3"
+ *
+ * Listening:
+ *   ckb_config_start();     // first thing in setup(); returns at once
+ *
+ * Changes are saved to NVS and applied live, no reboot: whoever took
+ * the message (serial task, HTTP handler) calls ckb_config_submit(),
+ * and the app's loop picks the new config up with
+ *   if (uint8_t ch = ckb_config_changes(cfg)) ...   // CKB_CFG_CH_* mask
+ * then repaints, swaps the RPC endpoint or rejoins WiFi as needed.
  *
  * Reading saved config:
  *   ckb_cfg_t cfg = ckb_config_load();
  *   cfg.accent_col  — RGB565
  *   cfg.bg_col      — RGB565
  *   cfg.node_url    — char[128]
+ *   cfg.nodes       — char[256], empty unless set
  *   cfg.wifi_ssid   — char[64]
  *   cfg.wifi_pass   — char[64]
+ *   cfg.api_token   — char[48], empty: HTTP config disabled
+ *   cfg.quiet       — char[16], empty: no quiet hours
+ *   cfg.tz          — char[48], empty: UTC
  *   cfg.valid       — true if NVS has been written at least once
  */
 
@@ -39,8 +64,12 @@ struct ckb_cfg_t {
     char     wifi_ssid[64];
     char     wifi_pass[64];
     char     node_url[128];
+    char     nodes[256];   /* "name=url,..." multi-node monitor / RPC failover */
     uint16_t accent_col;   /* RGB565 */
     uint16_t bg_col;       /* RGB565 */
+    char     api_token[48];
+    char     quiet[16];    /* "HH:MM-HH:MM" panel-off hours (ckb_power.h) */
+    char     tz[48];       /* POSIX TZ string */
     bool     valid;
 };
 
@@ -50,25 +79,27 @@ static inline uint16_t rgb_to_565(uint8_t r, uint8_t g, uint8_t b) {
 }
 
 /* ── Tiny JSON field extractors (no heap, no lib) ──────────────── */
-static bool json_str(const String &json, const char *key, char *out, size_t outlen) {
-    String search = String("\"") + key + "\":\"";
-    int idx = json.indexOf(search);
-    if (idx < 0) return false;
-    idx += search.length();
-    int end = json.indexOf('"', idx);
-    if (end < 0) return false;
-    String val = json.substring(idx, end);
-    strncpy(out, val.c_str(), outlen - 1);
-    out[outlen - 1] = '\0';
+static bool json_str(const char *json, const char *key, char *out, size_t outlen) {
+    char search[32];
+    snprintf(search, sizeof(search), "\"%s\":\"", key);
+    const char *p = strstr(json, search);
+    if (!p) return false;
+    p += strlen(search);
+    const char *end = strchr(p, '"');
+    if (!end) return false;
+    size_t n = end - p;
+    if (n >= outlen) n = outlen - 1;
+    memcpy(out, p, n);
+    out[n] = '\0';
     return true;
 }
 
-static int json_int(const String &json, const char *key, int def = -1) {
-    String search = String("\"") + key + "\":";
-    int idx = json.indexOf(search);
-    if (idx < 0) return def;
-    idx += search.length();
-    return json.substring(idx, idx + 6).toInt();
+static int json_int(const char *json, const char *key, int def = -1) {
+    char search[32];
+    snprintf(search, sizeof(search), "\"%s\":", key);
+    const char *p = strstr(json, search);
+    if (!p) return def;
+    return atoi(p + strlen(search));
 }
 
 /* ── Load from NVS ─────────────────────────────────────────────── */
@@ -81,6 +112,10 @@ static ckb_cfg_t ckb_config_load() {
         prefs.getString("ssid", cfg.wifi_ssid, sizeof(cfg.wifi_ssid));
         prefs.getString("pass", cfg.wifi_pass, sizeof(cfg.wifi_pass));
         prefs.getString("url",  cfg.node_url,  sizeof(cfg.node_url));
+        prefs.getString("nodes", cfg.nodes,    sizeof(cfg.nodes));
+        prefs.getString("token", cfg.api_token, sizeof(cfg.api_token));
+        prefs.getString("quiet", cfg.quiet,    sizeof(cfg.quiet));
+        prefs.getString("tz",    cfg.tz,       sizeof(cfg.tz));
         cfg.accent_col = prefs.getUShort("accent", 0xFD00);
         cfg.bg_col     = prefs.getUShort("bg",     0x0841);
     }
@@ -96,93 +131,259 @@ static void ckb_config_save(const ckb_cfg_t &cfg) {
     prefs.putString("ssid", cfg.wifi_ssid);
     prefs.putString("pass", cfg.wifi_pass);
     prefs.putString("url",  cfg.node_url);
+    prefs.putString("nodes", cfg.nodes);
+    prefs.putString("token", cfg.api_token);
+    prefs.putString("quiet", cfg.quiet);
+    prefs.putString("tz",    cfg.tz);
     prefs.putUShort("accent", cfg.accent_col);
     prefs.putUShort("bg",     cfg.bg_col);
     prefs.end();
 }
 
-/* ── Config mode — call at start of setup() ────────────────────── */
-static bool ckb_config_check(unsigned long timeout_ms = 3000) {
-    /* Wait for magic header */
-    unsigned long t0 = millis();
-    String line = "";
-
-    Serial.println("[cfg] waiting...");
-
-    while (millis() - t0 < timeout_ms) {
-        while (Serial.available()) {
-            char c = Serial.read();
-            if (c == '\n' || c == '\r') {
-                line.trim();
-                if (line == "CKBCFG") goto got_magic;
-                line = "";
-            } else {
-                line += c;
-            }
-        }
-        delay(10);
+/* ── Parse a config message over cfg; returns the keys found ─────── */
+static uint8_t ckb_config_parse(const char *json, ckb_cfg_t &cfg) {
+    uint8_t n = 0;
+    char tmp[128];
+    if (json_str(json, "wifi_ssid", tmp, sizeof(tmp))) {
+        strncpy(cfg.wifi_ssid, tmp, sizeof(cfg.wifi_ssid) - 1);
+        n++;
     }
-    Serial.println("[cfg] no config session");
-    return false;
-
-got_magic:
-    Serial.println("READY:" CKB_BOARD_ID);
-    Serial.flush();
-
-    /* Collect JSON until "END" line */
-    String json = "";
-    line = "";
-    unsigned long t1 = millis();
-    while (millis() - t1 < 10000) {
-        while (Serial.available()) {
-            char c = Serial.read();
-            if (c == '\n' || c == '\r') {
-                line.trim();
-                if (line == "END") goto got_end;
-                json += line;
-                line = "";
-                t1 = millis();  /* reset timeout on each line received */
-            } else {
-                line += c;
-            }
-        }
-        delay(5);
+    if (json_str(json, "wifi_pass", tmp, sizeof(tmp))) {
+        strncpy(cfg.wifi_pass, tmp, sizeof(cfg.wifi_pass) - 1);
+        n++;
     }
-    Serial.println("TIMEOUT");
-    return false;
-
-got_end:
-    Serial.println("[cfg] parsing...");
-
-    ckb_cfg_t cfg = ckb_config_load();  /* load existing as base */
-
-    /* Parse each field if present */
-    char tmp[128];
-    if (json_str(json, "wifi_ssid", tmp, sizeof(tmp)))
-        strncpy(cfg.wifi_ssid, tmp, sizeof(cfg.wifi_ssid));
-    if (json_str(json, "wifi_pass", tmp, sizeof(tmp)))
-        strncpy(cfg.wifi_pass, tmp, sizeof(cfg.wifi_pass));
-    if (json_str(json, "node_url", tmp, sizeof(tmp)))
-        strncpy(cfg.node_url, tmp, sizeof(cfg.node_url));
+    if (json_str(json, "node_url", tmp, sizeof(tmp))) {
+        strncpy(cfg.node_url, tmp, sizeof(cfg.node_url) - 1);
+        n++;
+    }
+    if (json_str(json, "nodes", cfg.nodes, sizeof(cfg.nodes))) n++;   /* longer than tmp */
+    if (json_str(json, "api_token", cfg.api_token, sizeof(cfg.api_token))) n++;
+    if (json_str(json, "quiet", cfg.quiet, sizeof(cfg.quiet))) n++;
+    if (json_str(json, "tz", cfg.tz, sizeof(cfg.tz))) n++;
 
     int ar = json_int(json, "accent_r", -1);
     int ag = json_int(json, "accent_g", -1);
     int ab = json_int(json, "accent_b", -1);
-    if (ar >= 0 && ag >= 0 && ab >= 0)
+    if (ar >= 0 && ag >= 0 && ab >= 0) {
         cfg.accent_col = rgb_to_565(ar, ag, ab);
+        n++;
+    }
 
     int br = json_int(json, "bg_r", -1);
     int bg = json_int(json, "bg_g", -1);
     int bb = json_int(json, "bg_b", -1);
-    if (br >= 0 && bg >= 0 && bb >= 0)
+    if (br >= 0 && bg >= 0 && bb >= 0) {
         cfg.bg_col = rgb_to_565(br, bg, bb);
+        n++;
+    }
+    return n;
+}
 
-    cfg.valid = true;
+/* ── Live changes ──────────────────────────────────────────────── */
+enum {
+    CKB_CFG_CH_WIFI   = 1 << 0,    /* ssid / pass: rejoin */
+    CKB_CFG_CH_URL    = 1 << 1,    /* node_url: swap the RPC endpoint */
+    CKB_CFG_CH_NODES  = 1 << 2,    /* nodes: new endpoint list */
+    CKB_CFG_CH_COLOUR = 1 << 3,    /* accent / bg: repaint */
+    CKB_CFG_CH_POWER  = 1 << 4,    /* quiet hours / tz */
+};
+
+static ckb_cfg_t    _ckb_cfg_next;
+static bool         _ckb_cfg_pending = false;
+static portMUX_TYPE _ckb_cfg_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint8_t ckb_config_diff(const ckb_cfg_t &a, const ckb_cfg_t &b) {
+    uint8_t ch = 0;
+    if (strcmp(a.wifi_ssid, b.wifi_ssid) || strcmp(a.wifi_pass, b.wifi_pass)) ch |= CKB_CFG_CH_WIFI;
+    if (strcmp(a.node_url, b.node_url)) ch |= CKB_CFG_CH_URL;
+    if (strcmp(a.nodes, b.nodes)) ch |= CKB_CFG_CH_NODES;
+    if (a.accent_col != b.accent_col || a.bg_col != b.bg_col) ch |= CKB_CFG_CH_COLOUR;
+    if (strcmp(a.quiet, b.quiet) || strcmp(a.tz, b.tz)) ch |= CKB_CFG_CH_POWER;
+    return ch;
+}
+
+/* Save and hand to the app's loop; any task */
+static void ckb_config_submit(const ckb_cfg_t &cfg) {
     ckb_config_save(cfg);
+    portENTER_CRITICAL(&_ckb_cfg_mux);
+    _ckb_cfg_next = cfg;
+    _ckb_cfg_next.valid = true;
+    _ckb_cfg_pending = true;
+    portEXIT_CRITICAL(&_ckb_cfg_mux);
+}
+
+/* App loop: takes a submitted config into cfg and returns what moved
+ * (0 when nothing was submitted, or nothing the app acts on changed) */
+static uint8_t ckb_config_changes(ckb_cfg_t &cfg) {
+    if (!_ckb_cfg_pending) return 0;
+    ckb_cfg_t next;
+    portENTER_CRITICAL(&_ckb_cfg_mux);
+    next = _ckb_cfg_next;
+    _ckb_cfg_pending = false;
+    portEXIT_CRITICAL(&_ckb_cfg_mux);
+    /* Before the first save the app ran on compiled-in defaults */
+    uint8_t ch = cfg.valid ? ckb_config_diff(cfg, next) : 0xFF;
+    cfg = next;
+    return ch;
+}
+
+/* ── Config channel — background task ──────────────────────────── */
+#ifndef CKB_CFG_BUF
+#define CKB_CFG_BUF         1024    /* largest config message */
+#endif
+#ifndef CKB_CFG_TIMEOUT_MS
+#define CKB_CFG_TIMEOUT_MS  10000   /* idle gap that abandons a session */
+#endif
+
+enum { CKB_CFG_HUNT, CKB_CFG_LINES, CKB_CFG_FRAME };
+
+struct ckb_cfg_rx_t {
+    uint8_t  mode;
+    char     line[80];              /* magic / "LEN n" / "END"; JSON lines bypass it */
+    uint8_t  line_len;
+    char     buf[CKB_CFG_BUF + 1];
+    uint16_t len;
+    uint16_t want;                  /* framed: payload bytes still to come */
+    bool     overflow;
+    bool     skip_lf;               /* "LEN n\r\n": the \n isn't payload */
+    uint32_t last_ms;
+    uint32_t sessions;
+};
 
-    Serial.println("OK");
+static ckb_cfg_rx_t _ckb_cfg_rx = {};
+
+static void ckb_config_reply(const char *msg) {
+    Serial.println(msg);
     Serial.flush();
-    delay(200);
-    ESP.restart();
-    return true;  /* never reached */
+}
+
+static void ckb_config_finish() {
+    ckb_cfg_rx_t &rx = _ckb_cfg_rx;
+    rx.mode = CKB_CFG_HUNT;
+    rx.line_len = 0;
+    if (rx.overflow) {
+        ckb_config_reply("ERR too long");
+        return;
+    }
+    rx.buf[rx.len] = '\0';
+    ckb_cfg_t cfg = ckb_config_load();  /* load existing as base */
+    uint8_t keys = ckb_config_parse(rx.buf, cfg);
+    if (!keys) {
+        ckb_config_reply("ERR no config keys");
+        return;
+    }
+    Serial.printf("[cfg] %u keys from a %u byte message\n", (unsigned)keys, (unsigned)rx.len);
+    cfg.valid = true;
+    ckb_config_submit(cfg);
+    ckb_config_reply("OK");
+}
+
+/* Line-mode JSON goes straight into buf, a line at a time */
+static void ckb_config_append(const char *p, size_t n) {
+    ckb_cfg_rx_t &rx = _ckb_cfg_rx;
+    if (rx.len + n > CKB_CFG_BUF) {
+        rx.overflow = true;
+        return;
+    }
+    memcpy(rx.buf + rx.len, p, n);
+    rx.len += n;
+}
+
+static void ckb_config_line(char *line, uint8_t n) {
+    ckb_cfg_rx_t &rx = _ckb_cfg_rx;
+    while (n && (line[n - 1] == ' ' || line[n - 1] == '\t')) n--;
+    line[n] = '\0';
+    const char *p = line;
+    while (*p == ' ' || *p == '\t') p++;
+
+    if (rx.mode == CKB_CFG_HUNT) {
+        if (strcmp(p, "CKBCFG") != 0) return;
+        rx.mode = CKB_CFG_LINES;
+        rx.len = 0;
+        rx.overflow = false;
+        rx.sessions++;
+        ckb_config_reply("READY:" CKB_BOARD_ID);
+        return;
+    }
+    if (!strcmp(p, "END")) {
+        ckb_config_finish();
+    } else if (!rx.len && !rx.overflow && !strncmp(p, "LEN ", 4)) {
+        long want = atol(p + 4);
+        if (want <= 0 || want > CKB_CFG_BUF) {
+            rx.mode = CKB_CFG_HUNT;
+            ckb_config_reply("ERR length");
+            return;
+        }
+        rx.want = (uint16_t)want;
+        rx.mode = CKB_CFG_FRAME;
+    } else {
+        ckb_config_append(p, strlen(p));
+    }
+}
+
+static void ckb_config_byte(char c) {
+    ckb_cfg_rx_t &rx = _ckb_cfg_rx;
+    if (rx.mode == CKB_CFG_FRAME) {
+        if (rx.skip_lf) {
+            rx.skip_lf = false;
+            if (c == '\n') return;
+        }
+        rx.buf[rx.len++] = c;
+        if (--rx.want == 0) ckb_config_finish();
+        return;
+    }
+    if (c == '\n' || c == '\r') {
+        ckb_config_line(rx.line, rx.line_len);
+        rx.line_len = 0;
+        rx.skip_lf = c == '\r' && rx.mode == CKB_CFG_FRAME;
+        return;
+    }
+    if (rx.line_len < sizeof(rx.line) - 1) {
+        rx.line[rx.line_len++] = c;
+    } else if (rx.mode == CKB_CFG_LINES) {
+        /* Long JSON line: flush what's held so far into buf */
+        ckb_config_append(rx.line, rx.line_len);
+        rx.line[0] = c;
+        rx.line_len = 1;
+    } else {
+        rx.line_len = 0;                /* not the magic; keep hunting */
+    }
+}
+
+static void ckb_config_task(void *) {
+    uint8_t chunk[64];
+    for (;;) {
+        ckb_cfg_rx_t &rx = _ckb_cfg_rx;
+        int avail;
+        while ((avail = Serial.available()) > 0) {
+            size_t n = Serial.read(chunk, avail < (int)sizeof(chunk) ? avail : sizeof(chunk));
+            for (size_t i = 0; i < n; i++) ckb_config_byte((char)chunk[i]);
+            rx.last_ms = millis();
+        }
+        if (rx.mode != CKB_CFG_HUNT && millis() - rx.last_ms > CKB_CFG_TIMEOUT_MS) {
+            rx.mode = CKB_CFG_HUNT;
+            rx.line_len = 0;
+            ckb_config_reply("TIMEOUT");
+        }
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
+}
+
+/* ── HTTP auth ─────────────────────────────────────────────────── */
+/* "Bearer <token>" against cfg.api_token, in constant time; an unset
+ * token refuses everyone */
+static bool ckb_config_auth(const ckb_cfg_t &cfg, const char *header) {
+    size_t n = strlen(cfg.api_token);
+    if (!n || strncmp(header, "Bearer ", 7) != 0) return false;
+    const char *given = header + 7;
+    if (strlen(given) != n) return false;
+    uint8_t diff = 0;
+    for (size_t i = 0; i < n; i++) diff |= (uint8_t)(given[i] ^ cfg.api_token[i]);
+    return diff == 0;
+}
+
+/* ── Start listening — call at start of setup() ────────────────── */
+static bool ckb_config_start(uint8_t core = 0) {
+    Serial.println("[cfg] listening for CKBCFG");
+    return xTaskCreatePinnedToCore(ckb_config_task, "cfg", 4096, nullptr, 1, nullptr, core) == pdPASS;
 }
@@ -0,0 +1,706 @@
+/*
+ * ckb_failover.h — Route RPC calls to the healthiest of several endpoints
+ * =======================================================================
+ * The single-node poller's rpc_call() goes through here. Every endpoint
+ * keeps its own health record, updated by each call it takes part in:
+ *
+ *   latency   EWMA (1/8 per reply, more after a quiet spell) and p95
+ *             over the last CKB_FO_SAMPLES replies
+ *   errors    error-rate EWMA, same weighting, per mille; connect failures,
+ *             timeouts, resets and non-200 replies all count
+ *   breaker   closed → open after CKB_FO_TRIP_FAILS failures in a row or
+ *             an error rate past CKB_FO_TRIP_ERR_PM; open endpoints get no
+ *             traffic for a cool-down (CKB_FO_OPEN_MS, doubling up to
+ *             CKB_FO_OPEN_MAX_MS), then half-open: one probe, sent
+ *             alongside a normal call, closes or re-opens it
+ *
+ * Every CKB_FO_REFRESH_CALLS calls the same kind of probe goes to the
+ * closed endpoint measured longest ago, so figures for the standby nodes
+ * don't go stale. Probes may finish up to CKB_FO_PROBE_WAIT_MS after the
+ * answer is in; that is the only time a call waits on a second request.
+ *
+ * Calls go to the primary: the closed endpoint with the lowest
+ * latency × error score. A challenger has to beat the primary by
+ * CKB_FO_SWITCH_PCT so two similar nodes don't trade places every poll.
+ * If the primary hasn't answered by its own p95, the same request is
+ * hedged to the runner-up and whichever reply lands first is used; the
+ * other socket is closed. A primary that fails outright is retried on the
+ * next endpoint straight away, within the same call — or, with no other
+ * endpoint closed, once more on itself, unless that failure tripped it.
+ *
+ * Plain http://, HTTP/1.0 so replies are never chunked. Replies are kept
+ * in two CKB_FO_RESP_MAX buffers in PSRAM (one per concurrent request).
+ * Calls must come from one task; ckb_fo_copy() is safe from any.
+ *
+ * Usage:
+ *   ckb_fo_begin();
+ *   ckb_fo_add("main", url, strlen(url));
+ *   ckb_fo_add_list("backup=http://10.0.0.3:8114");
+ *   const char *json = ckb_fo_call(body, &len);   // null on failure
+ *   static ckb_fo_snapshot_t s; ckb_fo_copy(&s);  // /metrics, footer
+ *   ckb_fo_clear(); ckb_fo_add(...);             // new list (config change)
+ *
+ * Host: builds without FreeRTOS (tools/failover_host.cpp, tools/mock_rpc.py).
+ */
+
+#pragma once
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(ESP32)
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <lwip/sockets.h>
+#include <lwip/netdb.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <time.h>
+#endif
+
+#ifndef CKB_FO_MAX_EP
+#define CKB_FO_MAX_EP        4
+#endif
+#ifndef CKB_FO_TIMEOUT_MS
+#define CKB_FO_TIMEOUT_MS    5000    /* per request, connect to last byte */
+#endif
+#ifndef CKB_FO_RESP_MAX
+#define CKB_FO_RESP_MAX      (96 * 1024)
+#endif
+#ifndef CKB_FO_TRIP_FAILS
+#define CKB_FO_TRIP_FAILS    3
+#endif
+#ifndef CKB_FO_TRIP_ERR_PM
+#define CKB_FO_TRIP_ERR_PM   500     /* error rate that opens the breaker, per mille */
+#endif
+#ifndef CKB_FO_OPEN_MS
+#define CKB_FO_OPEN_MS       2000    /* first cool-down */
+#endif
+#ifndef CKB_FO_OPEN_MAX_MS
+#define CKB_FO_OPEN_MAX_MS   60000
+#endif
+#ifndef CKB_FO_HEDGE_MIN_MS
+#define CKB_FO_HEDGE_MIN_MS  100     /* never hedge sooner than this */
+#endif
+#ifndef CKB_FO_PROBE_WAIT_MS
+#define CKB_FO_PROBE_WAIT_MS 1000    /* how long a probe may outlast the answer */
+#endif
+#ifndef CKB_FO_REFRESH_CALLS
+#define CKB_FO_REFRESH_CALLS 50      /* re-measure an idle endpoint this often */
+#endif
+#ifndef CKB_FO_EWMA_TAU_MS
+#define CKB_FO_EWMA_TAU_MS   60000   /* a sample this long after the last replaces it */
+#endif
+#define CKB_FO_HEDGE_SAMPLES 8       /* p95 needs this many replies to be trusted */
+#define CKB_FO_SAMPLES       32
+#define CKB_FO_SWITCH_PCT    80
+
+enum { CKB_FO_CLOSED, CKB_FO_OPEN, CKB_FO_HALF };
+
+/* ── What /metrics and the footer see ──────────────────────────── */
+struct ckb_fo_info_t {
+    char     name[12];
+    char     host[64];
+    char     path[32];
+    uint16_t port;
+    uint8_t  breaker;       /* CKB_FO_CLOSED / OPEN / HALF */
+    uint32_t ewma_ms;
+    uint32_t p95_ms;
+    uint16_t err_pm;
+    uint32_t calls;         /* requests sent, hedges and probes included */
+    uint32_t errors;
+    uint32_t wins;          /* replies that were used */
+    uint32_t hedges;        /* hedged requests it received */
+    uint32_t trips;         /* times its breaker opened */
+};
+
+struct ckb_fo_snapshot_t {
+    uint8_t       count;
+    uint8_t       primary;
+    int8_t        last;         /* endpoint that answered the last call, -1 if none */
+    uint32_t      calls;
+    uint32_t      failed;       /* calls no endpoint answered */
+    uint32_t      hedges;
+    uint32_t      hedge_wins;   /* hedges that answered first */
+    uint32_t      switches;     /* primary changes */
+    ckb_fo_info_t ep[CKB_FO_MAX_EP];
+};
+
+/* ── Private state ─────────────────────────────────────────────── */
+struct ckb_fo_ep_t {
+    struct sockaddr_in addr;
+    bool     resolved;
+    uint32_t open_until;
+    uint32_t open_ms;
+    uint8_t  fails;             /* in a row */
+    uint32_t updated;           /* last health update, 0 = never */
+    uint32_t sampled;           /* when lat[] last got a sample */
+    uint16_t lat[CKB_FO_SAMPLES];
+    uint8_t  lat_n, lat_head;
+};
+
+enum { CKB_FO_IDLE, CKB_FO_CONNECT, CKB_FO_SEND, CKB_FO_RECV };
+enum { CKB_FO_PRIMARY, CKB_FO_RETRY, CKB_FO_HEDGE, CKB_FO_PROBE };
+
+struct ckb_fo_slot_t {
+    int8_t   ep;                /* -1 when idle */
+    uint8_t  role;
+    uint8_t  phase;
+    int      fd;
+    uint32_t t0;
+    char     head[192];         /* request line and headers */
+    uint16_t head_len;
+    uint32_t tx_off;
+    char     line[64];
+    uint8_t  line_len;
+    bool     status_seen, in_body;
+    uint16_t status;
+    int32_t  content_len;       /* -1 until a Content-Length header */
+    char    *body;              /* CKB_FO_RESP_MAX + 1 */
+    uint32_t body_len;
+    bool     overflow;
+};
+
+static ckb_fo_ep_t       _ckb_fo_ep[CKB_FO_MAX_EP];
+static ckb_fo_slot_t     _ckb_fo_slot[2];
+static ckb_fo_snapshot_t _ckb_fo;              /* owned by the calling task */
+static ckb_fo_snapshot_t _ckb_fo_pub;
+
+#if defined(ESP32)
+static portMUX_TYPE _ckb_fo_mux = portMUX_INITIALIZER_UNLOCKED;
+#define CKB_FO_LOCK()   portENTER_CRITICAL(&_ckb_fo_mux)
+#define CKB_FO_UNLOCK() portEXIT_CRITICAL(&_ckb_fo_mux)
+#else
+#define CKB_FO_LOCK()
+#define CKB_FO_UNLOCK()
+#endif
+
+static uint32_t ckb_fo_millis() {
+#if defined(ESP32)
+    return millis();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+#endif
+}
+
+static void ckb_fo_publish() {
+    CKB_FO_LOCK();
+    memcpy(&_ckb_fo_pub, &_ckb_fo, sizeof(_ckb_fo));
+    CKB_FO_UNLOCK();
+}
+
+/* ── Setup ─────────────────────────────────────────────────────── */
+static bool ckb_fo_begin() {
+    _ckb_fo.last = -1;
+    for (uint8_t s = 0; s < 2; s++) {
+        ckb_fo_slot_t &sl = _ckb_fo_slot[s];
+        sl.ep = -1;
+        sl.fd = -1;
+        if (sl.body) continue;
+#if defined(ESP32)
+        sl.body = (char *)heap_caps_malloc(CKB_FO_RESP_MAX + 1, MALLOC_CAP_SPIRAM);
+#else
+        sl.body = (char *)malloc(CKB_FO_RESP_MAX + 1);
+#endif
+        if (!sl.body) return false;
+    }
+    return true;
+}
+
+/* "http://host[:port][/path]"; name may be NULL ("n1", "n2", ...) */
+static bool ckb_fo_add(const char *name, const char *url, size_t len) {
+    ckb_fo_snapshot_t &f = _ckb_fo;
+    if (f.count >= CKB_FO_MAX_EP || len < 8 || strncmp(url, "http://", 7) != 0) return false;
+    ckb_fo_ep_t &e = _ckb_fo_ep[f.count];
+    ckb_fo_info_t &n = f.ep[f.count];
+    memset(&e, 0, sizeof(e));
+    memset(&n, 0, sizeof(n));
+
+    const char *p = url + 7, *end = url + len;
+    const char *h = p;
+    while (p < end && *p != ':' && *p != '/') p++;
+    size_t hl = p - h;
+    if (hl == 0 || hl >= sizeof(n.host)) return false;
+    memcpy(n.host, h, hl);
+    n.host[hl] = '\0';
+    n.port = 80;
+    if (p < end && *p == ':') {
+        n.port = (uint16_t)strtoul(p + 1, nullptr, 10);
+        while (p < end && *p != '/') p++;
+    }
+    size_t pl = end - p;
+    if (pl == 0) strcpy(n.path, "/");
+    else if (pl < sizeof(n.path)) { memcpy(n.path, p, pl); n.path[pl] = '\0'; }
+    else return false;
+    if (!n.port) return false;
+
+    /* The same node listed twice would only hedge against itself */
+    for (uint8_t i = 0; i < f.count; i++)
+        if (f.ep[i].port == n.port && !strcmp(f.ep[i].host, n.host) &&
+            !strcmp(f.ep[i].path, n.path)) return false;
+
+    if (name && name[0]) snprintf(n.name, sizeof(n.name), "%s", name);
+    else snprintf(n.name, sizeof(n.name), "n%u", (unsigned)(f.count + 1));
+    e.open_ms = CKB_FO_OPEN_MS;
+    f.count++;
+    ckb_fo_publish();
+    return true;
+}
+
+/* Forget every endpoint and its health, keeping the totals; same task
+ * as ckb_fo_call(), between calls */
+static inline void ckb_fo_clear() {
+    ckb_fo_snapshot_t &f = _ckb_fo;
+    f.count = 0;
+    f.primary = 0;
+    f.last = -1;
+    memset(f.ep, 0, sizeof(f.ep));
+    memset(_ckb_fo_ep, 0, sizeof(_ckb_fo_ep));
+    ckb_fo_publish();
+}
+
+/* Same list format as ckb_mn_add_list(): "name=url, url; name=url" */
+static uint8_t ckb_fo_add_list(const char *list) {
+    const char *p = list;
+    while (p && *p) {
+        while (*p == ',' || *p == ';' || *p == ' ' || *p == '\t' || *p == '\n') p++;
+        if (!*p) break;
+        const char *e = p;
+        while (*e && *e != ',' && *e != ';' && *e != ' ' && *e != '\t' && *e != '\n') e++;
+        const char *eq = (const char *)memchr(p, '=', e - p);
+        char name[12] = "";
+        const char *url = p;
+        if (eq) {
+            size_t nl = eq - p;
+            if (nl >= sizeof(name)) nl = sizeof(name) - 1;
+            memcpy(name, p, nl);
+            name[nl] = '\0';
+            url = eq + 1;
+        }
+        ckb_fo_add(name, url, e - url);
+        p = e;
+    }
+    return _ckb_fo.count;
+}
+
+/* ── Health ────────────────────────────────────────────────────── */
+/* Lower is better; unmeasured endpoints score lowest so each gets tried */
+static uint32_t ckb_fo_score(uint8_t i) {
+    const ckb_fo_info_t &n = _ckb_fo.ep[i];
+    return (n.ewma_ms + 1) * (1000 + 4 * (uint32_t)n.err_pm) / 1000;
+}
+
+static void ckb_fo_p95(uint8_t i) {
+    ckb_fo_ep_t &e = _ckb_fo_ep[i];
+    uint16_t s[CKB_FO_SAMPLES];
+    uint8_t n = e.lat_n;
+    memcpy(s, e.lat, n * sizeof(uint16_t));
+    for (uint8_t a = 1; a < n; a++) {               /* ≤ 32 entries: insertion sort */
+        uint16_t v = s[a];
+        int8_t b = a - 1;
+        while (b >= 0 && s[b] > v) { s[b + 1] = s[b]; b--; }
+        s[b + 1] = v;
+    }
+    _ckb_fo.ep[i].p95_ms = s[(n * 95 + 99) / 100 - 1];
+}
+
+/* EWMA weight, per mille: 1/8 for back-to-back samples, rising with the
+ * time since the last one, so a standby node measured once in a while
+ * isn't judged on figures from minutes ago */
+static uint32_t ckb_fo_weight(uint8_t i, uint32_t now) {
+    ckb_fo_ep_t &e = _ckb_fo_ep[i];
+    uint32_t dt = now - e.updated;
+    bool first = !e.updated;
+    e.updated = now ? now : 1;
+    if (first) return 1000;
+    uint32_t w = dt >= CKB_FO_EWMA_TAU_MS ? 1000 : (uint32_t)((uint64_t)dt * 1000 / CKB_FO_EWMA_TAU_MS);
+    return w < 125 ? 125 : w;
+}
+
+static void ckb_fo_latency(uint8_t i, uint32_t ms, uint32_t w) {
+    ckb_fo_ep_t &e = _ckb_fo_ep[i];
+    ckb_fo_info_t &n = _ckb_fo.ep[i];
+    e.lat[e.lat_head] = ms > 0xFFFF ? 0xFFFF : (uint16_t)ms;
+    e.lat_head = (e.lat_head + 1) % CKB_FO_SAMPLES;
+    if (e.lat_n < CKB_FO_SAMPLES) e.lat_n++;
+    e.sampled = e.updated;
+    ckb_fo_p95(i);
+    n.ewma_ms = e.lat_n > 1 ? (uint32_t)(((int64_t)n.ewma_ms * (1000 - w) + (int64_t)ms * w + 500) / 1000) : ms;
+}
+
+static void ckb_fo_success(uint8_t i, uint32_t ms, uint32_t now) {
+    ckb_fo_ep_t &e = _ckb_fo_ep[i];
+    ckb_fo_info_t &n = _ckb_fo.ep[i];
+    uint32_t w = ckb_fo_weight(i, now);
+    ckb_fo_latency(i, ms, w);
+    n.err_pm -= n.err_pm * w / 1000;
+    e.fails = 0;
+    if (n.breaker != CKB_FO_CLOSED) {
+        n.breaker = CKB_FO_CLOSED;
+        e.open_ms = CKB_FO_OPEN_MS;
+        if (n.err_pm > CKB_FO_TRIP_ERR_PM / 4) n.err_pm = CKB_FO_TRIP_ERR_PM / 4;
+    }
+}
+
+static void ckb_fo_failure(uint8_t i, uint32_t now) {
+    ckb_fo_ep_t &e = _ckb_fo_ep[i];
+    ckb_fo_info_t &n = _ckb_fo.ep[i];
+    n.errors++;
+    n.err_pm += (1000 - n.err_pm) * ckb_fo_weight(i, now) / 1000;
+    if (e.fails < 255) e.fails++;
+    bool trip;
+    if (n.breaker == CKB_FO_HALF) {                 /* failed probe: wait longer */
+        e.open_ms = e.open_ms * 2 > CKB_FO_OPEN_MAX_MS ? CKB_FO_OPEN_MAX_MS : e.open_ms * 2;
+        trip = true;
+    } else {
+        trip = n.breaker == CKB_FO_CLOSED &&
+               (e.fails >= CKB_FO_TRIP_FAILS || (n.err_pm >= CKB_FO_TRIP_ERR_PM && n.calls >= 8));
+    }
+    if (trip) {
+        n.breaker = CKB_FO_OPEN;
+        e.open_until = now + e.open_ms;
+        n.trips++;
+    }
+}
+
+/* Best closed endpoint other than `skip` / the ones in `tried`; -1 if none */
+static int8_t ckb_fo_best(int8_t skip, uint8_t tried) {
+    int8_t best = -1;
+    for (uint8_t i = 0; i < _ckb_fo.count; i++) {
+        if (i == skip || (tried >> i & 1) || _ckb_fo.ep[i].breaker != CKB_FO_CLOSED) continue;
+        if (best < 0 || ckb_fo_score(i) < ckb_fo_score(best)) best = i;
+    }
+    return best;
+}
+
+/* Primary for the next call, with hysteresis. When every breaker is open
+ * the one due back soonest is used anyway — the poller must ask someone. */
+static uint8_t ckb_fo_pick() {
+    ckb_fo_snapshot_t &f = _ckb_fo;
+    uint8_t cur = f.primary;
+    int8_t best = ckb_fo_best(-1, 0);
+    uint8_t next = cur;
+    if (best >= 0) {
+        if (f.ep[cur].breaker != CKB_FO_CLOSED ||
+            ckb_fo_score(best) * 100 < ckb_fo_score(cur) * CKB_FO_SWITCH_PCT) next = best;
+    } else {
+        for (uint8_t i = 0; i < f.count; i++)
+            if ((int32_t)(_ckb_fo_ep[i].open_until - _ckb_fo_ep[next].open_until) < 0) next = i;
+        f.ep[next].breaker = CKB_FO_HALF;
+    }
+    if (next != cur) f.switches++;
+    f.primary = next;
+    return next;
+}
+
+/* ── Sockets ───────────────────────────────────────────────────── */
+static void ckb_fo_close(ckb_fo_slot_t &s) {
+    if (s.fd >= 0) close(s.fd);
+    s.fd = -1;
+    s.ep = -1;
+    s.phase = CKB_FO_IDLE;
+}
+
+static bool ckb_fo_resolve(uint8_t i) {
+    ckb_fo_ep_t &e = _ckb_fo_ep[i];
+    if (e.resolved) return true;
+    memset(&e.addr, 0, sizeof(e.addr));
+    e.addr.sin_family = AF_INET;
+    e.addr.sin_port = htons(_ckb_fo.ep[i].port);
+    const char *host = _ckb_fo.ep[i].host;
+    if (inet_pton(AF_INET, host, &e.addr.sin_addr) != 1) {
+        struct addrinfo hints, *res = nullptr;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        if (getaddrinfo(host, nullptr, &hints, &res) != 0 || !res) return false;
+        e.addr.sin_addr = ((struct sockaddr_in *)res->ai_addr)->sin_addr;
+        freeaddrinfo(res);
+    }
+    e.resolved = true;
+    return true;
+}
+
+/* Start `body` on endpoint i in slot s; false if it failed at once */
+static bool ckb_fo_open(ckb_fo_slot_t &s, uint8_t i, uint8_t role, size_t body_len, uint32_t now) {
+    ckb_fo_ep_t &e = _ckb_fo_ep[i];
+    ckb_fo_info_t &n = _ckb_fo.ep[i];
+    s.ep = (int8_t)i;
+    s.role = role;
+    s.t0 = now;
+    s.tx_off = 0;
+    s.line_len = 0;
+    s.status_seen = s.in_body = s.overflow = false;
+    s.status = 0;
+    s.content_len = -1;
+    s.body_len = 0;
+    n.calls++;
+    if (role == CKB_FO_HEDGE) n.hedges++;
+    int hl = snprintf(s.head, sizeof(s.head),
+        "POST %s HTTP/1.0\r\nHost: %s:%u\r\nContent-Type: application/json\r\n"
+        "Content-Length: %u\r\nConnection: close\r\n\r\n",
+        n.path, n.host, (unsigned)n.port, (unsigned)body_len);
+    s.head_len = hl < (int)sizeof(s.head) ? (uint16_t)hl : 0;
+    if (!s.head_len || !ckb_fo_resolve(i)) return false;
+    s.fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (s.fd < 0) return false;
+    fcntl(s.fd, F_SETFL, fcntl(s.fd, F_GETFL, 0) | O_NONBLOCK);
+    int one = 1;
+    setsockopt(s.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    if (connect(s.fd, (struct sockaddr *)&e.addr, sizeof(e.addr)) != 0 && errno != EINPROGRESS) {
+        close(s.fd);
+        s.fd = -1;
+        e.resolved = false;                         /* maybe the address moved */
+        return false;
+    }
+    s.phase = CKB_FO_CONNECT;
+    return true;
+}
+
+static void ckb_fo_send(ckb_fo_slot_t &s, const char *body, size_t body_len) {
+    const char *p;
+    size_t left;
+    if (s.tx_off < s.head_len) { p = s.head + s.tx_off; left = s.head_len - s.tx_off; }
+    else { p = body + (s.tx_off - s.head_len); left = body_len - (s.tx_off - s.head_len); }
+    if (left) {
+        int k = send(s.fd, p, left, 0);
+        if (k > 0) s.tx_off += k;
+        else if (errno != EAGAIN && errno != EWOULDBLOCK) { s.phase = CKB_FO_IDLE; return; }
+    }
+    if (s.tx_off >= s.head_len + body_len) s.phase = CKB_FO_RECV;
+}
+
+static void ckb_fo_http_line(ckb_fo_slot_t &s) {
+    s.line[s.line_len] = '\0';
+    if (!s.status_seen) {
+        s.status_seen = true;
+        if (s.line_len >= 12) s.status = (uint16_t)atoi(s.line + 9);   /* "HTTP/1.1 200" */
+    } else if (s.line_len == 0) {
+        s.in_body = true;
+    } else if (!strncasecmp(s.line, "content-length:", 15)) {
+        s.content_len = atol(s.line + 15);
+    }
+    s.line_len = 0;
+}
+
+/* Returns true once the whole body is in */
+static bool ckb_fo_feed(ckb_fo_slot_t &s, const uint8_t *buf, int n) {
+    int i = 0;
+    while (i < n && !s.in_body) {
+        char ch = (char)buf[i++];
+        if (ch == '\n') ckb_fo_http_line(s);
+        else if (ch != '\r' && s.line_len < sizeof(s.line) - 1) s.line[s.line_len++] = ch;
+    }
+    if (i < n) {
+        uint32_t k = n - i;
+        if (s.body_len + k > CKB_FO_RESP_MAX) {
+            k = CKB_FO_RESP_MAX - s.body_len;
+            s.overflow = true;
+        }
+        memcpy(s.body + s.body_len, buf + i, k);
+        s.body_len += k;
+    }
+    return s.in_body && s.content_len >= 0 && s.body_len >= (uint32_t)s.content_len;
+}
+
+/* ── One call ──────────────────────────────────────────────────── */
+/* Slot s finished; true if its reply is usable */
+static bool ckb_fo_done(ckb_fo_slot_t &s, bool ok, uint32_t now) {
+    uint8_t i = (uint8_t)s.ep;
+    ok = ok && s.status == 200 && s.in_body && !s.overflow;
+    if (ok || s.overflow) ckb_fo_success(i, now - s.t0, now);   /* too big still means it answered */
+    else ckb_fo_failure(i, now);
+    ckb_fo_close(s);
+    return ok;
+}
+
+/* Endpoint to probe alongside this call: a half-open one, or every
+ * CKB_FO_REFRESH_CALLS calls the closed one measured longest ago, so a
+ * node that lost the primary spot to a few slow replies can win it back */
+static int8_t ckb_fo_probe_target(uint32_t now) {
+    ckb_fo_snapshot_t &f = _ckb_fo;
+    int8_t stale = -1;
+    for (uint8_t i = 0; i < f.count; i++) {
+        ckb_fo_info_t &n = f.ep[i];
+        if (n.breaker == CKB_FO_OPEN && (int32_t)(now - _ckb_fo_ep[i].open_until) >= 0)
+            n.breaker = CKB_FO_HALF;
+        if (n.breaker == CKB_FO_HALF && i != f.primary) return (int8_t)i;
+        if (n.breaker == CKB_FO_CLOSED && i != f.primary &&
+            (stale < 0 || (int32_t)(_ckb_fo_ep[i].sampled - _ckb_fo_ep[stale].sampled) < 0))
+            stale = (int8_t)i;
+    }
+    return f.calls % CKB_FO_REFRESH_CALLS == 0 ? stale : -1;
+}
+
+/* A request still in flight when the call ends. Primaries beaten by their
+ * hedge are charged the time taken so far, or their latency would never
+ * show the slowdown; probes that ran out of grace count as a failure when
+ * half-open and as a (lower-bound) sample otherwise. Hedges that lost
+ * were only asked late, so their time says nothing. */
+static void ckb_fo_cut(ckb_fo_slot_t &s, uint32_t now) {
+    if (s.phase == CKB_FO_IDLE) return;
+    uint8_t i = (uint8_t)s.ep;
+    if (s.role == CKB_FO_PROBE && _ckb_fo.ep[i].breaker == CKB_FO_HALF) ckb_fo_failure(i, now);
+    else if (s.role != CKB_FO_HEDGE) ckb_fo_latency(i, now - s.t0, ckb_fo_weight(i, now));
+    ckb_fo_close(s);
+}
+
+/* POST `body` (JSON-RPC) and return the reply body, NUL-terminated, valid
+ * until the next call; null if no endpoint answered */
+static const char *ckb_fo_call(const char *body, uint32_t *len) {
+    ckb_fo_snapshot_t &f = _ckb_fo;
+    if (!f.count || !_ckb_fo_slot[0].body || !_ckb_fo_slot[1].body) return nullptr;
+    size_t blen = strlen(body);
+    uint32_t start = ckb_fo_millis();
+    f.calls++;
+
+    uint8_t p = ckb_fo_pick();
+    int8_t probe = ckb_fo_probe_target(start);
+    uint8_t tried = 1 << p;
+    ckb_fo_slot_t &a = _ckb_fo_slot[0], &b = _ckb_fo_slot[1];
+    if (!ckb_fo_open(a, p, CKB_FO_PRIMARY, blen, start)) ckb_fo_done(a, false, start);
+    if (probe >= 0 && probe != p) {
+        tried |= 1 << probe;
+        if (!ckb_fo_open(b, probe, CKB_FO_PROBE, blen, start)) ckb_fo_done(b, false, start);
+    }
+
+    ckb_fo_slot_t *win = nullptr;
+    uint32_t win_at = 0;
+    bool hedged = false, again = false;
+    static uint8_t buf[1460];
+    for (;;) {
+        uint32_t now = ckb_fo_millis();
+
+        if (win) {
+            /* Answered: a probe still running gets a short grace to finish */
+            if (b.phase == CKB_FO_IDLE || now - win_at >= CKB_FO_PROBE_WAIT_MS) break;
+        } else if (a.phase == CKB_FO_IDLE) {
+            /* Primary failed: move on to the next endpoint, while there's time */
+            int8_t next = now - start < CKB_FO_TIMEOUT_MS ? ckb_fo_best(-1, tried) : -1;
+            if (next < 0 && !again && now - start < CKB_FO_TIMEOUT_MS &&
+                f.ep[p].breaker == CKB_FO_CLOSED) {
+                next = (int8_t)p;               /* nobody else: one more try where it failed */
+                again = true;
+            }
+            if (next >= 0) {
+                tried |= 1 << next;
+                if (!ckb_fo_open(a, next, CKB_FO_RETRY, blen, now)) ckb_fo_done(a, false, now);
+                continue;
+            }
+            if (b.phase == CKB_FO_IDLE) break;
+        } else if (!hedged && a.phase != CKB_FO_IDLE && b.phase == CKB_FO_IDLE) {
+            /* Primary slower than its own p95: same request to the runner-up.
+             * Until the p95 is trustworthy, twice the slowest reply seen. */
+            uint8_t seen = _ckb_fo_ep[a.ep].lat_n;
+            uint32_t after = seen >= CKB_FO_HEDGE_SAMPLES ? f.ep[a.ep].p95_ms
+                           : seen ? f.ep[a.ep].p95_ms * 2 : CKB_FO_TIMEOUT_MS / 4;
+            if (after < CKB_FO_HEDGE_MIN_MS) after = CKB_FO_HEDGE_MIN_MS;
+            if (now - a.t0 >= after) {
+                int8_t h = ckb_fo_best(a.ep, tried);
+                hedged = true;
+                if (h >= 0) {
+                    tried |= 1 << h;
+                    f.hedges++;
+                    if (!ckb_fo_open(b, h, CKB_FO_HEDGE, blen, now)) ckb_fo_done(b, false, now);
+                }
+            }
+        }
+
+        fd_set rd, wr;
+        FD_ZERO(&rd);
+        FD_ZERO(&wr);
+        int maxfd = -1;
+        for (uint8_t k = 0; k < 2; k++) {
+            ckb_fo_slot_t &s = _ckb_fo_slot[k];
+            if (s.phase == CKB_FO_IDLE) continue;
+            if (s.phase == CKB_FO_RECV) FD_SET(s.fd, &rd);
+            else FD_SET(s.fd, &wr);
+            if (s.fd > maxfd) maxfd = s.fd;
+        }
+        if (maxfd < 0) continue;
+        struct timeval tv = { 0, 10 * 1000 };      /* hedge timer resolution */
+        int ready = select(maxfd + 1, &rd, &wr, nullptr, &tv);
+        now = ckb_fo_millis();
+
+        for (uint8_t k = 0; k < 2; k++) {
+            ckb_fo_slot_t &s = _ckb_fo_slot[k];
+            if (s.phase == CKB_FO_IDLE) continue;
+            if (ready > 0 && s.phase == CKB_FO_CONNECT && FD_ISSET(s.fd, &wr)) {
+                int err = 0;
+                socklen_t el = sizeof(err);
+                getsockopt(s.fd, SOL_SOCKET, SO_ERROR, &err, &el);
+                if (err) { ckb_fo_done(s, false, now); continue; }
+                s.phase = CKB_FO_SEND;
+            }
+            if (ready > 0 && s.phase == CKB_FO_SEND && FD_ISSET(s.fd, &wr)) {
+                ckb_fo_send(s, body, blen);
+                if (s.phase == CKB_FO_IDLE) { ckb_fo_done(s, false, now); continue; }
+            }
+            if (ready > 0 && s.phase == CKB_FO_RECV && FD_ISSET(s.fd, &rd)) {
+                int r = recv(s.fd, buf, sizeof(buf), 0);
+                bool fin = false, ok = false;
+                if (r > 0) fin = ok = ckb_fo_feed(s, buf, r);
+                else if (r == 0) { fin = true; ok = s.in_body; }   /* server closed: body complete */
+                else if (errno != EAGAIN && errno != EWOULDBLOCK) fin = true;
+                if (fin) {
+                    uint8_t role = s.role;
+                    uint8_t ep = (uint8_t)s.ep;
+                    if (ckb_fo_done(s, ok, now) && !win) {
+                        f.ep[ep].wins++;
+                        f.last = (int8_t)ep;
+                        if (role == CKB_FO_HEDGE) f.hedge_wins++;
+                        s.body[s.body_len] = '\0';
+                        if (len) *len = s.body_len;
+                        win = &s;
+                        win_at = now;
+                        ckb_fo_slot_t &o = _ckb_fo_slot[k ^ 1];
+                        if (o.role != CKB_FO_PROBE) ckb_fo_cut(o, now);
+                    }
+                    continue;
+                }
+            }
+            if (now - s.t0 > CKB_FO_TIMEOUT_MS) ckb_fo_done(s, false, now);
+        }
+    }
+
+    uint32_t now = ckb_fo_millis();
+    ckb_fo_cut(a, now);
+    ckb_fo_cut(b, now);
+    if (!win) {
+        f.failed++;
+        f.last = -1;
+    }
+    ckb_fo_publish();
+    return win ? win->body : nullptr;
+}
+
+/* ── Readers ───────────────────────────────────────────────────── */
+static void ckb_fo_copy(ckb_fo_snapshot_t *out) {
+    CKB_FO_LOCK();
+    memcpy(out, &_ckb_fo_pub, sizeof(*out));
+    CKB_FO_UNLOCK();
+}
+
+static const char *ckb_fo_breaker_name(uint8_t b) {
+    return b == CKB_FO_CLOSED ? "closed" : b == CKB_FO_OPEN ? "open" : "half-open";
+}
+
+/* Endpoint i of a snapshot as a URL again, for requests that must not be
+ * hedged. Other tasks pass their ckb_fo_copy(); only the calling task may
+ * pass _ckb_fo. */
+static inline const char *ckb_fo_url(const ckb_fo_snapshot_t &s, uint8_t i, char *buf, size_t size) {
+    snprintf(buf, size, "http://%s:%u%s", s.ep[i].host, (unsigned)s.ep[i].port, s.ep[i].path);
+    return buf;
+}
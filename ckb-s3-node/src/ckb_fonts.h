@@ -0,0 +1,200 @@
+/*
+ * ckb_fonts.h — Runtime font registry backed by a memory-mapped font pack
+ * =========================================================================
+ * Fonts live in a dedicated "fonts" data partition (see partitions_fonts.csv)
+ * instead of the app image. The pack is built on the host and flashed once:
+ *
+ *   tools/fontpack.py fonts.bin
+ *   esptool.py --chip esp32s3 write_flash 0x610000 fonts.bin
+ *
+ * At boot the partition is mapped with esp_partition_mmap() — glyph tables
+ * and bitmaps are read straight from flash through the cache, nothing is
+ * copied. Only the small GFXsubfont headers (pointers into the map) live in
+ * RAM. A host build maps the same fonts.bin file with mmap().
+ *
+ * Usage:
+ *   ckb_fonts_mount();                        // once, in setup()
+ *   const GFXsubfont *f = ckb_font("d7m48_num");
+ *   gfx->setFont(f);                          // NULL → built-in 6x8 font
+ *
+ * Pack layout is documented in tools/fontpack.py.
+ */
+
+#pragma once
+
+#if defined(ESP32)
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <esp_partition.h>
+#else
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "gfxfont.h"
+#endif
+
+#ifndef CKB_FONTS_PARTITION_LABEL
+#define CKB_FONTS_PARTITION_LABEL  "fonts"
+#endif
+#ifndef CKB_FONTS_MAX
+#define CKB_FONTS_MAX  16
+#endif
+
+#define CKB_FONTS_MAGIC     "CKBFPK1"
+#define CKB_FONTS_NAME_LEN  16
+#define CKB_FONTS_FLAG_RLE  0x01
+
+/* Pack stores glyphs exactly as GFXglyph is laid out in RAM */
+static_assert(sizeof(GFXglyph) == 8, "font pack expects 8-byte GFXglyph");
+
+/* ── On-flash structures ───────────────────────────────────────── */
+struct ckb_fontpack_hdr_t {
+    char     magic[8];
+    uint16_t count;
+    uint16_t reserved;
+    uint32_t size;
+};
+
+struct ckb_fontpack_entry_t {
+    char     name[CKB_FONTS_NAME_LEN];
+    uint32_t glyphs;       /* offsets from start of pack */
+    uint32_t bitmap;
+    uint32_t remap;        /* 0 = dense font, no remap table */
+    uint8_t  first;
+    uint8_t  last;
+    uint8_t  y_advance;
+    uint8_t  flags;
+};
+
+/* ── Registry ──────────────────────────────────────────────────── */
+struct ckb_font_t {
+    char       name[CKB_FONTS_NAME_LEN + 1];
+    GFXsubfont font;
+};
+
+static ckb_font_t     _ckb_fonts[CKB_FONTS_MAX];
+static uint8_t        _ckb_font_count = 0;
+static const uint8_t *_ckb_fonts_base = nullptr;
+
+/* [off, off + n) lies inside a pack of `size` bytes, without overflow */
+static bool ckb_fonts_fits(uint32_t size, uint32_t off, uint64_t n) {
+    return off <= size && n <= size - off;
+}
+
+/* One entry reads nothing outside the pack: remap table, every glyph it
+ * can reach, and every glyph's bitmap (for RLE, the runs that cover its
+ * box). Returns the number of glyphs, 0 when the entry is unusable. */
+static uint16_t ckb_fonts_check(const uint8_t *base, uint32_t size, const ckb_fontpack_entry_t *e) {
+    if (e->last < e->first || (e->glyphs & 1) || e->bitmap > size) return 0;
+    uint16_t span = (uint16_t)(e->last - e->first + 1), n = span;
+    if (e->remap) {
+        if (!ckb_fonts_fits(size, e->remap, span)) return 0;
+        n = 0;
+        for (uint16_t i = 0; i < span; i++) {
+            uint8_t g = base[e->remap + i];
+            if (g != GFX_SUBFONT_MISSING && g >= n) n = (uint16_t)(g + 1);
+        }
+        if (!n) return 0;
+    }
+    if (!ckb_fonts_fits(size, e->glyphs, (uint64_t)n * sizeof(GFXglyph))) return 0;
+
+    const GFXglyph *glyph = (const GFXglyph *)(base + e->glyphs);
+    uint32_t avail = size - e->bitmap;
+    for (uint16_t i = 0; i < n; i++) {
+        uint32_t off = glyph[i].bitmapOffset, pixels = (uint32_t)glyph[i].width * glyph[i].height;
+        if (!(e->flags & CKB_FONTS_FLAG_RLE)) {
+            if (!ckb_fonts_fits(avail, off, (pixels + 7) / 8)) return 0;
+            continue;
+        }
+        const uint8_t *run = base + e->bitmap;
+        for (uint32_t done = 0; done < pixels; done += run[off++])
+            if (off >= avail) return 0;
+    }
+    return n;
+}
+
+/* Validate the mapped pack and build the RAM font headers. Entries that
+ * would read past the pack are skipped. */
+static bool ckb_fonts_index(const uint8_t *base, size_t len) {
+    const ckb_fontpack_hdr_t *hdr = (const ckb_fontpack_hdr_t *)base;
+    if (len < sizeof(*hdr) || memcmp(hdr->magic, CKB_FONTS_MAGIC, 8) != 0) return false;
+    if (hdr->size > len) return false;
+    if (!ckb_fonts_fits(hdr->size, sizeof(*hdr), (uint64_t)hdr->count * sizeof(ckb_fontpack_entry_t)))
+        return false;
+
+    const ckb_fontpack_entry_t *e = (const ckb_fontpack_entry_t *)(base + sizeof(*hdr));
+    _ckb_font_count = 0;
+    for (uint16_t i = 0; i < hdr->count && _ckb_font_count < CKB_FONTS_MAX; i++, e++) {
+        if (!ckb_fonts_check(base, hdr->size, e)) continue;
+        ckb_font_t &f = _ckb_fonts[_ckb_font_count++];
+        memcpy(f.name, e->name, CKB_FONTS_NAME_LEN);
+        f.name[CKB_FONTS_NAME_LEN] = '\0';
+        f.font.font.bitmap   = (uint8_t *)(base + e->bitmap);
+        f.font.font.glyph    = (GFXglyph *)(base + e->glyphs);
+        f.font.font.first    = e->first;
+        f.font.font.last     = e->last;
+        f.font.font.yAdvance = e->y_advance;
+        f.font.remap = e->remap ? (uint8_t *)(base + e->remap) : nullptr;
+        f.font.rle   = (e->flags & CKB_FONTS_FLAG_RLE) != 0;
+    }
+    _ckb_fonts_base = base;
+    return true;
+}
+
+#if defined(ESP32)
+/* ── Mount: map the "fonts" partition (call once in setup()) ───── */
+static bool ckb_fonts_mount(const char *label = CKB_FONTS_PARTITION_LABEL) {
+    if (_ckb_fonts_base) return true;
+    const esp_partition_t *part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!part) {
+        Serial.printf("[fonts] no '%s' partition\n", label);
+        return false;
+    }
+    const void *map = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &map, &handle) != ESP_OK) {
+        Serial.println("[fonts] mmap failed");
+        return false;
+    }
+    if (!ckb_fonts_index((const uint8_t *)map, part->size)) {
+        spi_flash_munmap(handle);
+        Serial.println("[fonts] partition holds no font pack — flash fonts.bin");
+        return false;
+    }
+    Serial.printf("[fonts] %u fonts mapped from '%s'\n", (unsigned)_ckb_font_count, label);
+    return true;
+}
+#else
+/* ── Mount (host): map a fonts.bin file read-only ──────────────── */
+static bool ckb_fonts_mount(const char *path) {
+    if (_ckb_fonts_base) return true;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) { close(fd); return false; }
+    void *map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+    if (!ckb_fonts_index((const uint8_t *)map, (size_t)st.st_size)) {
+        munmap(map, (size_t)st.st_size);
+        return false;
+    }
+    return true;
+}
+#endif
+
+/* ── Lookup by name — resolve once and keep the pointer ────────── */
+static const GFXsubfont *ckb_font(const char *name) {
+    for (uint8_t i = 0; i < _ckb_font_count; i++)
+        if (strcmp(_ckb_fonts[i].name, name) == 0) return &_ckb_fonts[i].font;
+    return nullptr;
+}
+
+static uint8_t ckb_fonts_count() {
+    return _ckb_font_count;
+}
@@ -0,0 +1,70 @@
+/*
+ * ckb_gauge.h — Incremental ring gauges
+ * =====================================
+ * A ring gauge remembers the sweep it last painted. Moving from 66% to 67%
+ * fills only the 3.6° wedge in between (or paints it back to the track
+ * colour when the value drops) instead of redrawing the whole ring.
+ * Rasterising goes through Arduino_GFX::fillRingSector() — fixed point,
+ * horizontal spans, no float trig.
+ *
+ * Usage:
+ *   static ckb_gauge_t g = ckb_gauge(400, 420, 32, 24, COL_ACCENT, COL_DIVIDER);
+ *   ckb_gauge_set(gfx, g, idx, len);    // every poll, or every second: cheap when nothing moved
+ *   ckb_gauge_invalidate(g);            // after the area under it was cleared
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+
+#define CKB_GAUGE_TOP  ARC_ANGLE(270)   /* 12 o'clock */
+
+struct ckb_gauge_t {
+    int16_t  x, y;
+    int16_t  r_out, r_in;
+    uint16_t start;     /* binary angle, 65536 per turn, clockwise from 3 o'clock */
+    uint16_t fg, bg;    /* filled / track colour */
+    uint32_t sweep;     /* sweep currently on screen */
+    bool     drawn;
+};
+
+static ckb_gauge_t ckb_gauge(int16_t x, int16_t y, int16_t r_out, int16_t r_in,
+                             uint16_t fg, uint16_t bg, uint16_t start = CKB_GAUGE_TOP) {
+    ckb_gauge_t g = { x, y, r_out, r_in, start, fg, bg, 0, false };
+    return g;
+}
+
+/* Force a full repaint on the next ckb_gauge_set() */
+static void ckb_gauge_invalidate(ckb_gauge_t &g) {
+    g.drawn = false;
+}
+
+/* Change the colours; the next set repaints the whole ring */
+static void ckb_gauge_colors(ckb_gauge_t &g, uint16_t fg, uint16_t bg) {
+    if (g.fg == fg && g.bg == bg) return;
+    g.fg = fg;
+    g.bg = bg;
+    g.drawn = false;
+}
+
+/* Show value/max; paints only the wedge that changed since the last call */
+static void ckb_gauge_set(Arduino_GFX *gfx, ckb_gauge_t &g, uint32_t value, uint32_t max) {
+    uint32_t sweep = 0;
+    if (max > 0)
+        sweep = (uint32_t)((uint64_t)(value < max ? value : max) * ARC_FULL / max);
+
+    if (!g.drawn) {
+        gfx->fillRingSector(g.x, g.y, g.r_out, g.r_in, g.start, sweep, g.fg);
+        gfx->fillRingSector(g.x, g.y, g.r_out, g.r_in, (uint16_t)(g.start + sweep),
+                            ARC_FULL - sweep, g.bg);
+        g.drawn = true;
+    } else if (sweep > g.sweep) {
+        gfx->fillRingSector(g.x, g.y, g.r_out, g.r_in, (uint16_t)(g.start + g.sweep),
+                            sweep - g.sweep, g.fg);
+    } else if (sweep < g.sweep) {
+        gfx->fillRingSector(g.x, g.y, g.r_out, g.r_in, (uint16_t)(g.start + sweep),
+                            g.sweep - sweep, g.bg);
+    }
+    g.sweep = sweep;
+}
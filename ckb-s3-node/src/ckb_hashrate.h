@@ -0,0 +1,155 @@
+/*
+ * ckb_hashrate.h — Network difficulty and hashrate estimate
+ * =========================================================
+ * Follows the header cache (ckb_headers.h) block by block. Each new header
+ * costs O(1): its compact_target is decoded to a difficulty, and the gap
+ * to its parent's timestamp goes into a ring of the last CKB_HR_WINDOW
+ * block intervals. Running sums over the ring give the window estimate,
+ * and two EMAs (work and interval) give a smoother one.
+ *
+ *   difficulty  2^256 / target          (expected hashes per block)
+ *   hashrate    Σ difficulty / Σ interval over the window
+ *   ema         EMA(difficulty) / EMA(interval), α = 2 / (CKB_HR_EMA_BLOCKS + 1)
+ *
+ * Taking the ratio of two EMAs rather than an EMA of difficulty / interval
+ * keeps one fast block (interval near 0) from spiking the estimate.
+ *
+ * History comes from the cache, so nothing is fetched twice: at boot
+ * ckb_hdr_prefill() loads the last CKB_HDR_PREFILL headers in one batched
+ * request and the first ckb_hr_sync() walks them all. A reorg replaces
+ * at most a few headers the window has already counted; they are not
+ * un-counted, since the replacements carry the same target and similar
+ * timestamps, and they age out of the window anyway.
+ *
+ * Usage:
+ *   ckb_hdr_tip(tip, fetch_headers);
+ *   ckb_hr_sync();                       // after every cache update
+ *   if (ckb_hr_ready()) ckb_hr_hashrate(), ckb_hr_ema(), _ckb_hr.difficulty
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "ckb_headers.h"
+
+#ifndef CKB_HR_WINDOW
+#define CKB_HR_WINDOW      64      /* block intervals kept in the ring */
+#endif
+#ifndef CKB_HR_EMA_BLOCKS
+#define CKB_HR_EMA_BLOCKS  32
+#endif
+
+struct ckb_hr_t {
+    uint32_t interval[CKB_HR_WINDOW];  /* ms from parent to block */
+    double   work[CKB_HR_WINDOW];      /* difficulty of that block */
+    uint16_t head;                     /* next slot to write */
+    uint16_t fill;
+    uint64_t sum_interval;             /* ms, exact */
+    double   sum_work;                 /* re-summed on each ring wrap */
+    double   ema_work, ema_interval;
+    uint64_t last_number;              /* last block pushed */
+    uint64_t last_ts;
+    bool     have_last;
+    uint32_t compact;                  /* latest compact_target */
+    double   difficulty;               /* latest */
+    uint32_t blocks;                   /* headers pushed */
+    uint32_t gaps;                     /* discontinuities (window restarted its chain) */
+};
+
+static ckb_hr_t _ckb_hr = {};
+
+/* 2^256 / (mantissa · 256^(exponent − 3)) */
+static double ckb_hr_difficulty(uint32_t compact) {
+    uint32_t exp = compact >> 24, mant = compact & 0x00FFFFFF;
+    if (!mant || exp > 32) return 0;
+    return ldexp(1.0 / mant, 256 - 8 * ((int)exp - 3));
+}
+
+/* One header in chain order; anything but number == last + 1 starts a
+ * new run without adding an interval */
+static void ckb_hr_push(uint64_t number, uint64_t timestamp_ms, uint32_t compact) {
+    ckb_hr_t &r = _ckb_hr;
+    double d = ckb_hr_difficulty(compact);
+    r.compact = compact;
+    r.difficulty = d;
+    r.blocks++;
+
+    if (r.have_last && number == r.last_number + 1) {
+        /* Timestamps only have to beat the median of the past 37 blocks,
+         * so a child can be stamped before its parent */
+        uint32_t dt = timestamp_ms > r.last_ts ? (uint32_t)(timestamp_ms - r.last_ts) : 0;
+        if (r.fill == CKB_HR_WINDOW) {
+            r.sum_interval -= r.interval[r.head];
+            r.sum_work     -= r.work[r.head];
+        } else {
+            r.fill++;
+        }
+        r.interval[r.head] = dt;
+        r.work[r.head] = d;
+        r.sum_interval += dt;
+        r.sum_work     += d;
+        r.head = (uint16_t)((r.head + 1) % CKB_HR_WINDOW);
+        if (r.head == 0) {                  /* O(N) once per N blocks */
+            r.sum_work = 0;
+            for (uint16_t i = 0; i < r.fill; i++) r.sum_work += r.work[i];
+        }
+
+        const double a = 2.0 / (CKB_HR_EMA_BLOCKS + 1);
+        if (r.fill == 1) {
+            r.ema_work = d;
+            r.ema_interval = dt;
+        } else {
+            r.ema_work     += a * (d - r.ema_work);
+            r.ema_interval += a * ((double)dt - r.ema_interval);
+        }
+    } else if (r.have_last) {
+        r.gaps++;
+    }
+    r.last_number = number;
+    r.last_ts = timestamp_ms;
+    r.have_last = true;
+}
+
+/* Push every cached header newer than the last one seen */
+static void ckb_hr_sync() {
+    const ckb_hdr_cache_t &c = _ckb_hdr;
+    if (!c.count) return;
+    uint64_t n = _ckb_hr.have_last && _ckb_hr.last_number + 1 > c.lo ? _ckb_hr.last_number + 1 : c.lo;
+    for (; n <= c.hi; n++) {
+        const ckb_hdr_t *h = ckb_hdr_by_number(n);
+        ckb_hr_push(h->number, h->timestamp, h->compact_target);
+    }
+}
+
+static bool ckb_hr_ready() {
+    return _ckb_hr.sum_interval > 0;
+}
+
+/* Mean block interval over the window, seconds */
+static double ckb_hr_block_time() {
+    return _ckb_hr.fill ? _ckb_hr.sum_interval / 1000.0 / _ckb_hr.fill : 0;
+}
+
+/* Window estimate, hashes/s */
+static double ckb_hr_hashrate() {
+    return _ckb_hr.sum_interval ? _ckb_hr.sum_work * 1000.0 / _ckb_hr.sum_interval : 0;
+}
+
+/* EMA estimate, hashes/s */
+static double ckb_hr_ema() {
+    return _ckb_hr.ema_interval > 0 ? _ckb_hr.ema_work * 1000.0 / _ckb_hr.ema_interval : 0;
+}
+
+/* "612", "61.2" or "6.12" plus an SI prefix ("", "K" … "E"); 3 significant digits */
+static char ckb_hr_si(double v, char *buf, size_t size) {
+    static const char prefix[] = " KMGTPEZ";
+    uint8_t i = 0;
+    while (v >= 999.5 && i < sizeof(prefix) - 2) {
+        v /= 1000;
+        i++;
+    }
+    snprintf(buf, size, v < 9.995 ? "%.2f" : v < 99.95 ? "%.1f" : "%.0f", v);
+    return prefix[i];
+}
@@ -0,0 +1,395 @@
+/*
+ * ckb_headers.h — Header chain cache with reorg detection
+ * =======================================================
+ * Keeps the last CKB_HDR_CAP headers (hash, parent, number, timestamp,
+ * compact_target, epoch) in a PSRAM ring indexed by block number, so a
+ * lookup by number is a single slot read. A small open-addressing table in
+ * internal RAM maps the first 4 bytes of a hash to its slot.
+ *
+ * The cached range [lo, hi] is always one linked chain. A new tip that
+ * does not extend it is resolved against the node with batched
+ * get_header_by_number calls (the caller supplies the fetch):
+ *   - walk back from the tip a batch at a time until a fetched hash
+ *     matches the cache: everything above that fork point was reorged
+ *     out, and the number of orphaned headers is the reorg depth;
+ *   - fill the gap from the fork point up to the tip in ascending batches,
+ *     checking every parent link on the way.
+ * A fetch failure leaves the cache as it was and the next poll retries.
+ * Gaps wider than CKB_HDR_BACKFILL_MAX restart the cache at the tip
+ * instead of stalling the poll loop.
+ *
+ * Usage:
+ *   ckb_hdr_begin();                                // once, allocates the ring
+ *   ckb_hdr_t tip;
+ *   ckb_hdr_parse(json, json_end, tip);             // from get_tip_header
+ *   ckb_hdr_prefill(tip.number, fetch_headers);     // at boot: one batch
+ *   int depth = ckb_hdr_tip(tip, fetch_headers);    // per poll; >0 = reorg
+ *   const ckb_hdr_t *h = ckb_hdr_by_number(n);
+ *   _ckb_hdr.reorgs, _ckb_hdr.last_depth            // UI, /metrics
+ *
+ *   fetch_headers(from, count, out) posts ckb_hdr_batch_body() and hands
+ *   the reply to ckb_hdr_parse_batch().
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP32)
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#endif
+
+#ifndef CKB_HDR_CAP
+#define CKB_HDR_CAP           4096    /* power of two, 96 B each → 384 KB */
+#endif
+#define CKB_HDR_IDX           (CKB_HDR_CAP * 2)   /* hash index slots, ≤ 50% full */
+#define CKB_HDR_BATCH         16      /* headers per get_header_by_number batch */
+#ifndef CKB_HDR_PREFILL
+#define CKB_HDR_PREFILL       64      /* headers fetched at boot, one request (≤ 64) */
+#endif
+#ifndef CKB_HDR_BACKFILL_MAX
+#define CKB_HDR_BACKFILL_MAX  512     /* longest gap or reorg walk per poll */
+#endif
+
+struct ckb_hdr_t {
+    uint8_t  hash[32];
+    uint8_t  parent[32];
+    uint64_t number;
+    uint64_t timestamp;       /* ms */
+    uint64_t epoch;           /* packed: number | index << 24 | length << 40 */
+    uint32_t compact_target;
+};
+
+/* Returns how many consecutive headers from `from` it wrote to out[] */
+typedef uint16_t (*ckb_hdr_fetch_t)(uint64_t from, uint16_t count, ckb_hdr_t *out);
+
+struct ckb_hdr_cache_t {
+    ckb_hdr_t *ring;
+    uint16_t  *idx;           /* slot + 1, 0 = empty */
+    uint64_t   lo, hi;        /* cached range, valid when count > 0 */
+    uint32_t   count;
+    uint32_t   reorgs;
+    uint32_t   last_depth;    /* headers orphaned by the last reorg */
+    uint32_t   max_depth;
+    uint64_t   last_fork;     /* highest block both chains share */
+    uint32_t   deep;          /* reorgs deeper than the walk could reach */
+    uint32_t   backfilled;    /* headers fetched to fill gaps */
+    uint32_t   fetches;       /* batch requests made */
+    uint32_t   resets;
+};
+
+static ckb_hdr_cache_t _ckb_hdr = {};
+
+/* ── Setup ─────────────────────────────────────────────────────── */
+static inline bool ckb_hdr_begin() {
+    ckb_hdr_cache_t &c = _ckb_hdr;
+    if (c.ring) return true;
+#if defined(ESP32)
+    c.ring = (ckb_hdr_t *)heap_caps_malloc(sizeof(ckb_hdr_t) * CKB_HDR_CAP, MALLOC_CAP_SPIRAM);
+    c.idx  = (uint16_t *)heap_caps_malloc(sizeof(uint16_t) * CKB_HDR_IDX, MALLOC_CAP_INTERNAL);
+#else
+    c.ring = (ckb_hdr_t *)malloc(sizeof(ckb_hdr_t) * CKB_HDR_CAP);
+    c.idx  = (uint16_t *)malloc(sizeof(uint16_t) * CKB_HDR_IDX);
+#endif
+    if (!c.ring || !c.idx) {
+        free(c.ring);
+        free(c.idx);
+        c.ring = nullptr;
+        c.idx = nullptr;
+        return false;
+    }
+    memset(c.idx, 0, sizeof(uint16_t) * CKB_HDR_IDX);
+    c.count = 0;
+    return true;
+}
+
+/* ── Hash index (linear probing, backward-shift delete) ────────── */
+static inline uint32_t ckb_hdr_key(const uint8_t *hash) {
+    return (hash[0] | hash[1] << 8 | hash[2] << 16 | (uint32_t)hash[3] << 24) & (CKB_HDR_IDX - 1);
+}
+
+static void ckb_hdr_idx_insert(uint32_t slot) {
+    uint16_t *idx = _ckb_hdr.idx;
+    uint32_t i = ckb_hdr_key(_ckb_hdr.ring[slot].hash);
+    while (idx[i]) i = (i + 1) & (CKB_HDR_IDX - 1);
+    idx[i] = (uint16_t)(slot + 1);
+}
+
+static void ckb_hdr_idx_remove(uint32_t slot) {
+    uint16_t *idx = _ckb_hdr.idx;
+    const ckb_hdr_t *ring = _ckb_hdr.ring;
+    uint32_t p = ckb_hdr_key(ring[slot].hash);
+    while (idx[p] && idx[p] != slot + 1) p = (p + 1) & (CKB_HDR_IDX - 1);
+    if (!idx[p]) return;
+    idx[p] = 0;
+    /* Pull later entries of the probe run back over the hole */
+    for (uint32_t j = (p + 1) & (CKB_HDR_IDX - 1); idx[j]; j = (j + 1) & (CKB_HDR_IDX - 1)) {
+        uint32_t k = ckb_hdr_key(ring[idx[j] - 1].hash);
+        bool stays = (p <= j) ? (p < k && k <= j) : (p < k || k <= j);
+        if (stays) continue;
+        idx[p] = idx[j];
+        idx[j] = 0;
+        p = j;
+    }
+}
+
+/* ── Lookup ────────────────────────────────────────────────────── */
+static const ckb_hdr_t *ckb_hdr_by_number(uint64_t n) {
+    const ckb_hdr_cache_t &c = _ckb_hdr;
+    if (!c.count || n < c.lo || n > c.hi) return nullptr;
+    return &c.ring[n & (CKB_HDR_CAP - 1)];
+}
+
+static inline const ckb_hdr_t *ckb_hdr_by_hash(const uint8_t *hash) {
+    const ckb_hdr_cache_t &c = _ckb_hdr;
+    if (!c.count) return nullptr;
+    for (uint32_t i = ckb_hdr_key(hash); c.idx[i]; i = (i + 1) & (CKB_HDR_IDX - 1)) {
+        const ckb_hdr_t *h = &c.ring[c.idx[i] - 1];
+        if (!memcmp(h->hash, hash, 32)) return h;
+    }
+    return nullptr;
+}
+
+static const ckb_hdr_t *ckb_hdr_latest() {
+    return ckb_hdr_by_number(_ckb_hdr.hi);
+}
+
+/* ── Ring edits ────────────────────────────────────────────────── */
+static void ckb_hdr_clear() {
+    memset(_ckb_hdr.idx, 0, sizeof(uint16_t) * CKB_HDR_IDX);
+    _ckb_hdr.count = 0;
+}
+
+/* h must be hi + 1 (or anything when empty); evicts lo when full */
+static void ckb_hdr_append(const ckb_hdr_t &h) {
+    ckb_hdr_cache_t &c = _ckb_hdr;
+    if (!c.count) {
+        c.lo = c.hi = h.number;
+    } else {
+        if (c.count == CKB_HDR_CAP) {
+            ckb_hdr_idx_remove(c.lo & (CKB_HDR_CAP - 1));
+            c.lo++;
+            c.count--;
+        }
+        c.hi = h.number;
+    }
+    uint32_t slot = h.number & (CKB_HDR_CAP - 1);
+    c.ring[slot] = h;
+    ckb_hdr_idx_insert(slot);
+    c.count++;
+}
+
+/* Drop everything above n */
+static void ckb_hdr_truncate(uint64_t n) {
+    ckb_hdr_cache_t &c = _ckb_hdr;
+    while (c.count && c.hi > n) {
+        ckb_hdr_idx_remove(c.hi & (CKB_HDR_CAP - 1));
+        c.count--;
+        if (c.count) c.hi--;
+    }
+}
+
+static bool ckb_hdr_links(const ckb_hdr_t &h) {
+    const ckb_hdr_t *top = ckb_hdr_latest();
+    return top && h.number == top->number + 1 && !memcmp(h.parent, top->hash, 32);
+}
+
+/* ── New tip ───────────────────────────────────────────────────── */
+/* Returns the reorg depth (0 = none), or -1 if a fetch failed */
+static inline int ckb_hdr_tip(const ckb_hdr_t &t, ckb_hdr_fetch_t fetch) {
+    ckb_hdr_cache_t &c = _ckb_hdr;
+    if (!c.ring) return 0;
+    if (!c.count) {
+        ckb_hdr_append(t);
+        return 0;
+    }
+    const ckb_hdr_t *same = ckb_hdr_by_number(t.number);
+    if (same && !memcmp(same->hash, t.hash, 32)) return 0;     /* seen it */
+    if (ckb_hdr_links(t)) {
+        ckb_hdr_append(t);
+        return 0;
+    }
+
+    static ckb_hdr_t batch[CKB_HDR_BATCH];
+
+    /* Find the fork point: highest cached block still on the node's chain */
+    uint64_t fork = 0;
+    bool found = false;
+    const ckb_hdr_t *below = t.number ? ckb_hdr_by_number(t.number - 1) : nullptr;
+    if (below && !memcmp(below->hash, t.parent, 32)) {
+        fork = t.number - 1;
+        found = true;
+    } else if (t.number) {
+        uint64_t n = t.number - 1 < c.hi ? t.number - 1 : c.hi;
+        uint32_t walked = 0;
+        while (!found && n >= c.lo && walked < CKB_HDR_BACKFILL_MAX) {
+            uint64_t from = n + 1 - CKB_HDR_BATCH > n ? 0 : n + 1 - CKB_HDR_BATCH;
+            if (from < c.lo) from = c.lo;
+            uint16_t cnt = (uint16_t)(n - from + 1);
+            c.fetches++;
+            if (fetch(from, cnt, batch) < cnt) return -1;
+            for (int i = cnt - 1; i >= 0; i--) {
+                if (!memcmp(batch[i].hash, c.ring[(from + i) & (CKB_HDR_CAP - 1)].hash, 32)) {
+                    fork = from + i;
+                    found = true;
+                    break;
+                }
+            }
+            walked += cnt;
+            if (from == 0) break;
+            n = from - 1;
+        }
+    }
+
+    int depth = 0;
+    if (!found) {
+        /* Nothing in reach matches: the whole cached chain is gone */
+        depth = (int)(c.hi - c.lo + 1);
+        c.reorgs++;
+        c.deep++;
+        c.last_depth = depth;
+        if ((uint32_t)depth > c.max_depth) c.max_depth = depth;
+        c.last_fork = c.lo ? c.lo - 1 : 0;
+        c.resets++;
+        ckb_hdr_clear();
+        ckb_hdr_append(t);
+        return depth;
+    }
+    if (fork < c.hi) {
+        depth = (int)(c.hi - fork);
+        c.reorgs++;
+        c.last_depth = depth;
+        if ((uint32_t)depth > c.max_depth) c.max_depth = depth;
+        c.last_fork = fork;
+        ckb_hdr_truncate(fork);
+    }
+
+    /* Fill the gap up to the tip */
+    if (t.number - 1 - c.hi > CKB_HDR_BACKFILL_MAX) {
+        c.resets++;
+        ckb_hdr_clear();
+        ckb_hdr_append(t);
+        return depth;
+    }
+    for (uint64_t n = c.hi + 1; n < t.number; ) {
+        uint16_t cnt = t.number - n < CKB_HDR_BATCH ? (uint16_t)(t.number - n) : CKB_HDR_BATCH;
+        c.fetches++;
+        uint16_t got = fetch(n, cnt, batch);
+        for (uint16_t i = 0; i < got; i++) {
+            if (!ckb_hdr_links(batch[i])) return depth;     /* moved under us: next poll */
+            ckb_hdr_append(batch[i]);
+            c.backfilled++;
+        }
+        if (got < cnt) return depth ? depth : -1;
+        n += cnt;
+    }
+    if (ckb_hdr_links(t)) ckb_hdr_append(t);
+    return depth;
+}
+
+/* Seed an empty cache with the CKB_HDR_PREFILL headers ending at `tip` in
+ * one batched request, so consumers have history from the first poll.
+ * Returns how many were cached. */
+static inline uint16_t ckb_hdr_prefill(uint64_t tip, ckb_hdr_fetch_t fetch) {
+    ckb_hdr_cache_t &c = _ckb_hdr;
+    if (!c.ring || c.count) return 0;
+    static ckb_hdr_t batch[CKB_HDR_PREFILL];
+    uint64_t from = tip + 1 > CKB_HDR_PREFILL ? tip + 1 - CKB_HDR_PREFILL : 0;
+    uint16_t cnt = (uint16_t)(tip - from + 1);
+    c.fetches++;
+    uint16_t got = fetch(from, cnt, batch);
+    for (uint16_t i = 0; i < got; i++) {
+        if (c.count && !ckb_hdr_links(batch[i])) ckb_hdr_clear();
+        ckb_hdr_append(batch[i]);
+    }
+    c.backfilled += got;
+    return (uint16_t)c.count;
+}
+
+/* ── JSON ──────────────────────────────────────────────────────── */
+/* Value of "key":"0x…" inside [p, end), or null */
+static const char *ckb_hdr_field(const char *p, const char *end, const char *key) {
+    char pat[24];
+    int n = snprintf(pat, sizeof(pat), "\"%s\":\"0x", key);
+    for (const char *q = p; q + n <= end; q++) {
+        q = (const char *)memchr(q, '"', end - q);
+        if (!q || q + n > end) return nullptr;
+        if (!memcmp(q, pat, n)) return q + n;
+    }
+    return nullptr;
+}
+
+static int ckb_hdr_nibble(char ch) {
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
+static bool ckb_hdr_hex32(const char *p, uint8_t *out) {
+    if (!p) return false;
+    for (int i = 0; i < 32; i++) {
+        int hi = ckb_hdr_nibble(p[2 * i]), lo = ckb_hdr_nibble(p[2 * i + 1]);
+        if (hi < 0 || lo < 0) return false;
+        out[i] = (uint8_t)(hi << 4 | lo);
+    }
+    return true;
+}
+
+static uint64_t ckb_hdr_hex64(const char *p) {
+    return p ? strtoull(p, nullptr, 16) : 0;
+}
+
+/* One header object: the text between its braces */
+static bool ckb_hdr_parse(const char *p, const char *end, ckb_hdr_t &h) {
+    const char *num = ckb_hdr_field(p, end, "number");
+    if (!num) return false;
+    if (!ckb_hdr_hex32(ckb_hdr_field(p, end, "hash"), h.hash)) return false;
+    if (!ckb_hdr_hex32(ckb_hdr_field(p, end, "parent_hash"), h.parent)) return false;
+    h.number         = ckb_hdr_hex64(num);
+    h.timestamp      = ckb_hdr_hex64(ckb_hdr_field(p, end, "timestamp"));
+    h.epoch          = ckb_hdr_hex64(ckb_hdr_field(p, end, "epoch"));
+    h.compact_target = (uint32_t)ckb_hdr_hex64(ckb_hdr_field(p, end, "compact_target"));
+    return true;
+}
+
+/* JSON-RPC batch of get_header_by_number for [from, from + count) */
+static inline size_t ckb_hdr_batch_body(char *buf, size_t size, uint64_t from, uint16_t count) {
+    size_t n = 0;
+    buf[n++] = '[';
+    for (uint16_t i = 0; i < count && n < size; i++)
+        n += snprintf(buf + n, size - n,
+            "%s{\"jsonrpc\":\"2.0\",\"method\":\"get_header_by_number\","
+            "\"params\":[\"0x%llx\"],\"id\":%u}",
+            i ? "," : "", (unsigned long long)(from + i), (unsigned)i);
+    if (n + 2 > size) return 0;
+    buf[n++] = ']';
+    buf[n] = '\0';
+    return n;
+}
+
+/* Headers from a batch reply, placed by number; returns the length of the
+ * run starting at `from` (replies may arrive in any order, null results
+ * end the run) */
+static inline uint16_t ckb_hdr_parse_batch(const char *json, uint64_t from, uint16_t count, ckb_hdr_t *out) {
+    uint64_t have = 0;                              /* bit i: out[i] filled */
+    const char *end = json + strlen(json);
+    for (const char *p = strstr(json, "\"result\":{"); p; p = strstr(p, "\"result\":{")) {
+        p += 10;
+        const char *close = (const char *)memchr(p, '}', end - p);   /* headers are flat */
+        if (!close) break;
+        ckb_hdr_t h;
+        if (ckb_hdr_parse(p, close, h) && h.number >= from && h.number < from + count) {
+            out[h.number - from] = h;
+            have |= 1ULL << (h.number - from);
+        }
+        p = close;
+    }
+    uint16_t run = 0;
+    while (run < count && (have >> run & 1)) run++;
+    return run;
+}
@@ -0,0 +1,632 @@
+/*
+ * ckb_multinode.h — Poll several CKB RPC endpoints at once
+ * ========================================================
+ * One task multiplexes non-blocking sockets over select(). Each cycle it
+ * connects to every endpoint at the same time and sends one JSON-RPC batch
+ * (get_tip_header + local_node_info), so a cycle costs the round trip of
+ * the slowest node, not the sum. Replies are scanned as they stream in and
+ * only the few fields needed are kept; a node with 40 peers and a long
+ * protocol list costs the same memory as an idle one.
+ *
+ * Per node:    tip number/hash/parent, block timestamp, peer count,
+ *              RPC latency (EWMA), lag behind the best tip
+ * Across them: fork alarm when two nodes report different hashes for the
+ *              same height, or a parent that doesn't link to another
+ *              node's tip, for CKB_MN_FORK_CYCLES cycles in a row; lag
+ *              alarm past CKB_MN_LAG_BLOCKS; down alarm after two failed
+ *              polls.
+ *
+ * Plain http:// only. Host names are resolved by the poller task between
+ * cycles, never while sockets are in flight, so a slow DNS server delays
+ * the next cycle start but never stalls the nodes already being polled.
+ * A name that fails is retried every CKB_MN_RESOLVE_RETRY_MS; until then
+ * its node counts as down. Needs one lwIP socket per node on top of the
+ * HTTP server's.
+ *
+ * Usage:
+ *   ckb_mn_add_list("a=http://10.0.0.2:8114, b=http://10.0.0.3:9000");
+ *   ckb_mn_start();                      // poller task on core 0
+ *   static ckb_mn_snapshot_t snap;
+ *   if (ckb_mn_snapshot(&snap)) redraw(snap);   // true once per finished cycle
+ *   ckb_mn_copy(&snap);                  // latest, for /nodes
+ *   ckb_mn_set_list("a=...");            // replace the list while running
+ */
+
+#pragma once
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(ESP32)
+#include <Arduino.h>
+#include <lwip/sockets.h>
+#include <lwip/netdb.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <time.h>
+#endif
+
+#ifndef CKB_MN_MAX_NODES
+#define CKB_MN_MAX_NODES    8
+#endif
+#ifndef CKB_MN_POLL_MS
+#define CKB_MN_POLL_MS      3000    /* cycle start to cycle start */
+#endif
+#ifndef CKB_MN_TIMEOUT_MS
+#define CKB_MN_TIMEOUT_MS   2500    /* per request, connect to last byte */
+#endif
+#ifndef CKB_MN_LAG_BLOCKS
+#define CKB_MN_LAG_BLOCKS   3       /* more than this behind the best tip alarms */
+#endif
+#ifndef CKB_MN_FORK_CYCLES
+#define CKB_MN_FORK_CYCLES  2       /* short-lived forks (orphans) don't alarm */
+#endif
+
+#ifndef CKB_MN_RESOLVE_RETRY_MS
+#define CKB_MN_RESOLVE_RETRY_MS 30000 /* after a failed name lookup */
+#endif
+
+#define CKB_MN_ALARM_LAG    0x01
+#define CKB_MN_ALARM_FORK   0x02
+#define CKB_MN_ALARM_DOWN   0x04
+
+/* ── What the display sees ─────────────────────────────────────── */
+struct ckb_mn_info_t {
+    char     name[12];
+    uint64_t tip;
+    uint64_t tip_ts;        /* block timestamp, ms */
+    uint64_t hash;          /* first 8 bytes of the tip hash */
+    uint64_t parent;        /* first 8 bytes of its parent hash */
+    uint32_t peers;
+    uint32_t latency_ms;    /* EWMA (1/4) over successful polls */
+    uint32_t lag;           /* blocks behind the best tip */
+    uint32_t fails;         /* consecutive failed polls */
+    uint32_t polls;
+    uint32_t errors;
+    bool     ok;            /* last poll succeeded */
+    bool     seen;          /* succeeded at least once */
+    bool     forked;
+};
+
+struct ckb_mn_snapshot_t {
+    uint8_t       count;
+    uint8_t       alarm;          /* CKB_MN_ALARM_* */
+    uint64_t      best_tip;
+    uint64_t      fork_height;
+    uint32_t      cycle;
+    uint32_t      cycle_ms;       /* how long the last cycle took */
+    ckb_mn_info_t node[CKB_MN_MAX_NODES];
+};
+
+/* ── Poller-private connection state ───────────────────────────── */
+enum { CKB_MN_IDLE, CKB_MN_CONNECT, CKB_MN_SEND, CKB_MN_RECV };
+
+struct ckb_mn_json_t {          /* streaming scanner, no buffering */
+    uint8_t  depth;
+    uint32_t objs;              /* bit d: container at depth d is an object */
+    bool     in_str, esc, is_key, want_key;
+    char     key[16];
+    uint8_t  klen;
+    char     val[20];           /* "0x" + 16 hex digits is all we keep */
+    uint8_t  vlen;
+};
+
+struct ckb_mn_conn_t {
+    char     host[64];
+    char     path[32];
+    uint16_t port;
+    struct sockaddr_in addr;
+    bool     resolved;
+    bool     tried;             /* resolve_at is valid */
+    uint32_t resolve_at;        /* last lookup attempt */
+
+    int      fd;
+    uint8_t  phase;
+    uint32_t t0;
+    uint16_t tx_off;
+
+    /* HTTP response */
+    char     line[40];
+    uint8_t  line_len;
+    bool     status_seen, in_body;
+    uint16_t status;
+    int32_t  content_len;       /* -1 until a Content-Length header */
+    int32_t  body_len;
+
+    /* Fields picked out of the batch reply */
+    ckb_mn_json_t js;
+    uint8_t  got;               /* CKB_MN_GOT_* */
+    uint64_t tip, ts, hash, parent;
+    uint32_t peers;
+};
+
+#define CKB_MN_GOT_NUMBER  0x01
+#define CKB_MN_GOT_HASH    0x02
+#define CKB_MN_GOT_PEERS   0x04
+#define CKB_MN_GOT_ERROR   0x80
+
+static const char _ckb_mn_batch[] =
+    "[{\"jsonrpc\":\"2.0\",\"method\":\"get_tip_header\",\"params\":[],\"id\":1},"
+    "{\"jsonrpc\":\"2.0\",\"method\":\"local_node_info\",\"params\":[],\"id\":2}]";
+
+static ckb_mn_conn_t     _ckb_mn_conn[CKB_MN_MAX_NODES];
+static ckb_mn_snapshot_t _ckb_mn_work;       /* owned by the poller */
+static ckb_mn_snapshot_t _ckb_mn_pub;        /* last finished cycle */
+static uint8_t           _ckb_mn_fork_run = 0;
+static uint32_t          _ckb_mn_taken = 0;  /* cycle last handed out */
+static char              _ckb_mn_next[256];  /* list waiting for the next cycle */
+static bool              _ckb_mn_next_set = false;
+
+#if defined(ESP32)
+static portMUX_TYPE _ckb_mn_mux = portMUX_INITIALIZER_UNLOCKED;
+#define CKB_MN_LOCK()   portENTER_CRITICAL(&_ckb_mn_mux)
+#define CKB_MN_UNLOCK() portEXIT_CRITICAL(&_ckb_mn_mux)
+#else
+#define CKB_MN_LOCK()
+#define CKB_MN_UNLOCK()
+#endif
+
+static uint32_t ckb_mn_millis() {
+#if defined(ESP32)
+    return millis();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+#endif
+}
+
+/* ── Endpoint list ─────────────────────────────────────────────── */
+/* "http://host[:port][/path]" — false for anything else */
+static bool ckb_mn_parse_url(ckb_mn_conn_t &c, const char *url, size_t len) {
+    if (len < 8 || strncmp(url, "http://", 7) != 0) return false;
+    const char *p = url + 7, *end = url + len;
+    const char *h = p;
+    while (p < end && *p != ':' && *p != '/') p++;
+    size_t hl = p - h;
+    if (hl == 0 || hl >= sizeof(c.host)) return false;
+    memcpy(c.host, h, hl);
+    c.host[hl] = '\0';
+    c.port = 80;
+    if (p < end && *p == ':') {
+        c.port = (uint16_t)strtoul(p + 1, nullptr, 10);
+        while (p < end && *p != '/') p++;
+    }
+    size_t pl = end - p;
+    if (pl == 0) strcpy(c.path, "/");
+    else if (pl < sizeof(c.path)) { memcpy(c.path, p, pl); c.path[pl] = '\0'; }
+    else return false;
+    return c.port != 0;
+}
+
+/* Add one endpoint; name may be NULL ("n1", "n2", ...) */
+static bool ckb_mn_add(const char *name, const char *url, size_t url_len) {
+    ckb_mn_snapshot_t &w = _ckb_mn_work;
+    if (w.count >= CKB_MN_MAX_NODES) return false;
+    ckb_mn_conn_t &c = _ckb_mn_conn[w.count];
+    memset(&c, 0, sizeof(c));
+    c.fd = -1;
+    if (!ckb_mn_parse_url(c, url, url_len)) return false;
+    ckb_mn_info_t &n = w.node[w.count];
+    memset(&n, 0, sizeof(n));
+    if (name && name[0]) snprintf(n.name, sizeof(n.name), "%s", name);
+    else snprintf(n.name, sizeof(n.name), "n%u", (unsigned)(w.count + 1));
+    w.count++;
+    return true;
+}
+
+/* "name=url, url, name=url" — commas, semicolons or whitespace between
+ * entries. Returns the number of endpoints now configured. */
+static uint8_t ckb_mn_add_list(const char *list) {
+    const char *p = list;
+    while (p && *p) {
+        while (*p == ',' || *p == ';' || *p == ' ' || *p == '\t' || *p == '\n') p++;
+        if (!*p) break;
+        const char *e = p;
+        while (*e && *e != ',' && *e != ';' && *e != ' ' && *e != '\t' && *e != '\n') e++;
+        const char *eq = (const char *)memchr(p, '=', e - p);
+        char name[12] = "";
+        const char *url = p;
+        if (eq) {
+            size_t nl = eq - p;
+            if (nl >= sizeof(name)) nl = sizeof(name) - 1;
+            memcpy(name, p, nl);
+            name[nl] = '\0';
+            url = eq + 1;
+        }
+        if (!ckb_mn_add(name, url, e - url))
+            printf("[mn] skipped endpoint: %.*s\n", (int)(e - p), p);
+        p = e;
+    }
+    return _ckb_mn_work.count;
+}
+
+/* ── Streaming JSON scanner ────────────────────────────────────── */
+/* Batch reply: array (depth 1) → response object (2) → result (3). The
+ * tip header and local_node_info results share no key names at depth 3. */
+static void ckb_mn_json_value(ckb_mn_conn_t &c) {
+    ckb_mn_json_t &j = c.js;
+    if (j.depth != 3 || j.vlen < 3 || j.val[0] != '0' || j.val[1] != 'x') return;
+    j.val[j.vlen < 18 ? j.vlen : 18] = '\0';       /* hashes: first 8 bytes */
+    uint64_t v = strtoull(j.val + 2, nullptr, 16);
+    if (!strcmp(j.key, "number"))            { c.tip = v;    c.got |= CKB_MN_GOT_NUMBER; }
+    else if (!strcmp(j.key, "hash"))         { c.hash = v;   c.got |= CKB_MN_GOT_HASH; }
+    else if (!strcmp(j.key, "parent_hash"))  { c.parent = v; }
+    else if (!strcmp(j.key, "timestamp"))    { c.ts = v; }
+    else if (!strcmp(j.key, "connections"))  { c.peers = (uint32_t)v; c.got |= CKB_MN_GOT_PEERS; }
+}
+
+static void ckb_mn_json_feed(ckb_mn_conn_t &c, char ch) {
+    ckb_mn_json_t &j = c.js;
+    if (j.in_str) {
+        if (j.esc) {
+            j.esc = false;
+        } else if (ch == '\\') {
+            j.esc = true;
+            return;
+        } else if (ch == '"') {
+            j.in_str = false;
+            if (j.is_key) {
+                j.key[j.klen] = '\0';
+                /* "error" beside or instead of "result" */
+                if (j.depth <= 2 && !strcmp(j.key, "error")) c.got |= CKB_MN_GOT_ERROR;
+            } else {
+                j.val[j.vlen < sizeof(j.val) - 1 ? j.vlen : sizeof(j.val) - 1] = '\0';
+                ckb_mn_json_value(c);
+            }
+            return;
+        }
+        if (j.is_key) { if (j.klen < sizeof(j.key) - 1) j.key[j.klen++] = ch; }
+        else if (j.vlen < sizeof(j.val) - 1) j.val[j.vlen++] = ch;
+        return;
+    }
+    switch (ch) {
+    case '"':
+        j.in_str = true;
+        j.esc = false;
+        j.is_key = j.want_key;
+        if (j.is_key) j.klen = 0;
+        else j.vlen = 0;
+        break;
+    case '{':
+        if (j.depth < 31) j.depth++;
+        j.objs |= 1UL << j.depth;
+        j.want_key = true;
+        break;
+    case '[':
+        if (j.depth < 31) j.depth++;
+        j.objs &= ~(1UL << j.depth);
+        j.want_key = false;
+        break;
+    case '}':
+    case ']':
+        if (j.depth) j.depth--;
+        j.want_key = false;
+        break;
+    case ':':
+        j.want_key = false;
+        break;
+    case ',':
+        j.want_key = (j.objs >> j.depth) & 1;
+        break;
+    }
+}
+
+/* ── HTTP response, one byte at a time ─────────────────────────── */
+static void ckb_mn_http_line(ckb_mn_conn_t &c) {
+    c.line[c.line_len] = '\0';
+    if (!c.status_seen) {
+        c.status_seen = true;
+        if (c.line_len >= 12) c.status = (uint16_t)atoi(c.line + 9);   /* "HTTP/1.1 200" */
+    } else if (c.line_len == 0) {
+        c.in_body = true;
+    } else if (!strncasecmp(c.line, "content-length:", 15)) {
+        c.content_len = atol(c.line + 15);
+    }
+    c.line_len = 0;
+}
+
+/* Returns true once the whole body is in */
+static bool ckb_mn_http_feed(ckb_mn_conn_t &c, const uint8_t *buf, int n) {
+    for (int i = 0; i < n; i++) {
+        char ch = (char)buf[i];
+        if (c.in_body) {
+            c.body_len++;
+            ckb_mn_json_feed(c, ch);
+        } else if (ch == '\n') {
+            ckb_mn_http_line(c);
+        } else if (ch != '\r' && c.line_len < sizeof(c.line) - 1) {
+            c.line[c.line_len++] = ch;
+        }
+    }
+    return c.in_body && c.content_len >= 0 && c.body_len >= c.content_len;
+}
+
+/* ── Sockets ───────────────────────────────────────────────────── */
+static void ckb_mn_close(ckb_mn_conn_t &c) {
+    if (c.fd >= 0) close(c.fd);
+    c.fd = -1;
+    c.phase = CKB_MN_IDLE;
+}
+
+/* Blocking lookup: only called between cycles (ckb_mn_resolve_all) */
+static bool ckb_mn_resolve(ckb_mn_conn_t &c) {
+    if (c.resolved) return true;
+    memset(&c.addr, 0, sizeof(c.addr));
+    c.addr.sin_family = AF_INET;
+    c.addr.sin_port = htons(c.port);
+    if (inet_pton(AF_INET, c.host, &c.addr.sin_addr) != 1) {
+        struct addrinfo hints, *res = nullptr;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        if (getaddrinfo(c.host, nullptr, &hints, &res) != 0 || !res) return false;
+        c.addr.sin_addr = ((struct sockaddr_in *)res->ai_addr)->sin_addr;
+        freeaddrinfo(res);
+    }
+    c.resolved = true;
+    return true;
+}
+
+/* Look up every endpoint that has no address yet, skipping names that
+ * failed less than CKB_MN_RESOLVE_RETRY_MS ago */
+static void ckb_mn_resolve_all() {
+    for (uint8_t i = 0; i < _ckb_mn_work.count; i++) {
+        ckb_mn_conn_t &c = _ckb_mn_conn[i];
+        if (c.resolved) continue;
+        uint32_t now = ckb_mn_millis();
+        if (c.tried && now - c.resolve_at < CKB_MN_RESOLVE_RETRY_MS) continue;
+        c.tried = true;
+        c.resolve_at = now;
+        if (!ckb_mn_resolve(c)) printf("[mn] cannot resolve %s\n", c.host);
+    }
+}
+
+static bool ckb_mn_open(ckb_mn_conn_t &c, uint32_t now) {
+    c.phase = CKB_MN_IDLE;
+    c.line_len = 0;
+    c.status_seen = c.in_body = false;
+    c.status = 0;
+    c.content_len = -1;
+    c.body_len = 0;
+    memset(&c.js, 0, sizeof(c.js));
+    c.got = 0;
+    c.tx_off = 0;
+    c.t0 = now;
+    if (!c.resolved) return false;                  /* lookups happen between cycles */
+    c.fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (c.fd < 0) return false;
+    fcntl(c.fd, F_SETFL, fcntl(c.fd, F_GETFL, 0) | O_NONBLOCK);
+    int one = 1;
+    setsockopt(c.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    if (connect(c.fd, (struct sockaddr *)&c.addr, sizeof(c.addr)) != 0 && errno != EINPROGRESS) {
+        ckb_mn_close(c);
+        c.resolved = false;                         /* maybe the address moved */
+        c.tried = false;                            /* look it up again before the next cycle */
+        return false;
+    }
+    c.phase = CKB_MN_CONNECT;
+    return true;
+}
+
+static void ckb_mn_send(ckb_mn_conn_t &c) {
+    char req[384];
+    int len = snprintf(req, sizeof(req),
+        "POST %s HTTP/1.0\r\nHost: %s:%u\r\nContent-Type: application/json\r\n"
+        "Content-Length: %u\r\nConnection: close\r\n\r\n%s",
+        c.path, c.host, (unsigned)c.port, (unsigned)(sizeof(_ckb_mn_batch) - 1), _ckb_mn_batch);
+    if (len <= c.tx_off) { c.phase = CKB_MN_RECV; return; }
+    int k = send(c.fd, req + c.tx_off, len - c.tx_off, 0);
+    if (k > 0) c.tx_off += k;
+    else if (errno != EAGAIN && errno != EWOULDBLOCK) { ckb_mn_close(c); return; }
+    if (c.tx_off >= len) c.phase = CKB_MN_RECV;
+}
+
+/* ── Results ───────────────────────────────────────────────────── */
+static void ckb_mn_finish(uint8_t i, bool ok, uint32_t now) {
+    ckb_mn_conn_t &c = _ckb_mn_conn[i];
+    ckb_mn_info_t &n = _ckb_mn_work.node[i];
+    ckb_mn_close(c);
+    ok = ok && c.status == 200 && !(c.got & CKB_MN_GOT_ERROR) &&
+         (c.got & (CKB_MN_GOT_NUMBER | CKB_MN_GOT_HASH)) == (CKB_MN_GOT_NUMBER | CKB_MN_GOT_HASH);
+    n.polls++;
+    n.ok = ok;
+    if (!ok) {
+        n.errors++;
+        n.fails++;
+        return;
+    }
+    uint32_t ms = now - c.t0;
+    n.latency_ms = n.seen ? (n.latency_ms * 3 + ms + 2) / 4 : ms;
+    n.seen = true;
+    n.fails = 0;
+    n.tip = c.tip;
+    n.tip_ts = c.ts;
+    n.hash = c.hash;
+    n.parent = c.parent;
+    if (c.got & CKB_MN_GOT_PEERS) n.peers = c.peers;
+}
+
+/* Best tip, per-node lag, fork and alarm flags */
+static void ckb_mn_evaluate() {
+    ckb_mn_snapshot_t &w = _ckb_mn_work;
+    uint64_t best = 0;
+    for (uint8_t i = 0; i < w.count; i++)
+        if (w.node[i].ok && w.node[i].tip > best) best = w.node[i].tip;
+    w.best_tip = best;
+
+    uint8_t alarm = 0;
+    uint64_t fork_at = 0;
+    for (uint8_t i = 0; i < w.count; i++) {
+        ckb_mn_info_t &a = w.node[i];
+        a.forked = false;
+        a.lag = (a.ok && best > a.tip) ? (uint32_t)(best - a.tip) : 0;
+        if (a.ok && a.lag > CKB_MN_LAG_BLOCKS) alarm |= CKB_MN_ALARM_LAG;
+        if (a.fails >= 2) alarm |= CKB_MN_ALARM_DOWN;
+    }
+    for (uint8_t i = 0; i < w.count; i++) {
+        ckb_mn_info_t &a = w.node[i];
+        if (!a.ok) continue;
+        for (uint8_t j = 0; j < w.count; j++) {
+            ckb_mn_info_t &b = w.node[j];
+            if (j == i || !b.ok) continue;
+            bool split = (j > i && a.tip == b.tip && a.hash != b.hash) ||
+                         (b.tip == a.tip + 1 && b.parent != a.hash);
+            if (split) {
+                a.forked = b.forked = true;
+                if (!fork_at || a.tip < fork_at) fork_at = a.tip;
+            }
+        }
+    }
+    _ckb_mn_fork_run = fork_at ? (_ckb_mn_fork_run < 255 ? _ckb_mn_fork_run + 1 : 255) : 0;
+    if (_ckb_mn_fork_run >= CKB_MN_FORK_CYCLES) alarm |= CKB_MN_ALARM_FORK;
+    w.fork_height = fork_at;
+    w.alarm = alarm;
+}
+
+/* ── One cycle: all endpoints in flight at once ────────────────── */
+static void ckb_mn_run_cycle() {
+    ckb_mn_snapshot_t &w = _ckb_mn_work;
+    uint32_t start = ckb_mn_millis();
+    for (uint8_t i = 0; i < w.count; i++)
+        if (!ckb_mn_open(_ckb_mn_conn[i], start)) ckb_mn_finish(i, false, start);
+
+    static uint8_t buf[1024];
+    for (;;) {
+        fd_set rd, wr;
+        FD_ZERO(&rd);
+        FD_ZERO(&wr);
+        int maxfd = -1;
+        for (uint8_t i = 0; i < w.count; i++) {
+            ckb_mn_conn_t &c = _ckb_mn_conn[i];
+            if (c.phase == CKB_MN_IDLE) continue;
+            if (c.phase == CKB_MN_RECV) FD_SET(c.fd, &rd);
+            else FD_SET(c.fd, &wr);
+            if (c.fd > maxfd) maxfd = c.fd;
+        }
+        if (maxfd < 0) break;
+
+        struct timeval tv = { 0, 50 * 1000 };      /* re-check timeouts 20×/s */
+        int ready = select(maxfd + 1, &rd, &wr, nullptr, &tv);
+        uint32_t now = ckb_mn_millis();
+
+        for (uint8_t i = 0; i < w.count; i++) {
+            ckb_mn_conn_t &c = _ckb_mn_conn[i];
+            if (c.phase == CKB_MN_IDLE) continue;
+            if (ready > 0 && c.phase == CKB_MN_CONNECT && FD_ISSET(c.fd, &wr)) {
+                int err = 0;
+                socklen_t el = sizeof(err);
+                getsockopt(c.fd, SOL_SOCKET, SO_ERROR, &err, &el);
+                if (err) { ckb_mn_finish(i, false, now); continue; }
+                c.phase = CKB_MN_SEND;
+            }
+            if (ready > 0 && c.phase == CKB_MN_SEND && FD_ISSET(c.fd, &wr)) {
+                ckb_mn_send(c);
+                if (c.phase == CKB_MN_IDLE) { ckb_mn_finish(i, false, now); continue; }
+            }
+            if (ready > 0 && c.phase == CKB_MN_RECV && FD_ISSET(c.fd, &rd)) {
+                int k = recv(c.fd, buf, sizeof(buf), 0);
+                if (k > 0) {
+                    if (ckb_mn_http_feed(c, buf, k)) { ckb_mn_finish(i, true, now); continue; }
+                } else if (k == 0) {                /* server closed: body complete */
+                    ckb_mn_finish(i, c.in_body, now);
+                    continue;
+                } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    ckb_mn_finish(i, false, now);
+                    continue;
+                }
+            }
+            if (now - c.t0 > CKB_MN_TIMEOUT_MS) ckb_mn_finish(i, false, now);
+        }
+    }
+
+    ckb_mn_evaluate();
+    w.cycle++;
+    w.cycle_ms = ckb_mn_millis() - start;
+    CKB_MN_LOCK();
+    memcpy(&_ckb_mn_pub, &w, sizeof(w));
+    CKB_MN_UNLOCK();
+}
+
+/* Copy the last finished cycle; false if nothing new since the last call */
+static bool ckb_mn_snapshot(ckb_mn_snapshot_t *out) {
+    bool fresh;
+    CKB_MN_LOCK();
+    fresh = _ckb_mn_pub.cycle != _ckb_mn_taken;
+    if (fresh) {
+        memcpy(out, &_ckb_mn_pub, sizeof(*out));
+        _ckb_mn_taken = _ckb_mn_pub.cycle;
+    }
+    CKB_MN_UNLOCK();
+    return fresh;
+}
+
+/* Copy the last finished cycle without consuming it (HTTP handlers) */
+static void ckb_mn_copy(ckb_mn_snapshot_t *out) {
+    CKB_MN_LOCK();
+    memcpy(out, &_ckb_mn_pub, sizeof(*out));
+    CKB_MN_UNLOCK();
+}
+
+static uint8_t ckb_mn_count() {
+    return _ckb_mn_work.count;
+}
+
+/* Replace the endpoint list from any task; the poller swaps it in
+ * before its next cycle, so a cycle never sees half a list */
+static void ckb_mn_set_list(const char *list) {
+    CKB_MN_LOCK();
+    snprintf(_ckb_mn_next, sizeof(_ckb_mn_next), "%s", list);
+    _ckb_mn_next_set = true;
+    CKB_MN_UNLOCK();
+}
+
+static void ckb_mn_take_list() {
+    char list[sizeof(_ckb_mn_next)];
+    CKB_MN_LOCK();
+    bool set = _ckb_mn_next_set;
+    memcpy(list, _ckb_mn_next, sizeof(list));
+    _ckb_mn_next_set = false;
+    CKB_MN_UNLOCK();
+    if (!set) return;
+    ckb_mn_snapshot_t &w = _ckb_mn_work;
+    uint32_t cycle = w.cycle;
+    memset(&w, 0, sizeof(w));
+    w.cycle = cycle;
+    _ckb_mn_fork_run = 0;
+    printf("[mn] new list: %u nodes\n", (unsigned)ckb_mn_add_list(list));
+}
+
+/* ── Poller task ───────────────────────────────────────────────── */
+#if defined(ESP32)
+static void ckb_mn_task(void *) {
+    for (;;) {
+        ckb_mn_take_list();
+        ckb_mn_resolve_all();
+        uint32_t t0 = millis();
+        ckb_mn_run_cycle();
+        uint32_t spent = millis() - t0;
+        if (spent < CKB_MN_POLL_MS) {
+            vTaskDelay(pdMS_TO_TICKS(CKB_MN_POLL_MS - spent));
+        } else {
+            Serial.printf("[mn] cycle took %lu ms (> %u)\n", (unsigned long)spent, CKB_MN_POLL_MS);
+            vTaskDelay(1);
+        }
+    }
+}
+
+static bool ckb_mn_start(uint8_t core = 0) {
+    if (!_ckb_mn_work.count) return false;
+    return xTaskCreatePinnedToCore(ckb_mn_task, "multinode", 6144, nullptr, 1, nullptr, core) == pdPASS;
+}
+#endif
@@ -0,0 +1,476 @@
+/*
+ * ckb_pow.h — Header hash and Eaglesong PoW verification
+ * ======================================================
+ * Checks every header the poller sees (tips and cache backfill) in a
+ * background task on core 0, so a catch-up burst after a reconnect never
+ * delays a redraw:
+ *
+ *   hash  blake2b-256("ckb-default-hash") of the molecule Header (208 B)
+ *         must equal the hash the node reported
+ *   pow   eaglesong(pow_hash || nonce_le) as a big-endian U256 must not
+ *         exceed the target decoded from compact_target, where pow_hash
+ *         is blake2b-256 of the RawHeader (first 192 B). That is the
+ *         mainnet engine; -DCKB_POW_TESTNET=1 selects the testnet one,
+ *         which hashes the Eaglesong output once more with blake2b-256.
+ *
+ * Eaglesong's constant tables (bit matrix, rotation coefficients, 688
+ * injection constants) are in ckb_eaglesong_tables.h, generated by
+ * tools/eaglesong_tables.py. The tool checks them against the published
+ * "Hello, world!\n" digest; tools/pow_host.cpp checks the sponge here
+ * against the tool. No mainnet header fixture has been run through this
+ * file yet (tools/pow_fixture.py needs a node), so a BAD POW count on real
+ * headers points at this verifier first. Failures are only counted for
+ * /metrics; -DCKB_POW_SHOW_BAD=1 also puts them in the header bar once
+ * pow_host passes tools/pow_mainnet.json. Building without the tables
+ * header falls back to the hash check alone, with pow_checked at 0.
+ *
+ * Usage:
+ *   ckb_pow_begin();                     // bench, queue, task on core 0
+ *   ckb_pow_submit_json(resp.c_str());   // any reply holding "result":{header}
+ *   ckb_pow_stats_t p; ckb_pow_copy(&p);   // .verified, .bad_hash, .bad_pow, .bench_hps
+ *
+ * Host: ckb_pow_verify() and ckb_pow_bench() build without FreeRTOS
+ * (tools/pow_host.cpp).
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "ckb_headers.h"
+
+#if defined(ESP32)
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/queue.h>
+#else
+#include <time.h>
+#endif
+
+#if __has_include("ckb_eaglesong_tables.h")
+#include "ckb_eaglesong_tables.h"
+#define CKB_POW_EAGLESONG  1
+#else
+#define CKB_POW_EAGLESONG  0
+#endif
+
+#ifndef CKB_POW_TESTNET
+#define CKB_POW_TESTNET     0       /* 1: EaglesongBlake2b, the testnet engine */
+#endif
+
+#define CKB_POW_HEADER_LEN  208
+#define CKB_POW_RAW_LEN     192
+#ifndef CKB_POW_SHOW_BAD
+#define CKB_POW_SHOW_BAD    0       /* 1: header bar shows BAD HDR, not just /metrics */
+#endif
+#ifndef CKB_POW_QUEUE
+#define CKB_POW_QUEUE       32      /* headers waiting for the task */
+#endif
+#define CKB_POW_SUBMIT_MS   100     /* how long a burst may wait for room */
+
+enum {
+    CKB_POW_OK = 0,         /* hash and PoW verified */
+    CKB_POW_HASH_OK,        /* hash verified, no Eaglesong tables */
+    CKB_POW_BAD_HASH,
+    CKB_POW_BAD_TARGET,     /* compact_target zero or overflowing */
+    CKB_POW_BAD_POW,
+};
+
+struct ckb_pow_header_t {
+    uint8_t  raw[CKB_POW_HEADER_LEN];   /* molecule Header: RawHeader + nonce */
+    uint8_t  hash[32];                  /* as reported by the node */
+    uint64_t number;
+};
+
+struct ckb_pow_stats_t {
+    uint32_t verified;      /* passed every check that ran */
+    uint32_t pow_checked;
+    uint32_t bad_hash;
+    uint32_t bad_pow;       /* includes bad targets */
+    uint32_t dropped;       /* queue stayed full */
+    uint32_t queue_max;
+    uint64_t last_number;
+    uint8_t  last_result;
+    uint32_t worst_us;      /* slowest single verification */
+    uint32_t bench_hps;     /* headers per second at boot */
+    uint32_t bench_es_hps;  /* Eaglesong alone, 0 without the tables */
+};
+
+static ckb_pow_stats_t _ckb_pow = {};
+
+#if defined(ESP32)
+static portMUX_TYPE _ckb_pow_mux = portMUX_INITIALIZER_UNLOCKED;
+#define CKB_POW_LOCK()   portENTER_CRITICAL(&_ckb_pow_mux)
+#define CKB_POW_UNLOCK() portEXIT_CRITICAL(&_ckb_pow_mux)
+#else
+#define CKB_POW_LOCK()
+#define CKB_POW_UNLOCK()
+#endif
+
+/* Counters for another task: the verifier and the poller both write them */
+static inline void ckb_pow_copy(ckb_pow_stats_t *out) {
+    CKB_POW_LOCK();
+    *out = _ckb_pow;
+    CKB_POW_UNLOCK();
+}
+
+static uint32_t ckb_pow_micros() {
+#if defined(ESP32)
+    return (uint32_t)esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#endif
+}
+
+/* ── blake2b-256, "ckb-default-hash" personalisation ───────────── */
+/* One-shot over inputs of at most a few blocks: no streaming buffer, the
+ * parameter block is folded into the IV once. */
+static const uint64_t ckb_b2b_iv[8] = {
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+    0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL,
+};
+
+static const uint8_t ckb_b2b_sigma[12][16] = {
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+    { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+    {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+    {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+    {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+    { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+    { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+    {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+    { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 },
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+};
+
+static inline uint64_t ckb_b2b_rotr(uint64_t x, int n) {
+    return (x >> n) | (x << (64 - n));
+}
+
+static inline uint64_t ckb_b2b_load64(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, 8);               /* Xtensa and x86 are little-endian */
+    return v;
+}
+
+#define CKB_B2B_G(a, b, c, d, x, y)                 \
+    do {                                            \
+        a = a + b + (x); d = ckb_b2b_rotr(d ^ a, 32); \
+        c = c + d;       b = ckb_b2b_rotr(b ^ c, 24); \
+        a = a + b + (y); d = ckb_b2b_rotr(d ^ a, 16); \
+        c = c + d;       b = ckb_b2b_rotr(b ^ c, 63); \
+    } while (0)
+
+static void ckb_b2b_compress(uint64_t h[8], const uint8_t block[128], uint64_t t, bool last) {
+    uint64_t m[16];
+    for (int i = 0; i < 16; i++) m[i] = ckb_b2b_load64(block + 8 * i);
+    uint64_t v0 = h[0], v1 = h[1], v2 = h[2], v3 = h[3];
+    uint64_t v4 = h[4], v5 = h[5], v6 = h[6], v7 = h[7];
+    uint64_t v8 = ckb_b2b_iv[0], v9 = ckb_b2b_iv[1], v10 = ckb_b2b_iv[2], v11 = ckb_b2b_iv[3];
+    uint64_t v12 = ckb_b2b_iv[4] ^ t, v13 = ckb_b2b_iv[5];
+    uint64_t v14 = last ? ~ckb_b2b_iv[6] : ckb_b2b_iv[6], v15 = ckb_b2b_iv[7];
+    for (int r = 0; r < 12; r++) {
+        const uint8_t *s = ckb_b2b_sigma[r];
+        CKB_B2B_G(v0, v4, v8,  v12, m[s[0]],  m[s[1]]);
+        CKB_B2B_G(v1, v5, v9,  v13, m[s[2]],  m[s[3]]);
+        CKB_B2B_G(v2, v6, v10, v14, m[s[4]],  m[s[5]]);
+        CKB_B2B_G(v3, v7, v11, v15, m[s[6]],  m[s[7]]);
+        CKB_B2B_G(v0, v5, v10, v15, m[s[8]],  m[s[9]]);
+        CKB_B2B_G(v1, v6, v11, v12, m[s[10]], m[s[11]]);
+        CKB_B2B_G(v2, v7, v8,  v13, m[s[12]], m[s[13]]);
+        CKB_B2B_G(v3, v4, v9,  v14, m[s[14]], m[s[15]]);
+    }
+    h[0] ^= v0 ^ v8;  h[1] ^= v1 ^ v9;  h[2] ^= v2 ^ v10; h[3] ^= v3 ^ v11;
+    h[4] ^= v4 ^ v12; h[5] ^= v5 ^ v13; h[6] ^= v6 ^ v14; h[7] ^= v7 ^ v15;
+}
+
+static void ckb_blake2b_256(const uint8_t *in, size_t len, uint8_t out[32]) {
+    static const uint8_t person[16] = { 'c','k','b','-','d','e','f','a','u','l','t','-','h','a','s','h' };
+    uint64_t h[8];
+    memcpy(h, ckb_b2b_iv, sizeof(h));
+    h[0] ^= 0x01010000ULL ^ 32;                     /* fanout 1, depth 1, 32-byte digest */
+    h[6] ^= ckb_b2b_load64(person);
+    h[7] ^= ckb_b2b_load64(person + 8);
+
+    size_t off = 0;
+    while (len - off > 128) {
+        ckb_b2b_compress(h, in + off, off + 128, false);
+        off += 128;
+    }
+    uint8_t block[128] = {};
+    memcpy(block, in + off, len - off);
+    ckb_b2b_compress(h, block, len, true);
+    memcpy(out, h, 32);
+}
+
+/* ── Eaglesong ─────────────────────────────────────────────────── */
+#if CKB_POW_EAGLESONG
+#define CKB_ES_ROUNDS  43
+
+static inline uint32_t ckb_es_rotl(uint32_t x, int n) {
+    return n ? (x << n) | (x >> (32 - n)) : x;
+}
+
+/* Bit matrix as per-output lists of input words, built once. The
+ * reference stores it row-major: new[j] ^= bitmatrix[k * 16 + j] * s[k]. */
+static uint8_t ckb_es_taps[16][16];
+static uint8_t ckb_es_ntaps[16];
+
+static void ckb_es_init() {
+    for (int j = 0; j < 16; j++) {
+        ckb_es_ntaps[j] = 0;
+        for (int k = 0; k < 16; k++)
+            if (ckb_es_bitmatrix[k * 16 + j]) ckb_es_taps[j][ckb_es_ntaps[j]++] = (uint8_t)k;
+    }
+}
+
+static void ckb_es_permute(uint32_t s[16]) {
+    uint32_t t[16];
+    for (int r = 0; r < CKB_ES_ROUNDS; r++) {
+        for (int j = 0; j < 16; j++) {
+            uint32_t v = 0;
+            for (int k = 0; k < ckb_es_ntaps[j]; k++) v ^= s[ckb_es_taps[j][k]];
+            t[j] = v;
+        }
+        const uint32_t *inj = ckb_es_inject + r * 16;
+        for (int j = 0; j < 16; j++)
+            s[j] = t[j] ^ ckb_es_rotl(t[j], ckb_es_coeff[3 * j + 1])
+                        ^ ckb_es_rotl(t[j], ckb_es_coeff[3 * j + 2]) ^ inj[j];
+        for (int j = 0; j < 16; j += 2) {
+            s[j] = ckb_es_rotl(s[j] + s[j + 1], 8);
+            s[j + 1] = ckb_es_rotl(s[j + 1], 24) + s[j];
+        }
+    }
+}
+
+/* Sponge, rate 256 bits, delimiter 0x06, specialised to the 48-byte PoW
+ * message and a 32-byte digest. Words absorb big-endian and squeeze
+ * little-endian, as in the reference. The reference stops shifting at the
+ * delimiter, so it lands in the low byte of its word: byte 48 opens word 4
+ * of the second block, which absorbs 0x00000006, not 0x06000000. */
+static void ckb_eaglesong48(const uint8_t in[48], uint8_t out[32]) {
+    uint32_t s[16] = {};
+    for (int b = 0; b < 2; b++) {
+        for (int j = 0; j < (b ? 4 : 8); j++) {
+            const uint8_t *p = in + b * 32 + j * 4;
+            s[j] ^= (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+        }
+        if (b) s[4] ^= 0x06;
+        ckb_es_permute(s);
+    }
+    for (int j = 0; j < 8; j++) {
+        out[4 * j]     = (uint8_t)s[j];
+        out[4 * j + 1] = (uint8_t)(s[j] >> 8);
+        out[4 * j + 2] = (uint8_t)(s[j] >> 16);
+        out[4 * j + 3] = (uint8_t)(s[j] >> 24);
+    }
+}
+#endif
+
+/* ── Target ────────────────────────────────────────────────────── */
+/* compact_target → 256-bit big-endian target; false if zero or overflowing */
+static bool ckb_pow_target(uint32_t compact, uint8_t target[32]) {
+    uint32_t exp = compact >> 24, mant = compact & 0x00FFFFFF;
+    memset(target, 0, 32);
+    if (mant == 0) return false;
+    if (exp > 32) return false;
+    if (exp <= 3) {
+        mant >>= 8 * (3 - exp);
+        target[29] = (uint8_t)(mant >> 16);
+        target[30] = (uint8_t)(mant >> 8);
+        target[31] = (uint8_t)mant;
+        return mant != 0;
+    }
+    /* mantissa's low byte lands exp - 3 bytes above the bottom */
+    for (int i = 0; i < 3; i++) {
+        int pos = 31 - (int)(exp - 3) - i;
+        if (pos >= 0) target[pos] = (uint8_t)(mant >> (8 * i));
+    }
+    return true;
+}
+
+/* ── Headers ───────────────────────────────────────────────────── */
+static void ckb_pow_put_le(uint8_t *p, uint64_t v, int n) {
+    for (int i = 0; i < n; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+/* u128 nonce: up to 32 hex digits → 16 bytes little-endian */
+static bool ckb_pow_put_u128(uint8_t *p, const char *hex) {
+    memset(p, 0, 16);
+    if (!hex) return false;
+    int n = 0;
+    while (n < 32 && ckb_hdr_nibble(hex[n]) >= 0) n++;
+    for (int i = 0; i < n; i++) {
+        int d = ckb_hdr_nibble(hex[n - 1 - i]);
+        p[i / 2] |= (uint8_t)(d << (4 * (i & 1)));
+    }
+    return n > 0;
+}
+
+/* One header object (the text between its braces) → molecule bytes */
+static bool ckb_pow_parse(const char *p, const char *end, ckb_pow_header_t &h) {
+    const char *num = ckb_hdr_field(p, end, "number");
+    if (!num || !ckb_hdr_hex32(ckb_hdr_field(p, end, "hash"), h.hash)) return false;
+    uint8_t *r = h.raw;
+    h.number = ckb_hdr_hex64(num);
+    ckb_pow_put_le(r + 0,  ckb_hdr_hex64(ckb_hdr_field(p, end, "version")), 4);
+    ckb_pow_put_le(r + 4,  ckb_hdr_hex64(ckb_hdr_field(p, end, "compact_target")), 4);
+    ckb_pow_put_le(r + 8,  ckb_hdr_hex64(ckb_hdr_field(p, end, "timestamp")), 8);
+    ckb_pow_put_le(r + 16, h.number, 8);
+    ckb_pow_put_le(r + 24, ckb_hdr_hex64(ckb_hdr_field(p, end, "epoch")), 8);
+    return ckb_hdr_hex32(ckb_hdr_field(p, end, "parent_hash"),       r + 32) &&
+           ckb_hdr_hex32(ckb_hdr_field(p, end, "transactions_root"), r + 64) &&
+           ckb_hdr_hex32(ckb_hdr_field(p, end, "proposals_hash"),    r + 96) &&
+           ckb_hdr_hex32(ckb_hdr_field(p, end, "extra_hash"),        r + 128) &&
+           ckb_hdr_hex32(ckb_hdr_field(p, end, "dao"),               r + 160) &&
+           ckb_pow_put_u128(r + 192, ckb_hdr_field(p, end, "nonce"));
+}
+
+static uint8_t ckb_pow_verify(const ckb_pow_header_t &h) {
+    uint8_t digest[32];
+    ckb_blake2b_256(h.raw, CKB_POW_HEADER_LEN, digest);
+    if (memcmp(digest, h.hash, 32)) return CKB_POW_BAD_HASH;
+#if CKB_POW_EAGLESONG
+    uint8_t target[32];
+    uint32_t compact = h.raw[4] | h.raw[5] << 8 | h.raw[6] << 16 | (uint32_t)h.raw[7] << 24;
+    if (!ckb_pow_target(compact, target)) return CKB_POW_BAD_TARGET;
+    uint8_t msg[48];
+    ckb_blake2b_256(h.raw, CKB_POW_RAW_LEN, msg);   /* pow_hash */
+    memcpy(msg + 32, h.raw + CKB_POW_RAW_LEN, 16);  /* nonce, already LE */
+    ckb_eaglesong48(msg, digest);
+#if CKB_POW_TESTNET
+    ckb_blake2b_256(digest, 32, digest);
+#endif
+    return memcmp(digest, target, 32) <= 0 ? CKB_POW_OK : CKB_POW_BAD_POW;
+#else
+    return CKB_POW_HASH_OK;
+#endif
+}
+
+static void ckb_pow_count(const ckb_pow_header_t &h, uint8_t res, uint32_t us) {
+    ckb_pow_stats_t &s = _ckb_pow;
+    CKB_POW_LOCK();
+    s.last_number = h.number;
+    s.last_result = res;
+    if (us > s.worst_us) s.worst_us = us;
+    if (res == CKB_POW_OK || res == CKB_POW_HASH_OK) s.verified++;
+    if (res == CKB_POW_OK || res == CKB_POW_BAD_POW) s.pow_checked++;
+    if (res == CKB_POW_BAD_HASH) s.bad_hash++;
+    if (res == CKB_POW_BAD_POW || res == CKB_POW_BAD_TARGET) s.bad_pow++;
+    CKB_POW_UNLOCK();
+}
+
+/* Eaglesong digests per second on this core; 0 without the tables */
+static uint32_t ckb_pow_bench_eaglesong(uint16_t n) {
+#if CKB_POW_EAGLESONG
+    uint8_t msg[48], out[32];
+    for (int i = 0; i < 48; i++) msg[i] = (uint8_t)(i * 53 + 5);
+    uint32_t t0 = ckb_pow_micros();
+    for (uint16_t i = 0; i < n; i++) {
+        msg[32] = (uint8_t)i;
+        ckb_eaglesong48(msg, out);
+        msg[0] ^= out[0];                               /* keep the calls live */
+    }
+    uint32_t us = ckb_pow_micros() - t0;
+    return us ? (uint32_t)((uint64_t)n * 1000000 / us) : 0;
+#else
+    (void)n;
+    return 0;
+#endif
+}
+
+/* Headers per second on this core; the result of each check is ignored */
+static uint32_t ckb_pow_bench(uint16_t n) {
+    ckb_pow_header_t h;
+    for (int i = 0; i < CKB_POW_HEADER_LEN; i++) h.raw[i] = (uint8_t)(i * 37 + 11);
+    uint32_t t0 = ckb_pow_micros();
+    volatile uint32_t sink = 0;
+    for (uint16_t i = 0; i < n; i++) {
+        h.raw[192] = (uint8_t)i;
+        ckb_blake2b_256(h.raw, CKB_POW_HEADER_LEN, h.hash);   /* so the PoW step runs too */
+        sink += ckb_pow_verify(h);
+    }
+    uint32_t us = ckb_pow_micros() - t0;
+    (void)sink;
+    return us ? (uint32_t)((uint64_t)n * 1000000 / us) : 0;
+}
+
+/* ── Background task ───────────────────────────────────────────── */
+#if defined(ESP32)
+static QueueHandle_t _ckb_pow_q = nullptr;
+
+static void ckb_pow_task(void *) {
+    ckb_pow_header_t h;
+    for (;;) {
+        if (xQueueReceive(_ckb_pow_q, &h, portMAX_DELAY) != pdTRUE) continue;
+        uint32_t t0 = ckb_pow_micros();
+        uint8_t res = ckb_pow_verify(h);
+        ckb_pow_count(h, res, ckb_pow_micros() - t0);
+        if (res == CKB_POW_BAD_HASH)
+            Serial.printf("[pow] #%llu hash does not match its fields\n", (unsigned long long)h.number);
+        else if (res == CKB_POW_BAD_POW || res == CKB_POW_BAD_TARGET)
+            Serial.printf("[pow] #%llu fails its compact_target\n", (unsigned long long)h.number);
+    }
+}
+
+static bool ckb_pow_begin(uint8_t core = 0) {
+    if (_ckb_pow_q) return true;
+#if CKB_POW_EAGLESONG
+    ckb_es_init();
+#endif
+    _ckb_pow.bench_hps = ckb_pow_bench(64);
+    _ckb_pow.bench_es_hps = ckb_pow_bench_eaglesong(64);
+    _ckb_pow_q = xQueueCreate(CKB_POW_QUEUE, sizeof(ckb_pow_header_t));
+    if (!_ckb_pow_q) return false;
+    return xTaskCreatePinnedToCore(ckb_pow_task, "pow", 4096, nullptr, 1, nullptr, core) == pdPASS;
+}
+
+static void ckb_pow_submit(const ckb_pow_header_t &h) {
+    if (!_ckb_pow_q) return;
+    bool sent = xQueueSend(_ckb_pow_q, &h, pdMS_TO_TICKS(CKB_POW_SUBMIT_MS)) == pdTRUE;
+    uint32_t depth = uxQueueMessagesWaiting(_ckb_pow_q);
+    CKB_POW_LOCK();
+    if (!sent) _ckb_pow.dropped++;
+    else if (depth > _ckb_pow.queue_max) _ckb_pow.queue_max = depth;
+    CKB_POW_UNLOCK();
+}
+#else
+static bool ckb_pow_begin(uint8_t = 0) {
+#if CKB_POW_EAGLESONG
+    ckb_es_init();
+#endif
+    _ckb_pow.bench_hps = ckb_pow_bench(64);
+    _ckb_pow.bench_es_hps = ckb_pow_bench_eaglesong(64);
+    return true;
+}
+
+/* Host: verify inline */
+static void ckb_pow_submit(const ckb_pow_header_t &h) {
+    uint32_t t0 = ckb_pow_micros();
+    uint8_t res = ckb_pow_verify(h);
+    ckb_pow_count(h, res, ckb_pow_micros() - t0);
+}
+#endif
+
+/* Every header object in a get_tip_header / get_header_by_number reply
+ * (single or batch); returns how many were queued */
+static inline uint16_t ckb_pow_submit_json(const char *json) {
+    uint16_t n = 0;
+    const char *end = json + strlen(json);
+    for (const char *p = strstr(json, "\"result\":{"); p; p = strstr(p, "\"result\":{")) {
+        p += 10;
+        const char *close = (const char *)memchr(p, '}', end - p);
+        if (!close) break;
+        static ckb_pow_header_t h;          /* 250 B, keep it off the caller's stack */
+        if (ckb_pow_parse(p, close, h)) {
+            ckb_pow_submit(h);
+            n++;
+        }
+        p = close;
+    }
+    return n;
+}
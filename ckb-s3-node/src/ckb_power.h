@@ -0,0 +1,340 @@
+/*
+ * ckb_power.h — Idle power: light sleep, quiet hours, backlight
+ * =============================================================
+ * The dashboard does useful work for a fraction of each poll. This module
+ * lets the chip idle the rest of the time:
+ *
+ *   esp_pm   dynamic frequency scaling (CKB_PWR_MAX_MHZ ↔ CKB_PWR_MIN_MHZ)
+ *            and automatic light sleep whenever every task is blocked.
+ *            WiFi stays associated in modem sleep and wakes for DTIM
+ *            beacons. Light sleep needs a framework build with tickless
+ *            idle; without it esp_pm refuses, and only DFS is used.
+ *
+ *   panel    the RGB panel streams the framebuffer from PSRAM all the time
+ *            and its driver blocks light sleep while it does. In quiet
+ *            hours the backlight goes off and the stream is paused, so the
+ *            chip can sleep. The framebuffer is still drawn to while paused.
+ *
+ *      ACTIVE ──quiet hours start──▶ QUIET ──touch / new block──▶ WOKEN
+ *        ▲                             ▲                           │
+ *        └───────quiet hours end───────┴──────hold time over───────┘
+ *
+ *   WOKEN shows the panel at CKB_PWR_DIM for CKB_PWR_TOUCH_MS after a
+ *   touch. Blocks arrive every ~10 s, so by default they don't wake it;
+ *   with CKB_PWR_BLOCK_MS set, a new block wakes it for that long, at
+ *   most once per CKB_PWR_BLOCK_GAP_MS. Resuming restarts the
+ *   DMA, waits one frame, then lights the backlight. The time from the
+ *   wake request to backlight on is measured against the 100 ms target.
+ *
+ * Quiet hours ("23:00-07:00", local time in a POSIX TZ) need no NTP: the
+ * chain is the clock. Each good poll passes the tip's timestamp, which is
+ * accurate to about one block interval. Until the first poll, or with no
+ * quiet hours set, the panel stays on.
+ *
+ * Telemetry: time in each state, how much of it the app was busy, wakes by
+ * source, resume latency (last / max), and an estimated current per state
+ * from the CKB_PWR_MA_* figures below. Those are rough numbers for this
+ * board; measure yours and override them.
+ *
+ * Usage:
+ *   ckb_pwr_begin(BL_PIN, pause_fn, resume_fn);   // backlight off, esp_pm set up
+ *   ckb_pwr_backlight(CKB_PWR_BRIGHT);           // after the first frame
+ *   ckb_pwr_quiet("23:00-07:00", tz);
+ *   ckb_pwr_clock(tip_ts_ms, millis());          // after every good poll
+ *   ckb_pwr_wake(CKB_PWR_WAKE_BLOCK, CKB_PWR_BLOCK_MS, millis());
+ *   ckb_pwr_busy(ms);                            // time spent polling
+ *   ckb_pwr_tick(millis());                      // every loop pass
+ *   delay(ckb_pwr_tick_ms(20));                  // longer ticks while QUIET
+ *   static ckb_pwr_info_t p; ckb_pwr_copy(&p);   // /status, /metrics
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+#include <esp_idf_version.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <driver/uart.h>
+
+#ifndef CKB_PWR_MAX_MHZ
+#define CKB_PWR_MAX_MHZ     240
+#endif
+#ifndef CKB_PWR_MIN_MHZ
+#define CKB_PWR_MIN_MHZ     80
+#endif
+#ifndef CKB_PWR_TICK_MS
+#define CKB_PWR_TICK_MS     50      /* task ticks while QUIET: bounds touch latency */
+#endif
+#ifndef CKB_PWR_FRAME_MS
+#define CKB_PWR_FRAME_MS    30      /* one full frame at 12 MHz pclk before the backlight */
+#endif
+#ifndef CKB_PWR_BRIGHT
+#define CKB_PWR_BRIGHT      255
+#endif
+#ifndef CKB_PWR_DIM
+#define CKB_PWR_DIM         48      /* backlight duty when woken in quiet hours */
+#endif
+#ifndef CKB_PWR_TOUCH_MS
+#define CKB_PWR_TOUCH_MS    30000
+#endif
+#ifndef CKB_PWR_BLOCK_MS
+#define CKB_PWR_BLOCK_MS    0       /* >0: a new block wakes the panel this long */
+#endif
+#ifndef CKB_PWR_BLOCK_GAP_MS
+#define CKB_PWR_BLOCK_GAP_MS 900000 /* at most one block wake per 15 min */
+#endif
+#ifndef CKB_PWR_LEDC_CH
+#define CKB_PWR_LEDC_CH     7
+#endif
+#define CKB_PWR_RESUME_US   100000  /* target: wake request → backlight on */
+
+/* Current estimates, mA from the 5 V input */
+#ifndef CKB_PWR_MA_CPU
+#define CKB_PWR_MA_CPU      50      /* awake, WiFi associated in modem sleep */
+#endif
+#ifndef CKB_PWR_MA_SLEEP
+#define CKB_PWR_MA_SLEEP    4       /* light sleep, DTIM wakes averaged in */
+#endif
+#ifndef CKB_PWR_MA_PANEL
+#define CKB_PWR_MA_PANEL    30      /* ST7701 + RGB DMA from PSRAM */
+#endif
+#ifndef CKB_PWR_MA_BL
+#define CKB_PWR_MA_BL       120     /* backlight at full duty, linear in duty */
+#endif
+
+enum { CKB_PWR_ACTIVE, CKB_PWR_WOKEN, CKB_PWR_QUIET, CKB_PWR_STATES };
+enum { CKB_PWR_WAKE_TOUCH, CKB_PWR_WAKE_BLOCK, CKB_PWR_WAKE_SOURCES };
+enum { CKB_PWR_PM_OFF, CKB_PWR_PM_DFS, CKB_PWR_PM_SLEEP };
+
+typedef void (*ckb_pwr_fn_t)();
+
+/* ── What /metrics and /status see ─────────────────────────────── */
+struct ckb_pwr_info_t {
+    uint8_t  state;
+    uint8_t  pm;                          /* CKB_PWR_PM_*: what esp_pm accepted */
+    bool     clock;                       /* chain time known */
+    uint8_t  duty;                        /* backlight now */
+    uint64_t ms[CKB_PWR_STATES];          /* time in each state */
+    uint64_t busy_ms[CKB_PWR_STATES];     /* of which the app was polling */
+    uint32_t wakes[CKB_PWR_WAKE_SOURCES]; /* panel resumes, by cause */
+    uint32_t resume_us;                   /* last resume: request → backlight on */
+    uint32_t resume_max_us;
+    uint32_t slow_resumes;                /* over CKB_PWR_RESUME_US */
+};
+
+struct ckb_pwr_t {
+    ckb_pwr_fn_t pause, resume;
+    int16_t  quiet_from, quiet_to;        /* minutes past local midnight, -1: none */
+    uint64_t utc_ms;                      /* chain clock: tip timestamp ... */
+    uint32_t utc_at;                      /* ... at this millis() */
+    uint32_t since;                       /* last accounting */
+    uint32_t woken_until;
+    uint32_t block_wake_at;               /* last panel resume for a block */
+    ckb_pwr_info_t info;
+};
+
+static ckb_pwr_t       _ckb_pwr = { nullptr, nullptr, -1, -1 };
+static ckb_pwr_info_t  _ckb_pwr_pub = {};
+static portMUX_TYPE    _ckb_pwr_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static const char *ckb_pwr_state_name(uint8_t s) {
+    return s == CKB_PWR_ACTIVE ? "active" : s == CKB_PWR_WOKEN ? "woken" : "quiet";
+}
+
+static const char *ckb_pwr_wake_name(uint8_t w) {
+    return w == CKB_PWR_WAKE_TOUCH ? "touch" : "block";
+}
+
+static const char *ckb_pwr_pm_name(uint8_t pm) {
+    return pm == CKB_PWR_PM_SLEEP ? "dfs+light-sleep" : pm == CKB_PWR_PM_DFS ? "dfs" : "off";
+}
+
+/* Estimated draw in state s, mA */
+static float ckb_pwr_ma(const ckb_pwr_info_t &i, uint8_t s) {
+    if (s == CKB_PWR_ACTIVE)
+        return CKB_PWR_MA_CPU + CKB_PWR_MA_PANEL + CKB_PWR_MA_BL * CKB_PWR_BRIGHT / 255.0f;
+    if (s == CKB_PWR_WOKEN)
+        return CKB_PWR_MA_CPU + CKB_PWR_MA_PANEL + CKB_PWR_MA_BL * CKB_PWR_DIM / 255.0f;
+    if (i.pm != CKB_PWR_PM_SLEEP || !i.ms[s]) return CKB_PWR_MA_CPU;
+    /* Asleep except while polling (HTTP and WiFi wakes are in MA_SLEEP) */
+    float busy = (float)i.busy_ms[s] / i.ms[s];
+    return CKB_PWR_MA_SLEEP + busy * (CKB_PWR_MA_CPU - CKB_PWR_MA_SLEEP);
+}
+
+/* Time-weighted average since boot, mA; mAh through *mah */
+static float ckb_pwr_avg_ma(const ckb_pwr_info_t &i, float *mah = nullptr) {
+    double q = 0, t = 0;
+    for (uint8_t s = 0; s < CKB_PWR_STATES; s++) {
+        q += (double)ckb_pwr_ma(i, s) * i.ms[s];
+        t += i.ms[s];
+    }
+    if (mah) *mah = (float)(q / 3600000.0);
+    return t ? (float)(q / t) : 0;
+}
+
+/* ── Backlight (LEDC PWM) ──────────────────────────────────────── */
+static void ckb_pwr_backlight(uint8_t duty) {
+    ledcWrite(CKB_PWR_LEDC_CH, duty);
+    _ckb_pwr.info.duty = duty;
+}
+
+/* ── Quiet hours ───────────────────────────────────────────────── */
+static int16_t ckb_pwr_minutes(const char *&p) {
+    if (*p < '0' || *p > '9') return -1;
+    int h = (int)strtol(p, (char **)&p, 10), m = 0;
+    if (*p == ':') m = (int)strtol(p + 1, (char **)&p, 10);
+    return h < 24 && m < 60 ? (int16_t)(h * 60 + m) : -1;
+}
+
+/* "HH[:MM]-HH[:MM]" in tz (POSIX, "" = UTC); anything else: no quiet hours */
+static bool ckb_pwr_quiet(const char *spec, const char *tz) {
+    ckb_pwr_t &p = _ckb_pwr;
+    const char *s = spec ? spec : "";
+    int16_t from = ckb_pwr_minutes(s);
+    int16_t to = *s == '-' ? ckb_pwr_minutes(++s) : -1;
+    bool ok = from >= 0 && to >= 0 && from != to && !*s;
+    p.quiet_from = ok ? from : -1;
+    p.quiet_to   = ok ? to   : -1;
+    setenv("TZ", tz && tz[0] ? tz : "UTC0", 1);
+    tzset();
+    return ok;
+}
+
+/* Tip timestamp after a good poll */
+static void ckb_pwr_clock(uint64_t utc_ms, uint32_t now) {
+    if (!utc_ms) return;
+    _ckb_pwr.utc_ms = utc_ms;
+    _ckb_pwr.utc_at = now;
+    _ckb_pwr.info.clock = true;
+}
+
+static bool ckb_pwr_in_quiet(uint32_t now) {
+    const ckb_pwr_t &p = _ckb_pwr;
+    if (p.quiet_from < 0 || !p.info.clock) return false;
+    time_t t = (time_t)((p.utc_ms + (uint32_t)(now - p.utc_at)) / 1000);
+    struct tm lt;
+    localtime_r(&t, &lt);
+    int16_t m = (int16_t)(lt.tm_hour * 60 + lt.tm_min);
+    return p.quiet_from < p.quiet_to ? m >= p.quiet_from && m < p.quiet_to
+                                     : m >= p.quiet_from || m < p.quiet_to;
+}
+
+/* ── State machine (loop task) ─────────────────────────────────── */
+static void ckb_pwr_account(uint32_t now) {
+    ckb_pwr_t &p = _ckb_pwr;
+    p.info.ms[p.info.state] += (uint32_t)(now - p.since);
+    p.since = now;
+}
+
+static void ckb_pwr_enter(uint8_t s, uint32_t now) {
+    ckb_pwr_t &p = _ckb_pwr;
+    ckb_pwr_account(now);
+    uint8_t from = p.info.state;
+    p.info.state = s;
+    if (s == CKB_PWR_QUIET) {
+        ckb_pwr_backlight(0);
+        if (p.pause) p.pause();
+    } else {
+        uint8_t duty = s == CKB_PWR_ACTIVE ? CKB_PWR_BRIGHT : CKB_PWR_DIM;
+        if (from == CKB_PWR_QUIET && p.resume) {
+            uint32_t t0 = micros();
+            p.resume();
+            vTaskDelay(pdMS_TO_TICKS(CKB_PWR_FRAME_MS));   /* a clean frame first */
+            ckb_pwr_backlight(duty);
+            uint32_t us = micros() - t0;
+            p.info.resume_us = us;
+            if (us > p.info.resume_max_us) p.info.resume_max_us = us;
+            if (us > CKB_PWR_RESUME_US) p.info.slow_resumes++;
+        } else {
+            ckb_pwr_backlight(duty);
+        }
+    }
+    Serial.printf("[pwr] %s -> %s\n", ckb_pwr_state_name(from), ckb_pwr_state_name(s));
+}
+
+/* Touch or new block: panel on (dimmed) for hold_ms, if it is off or dimmed */
+static void ckb_pwr_wake(uint8_t src, uint32_t hold_ms, uint32_t now) {
+    ckb_pwr_t &p = _ckb_pwr;
+    if (!hold_ms || p.info.state == CKB_PWR_ACTIVE) return;
+    if (src == CKB_PWR_WAKE_BLOCK && p.info.state == CKB_PWR_QUIET) {
+        if (p.info.wakes[src] && now - p.block_wake_at < CKB_PWR_BLOCK_GAP_MS) return;
+        p.block_wake_at = now;
+    }
+    if ((int32_t)(now + hold_ms - p.woken_until) > 0 || p.info.state == CKB_PWR_QUIET)
+        p.woken_until = now + hold_ms;
+    if (p.info.state == CKB_PWR_QUIET) {
+        p.info.wakes[src]++;
+        ckb_pwr_enter(CKB_PWR_WOKEN, now);
+        Serial.printf("[pwr] woken by %s, panel up in %lu us\n",
+            ckb_pwr_wake_name(src), (unsigned long)p.info.resume_us);
+    }
+}
+
+static void ckb_pwr_busy(uint32_t ms) {
+    _ckb_pwr.info.busy_ms[_ckb_pwr.info.state] += ms;
+}
+
+static void ckb_pwr_tick(uint32_t now) {
+    ckb_pwr_t &p = _ckb_pwr;
+    bool quiet = ckb_pwr_in_quiet(now);
+    switch (p.info.state) {
+        case CKB_PWR_ACTIVE:
+            if (quiet) ckb_pwr_enter(CKB_PWR_QUIET, now);
+            break;
+        case CKB_PWR_QUIET:
+            if (!quiet) ckb_pwr_enter(CKB_PWR_ACTIVE, now);
+            break;
+        case CKB_PWR_WOKEN:
+            if ((int32_t)(now - p.woken_until) >= 0)
+                ckb_pwr_enter(quiet ? CKB_PWR_QUIET : CKB_PWR_ACTIVE, now);
+            break;
+    }
+    ckb_pwr_account(now);
+    portENTER_CRITICAL(&_ckb_pwr_mux);
+    _ckb_pwr_pub = p.info;
+    portEXIT_CRITICAL(&_ckb_pwr_mux);
+}
+
+/* Task delay: as asked, but at least CKB_PWR_TICK_MS while the panel is off */
+static uint32_t ckb_pwr_tick_ms(uint32_t ms) {
+    return _ckb_pwr.info.state == CKB_PWR_QUIET && ms < CKB_PWR_TICK_MS ? CKB_PWR_TICK_MS : ms;
+}
+
+static void ckb_pwr_copy(ckb_pwr_info_t *out) {
+    portENTER_CRITICAL(&_ckb_pwr_mux);
+    *out = _ckb_pwr_pub;
+    portEXIT_CRITICAL(&_ckb_pwr_mux);
+}
+
+/* ── Setup ─────────────────────────────────────────────────────── */
+static void ckb_pwr_begin(int8_t bl_pin, ckb_pwr_fn_t pause, ckb_pwr_fn_t resume) {
+    ckb_pwr_t &p = _ckb_pwr;
+    p.pause = pause;
+    p.resume = resume;
+    p.since = millis();
+    ledcSetup(CKB_PWR_LEDC_CH, 20000, 8);
+    ledcAttachPin(bl_pin, CKB_PWR_LEDC_CH);
+    ckb_pwr_backlight(0);
+
+#if CONFIG_PM_ENABLE
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_pm_config_t pm = {};
+#else
+    esp_pm_config_esp32s3_t pm = {};
+#endif
+    pm.max_freq_mhz = CKB_PWR_MAX_MHZ;
+    pm.min_freq_mhz = CKB_PWR_MIN_MHZ;
+    pm.light_sleep_enable = true;
+    if (esp_pm_configure(&pm) == ESP_OK) {
+        p.info.pm = CKB_PWR_PM_SLEEP;
+        /* Serial config sessions wake the chip; the bytes that do are lost */
+        uart_set_wakeup_threshold(UART_NUM_0, 3);
+        esp_sleep_enable_uart_wakeup(UART_NUM_0);
+    } else {
+        pm.light_sleep_enable = false;
+        if (esp_pm_configure(&pm) == ESP_OK) p.info.pm = CKB_PWR_PM_DFS;
+    }
+#endif
+    Serial.printf("[pwr] power management: %s\n", ckb_pwr_pm_name(p.info.pm));
+}
@@ -0,0 +1,227 @@
+/*
+ * ckb_screen.h — Tiled framebuffer snapshots with delta encoding
+ * ==============================================================
+ * Backs GET /screen. The RGB565 framebuffer is cut into 32×32 tiles; each
+ * tile keeps a hash and the scan sequence number at which it last
+ * changed. A client that remembers the sequence number of its previous
+ * snapshot gets back only the tiles that changed since then.
+ *
+ * The framebuffer is only read here, one tile row at a time, with a yield
+ * in between so the PSRAM bus is shared fairly with the LCD DMA and the
+ * render loop never waits on a snapshot.
+ *
+ * Stream format (little-endian):
+ *   header  "CKBS" u8 version, u8 tile, u8 flags, u8 0,
+ *           u16 width, u16 height, u32 session, u32 seq, u16 tile_count
+ *   tile    u16 index, u16 length, length bytes of RLE
+ *   RLE     u8 h; h & 0x80 → (h & 0x7F) + 1 copies of the next u16 pixel,
+ *           else h + 1 literal u16 pixels follow
+ * flags bit 0 = full frame (client discards what it has). session changes
+ * on every boot; a stale session or sequence number gets a full frame.
+ * tools/screen_fetch.py is the reference client.
+ *
+ * Usage:
+ *   ckb_screen_begin(gfx->getFramebuffer(), W, H);   // once
+ *   uint32_t seq = ckb_screen_scan();                 // per request
+ *   for (i...) if (ckb_screen_changed(i, since)) len = ckb_screen_encode(i, buf);
+ */
+
+#pragma once
+
+#if defined(ESP32)
+#include <Arduino.h>
+#include <esp_random.h>
+#else
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#endif
+
+#define CKB_SCREEN_TILE       32
+#define CKB_SCREEN_MAX_TILES  256
+#define CKB_SCREEN_VERSION    1
+#define CKB_SCREEN_HDR_LEN    24
+#define CKB_SCREEN_FLAG_FULL  0x01
+/* Worst case tile: all literals, one header byte per 128 pixels, + index/length */
+#define CKB_SCREEN_TILE_MAX   (4 + CKB_SCREEN_TILE * CKB_SCREEN_TILE * 2 + \
+                               (CKB_SCREEN_TILE * CKB_SCREEN_TILE + 127) / 128)
+
+struct ckb_screen_t {
+    const uint16_t *fb;
+    uint16_t w, h;
+    uint8_t  tiles_x, tiles_y;
+    uint32_t session;
+    uint32_t seq;                               /* last scan that saw a change */
+    uint32_t hash[CKB_SCREEN_MAX_TILES];
+    uint32_t changed[CKB_SCREEN_MAX_TILES];     /* seq at which each tile last changed */
+};
+
+static ckb_screen_t _ckb_screen = {};
+
+static void ckb_screen_yield() {
+#if defined(ESP32)
+    vTaskDelay(1);
+#endif
+}
+
+/* ── Setup ─────────────────────────────────────────────────────── */
+static bool ckb_screen_begin(const uint16_t *fb, uint16_t w, uint16_t h) {
+    ckb_screen_t &s = _ckb_screen;
+    uint16_t tx = (w + CKB_SCREEN_TILE - 1) / CKB_SCREEN_TILE;
+    uint16_t ty = (h + CKB_SCREEN_TILE - 1) / CKB_SCREEN_TILE;
+    if (!fb || tx * ty > CKB_SCREEN_MAX_TILES) return false;
+    memset(&s, 0, sizeof(s));
+    s.fb = fb;
+    s.w = w;
+    s.h = h;
+    s.tiles_x = tx;
+    s.tiles_y = ty;
+#if defined(ESP32)
+    s.session = esp_random();
+#else
+    s.session = (uint32_t)rand();
+#endif
+    return true;
+}
+
+static uint16_t ckb_screen_tiles() {
+    return (uint16_t)_ckb_screen.tiles_x * _ckb_screen.tiles_y;
+}
+
+/* Tile pixel bounds */
+static void ckb_screen_tile_rect(uint16_t i, uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h) {
+    const ckb_screen_t &s = _ckb_screen;
+    *x = (i % s.tiles_x) * CKB_SCREEN_TILE;
+    *y = (i / s.tiles_x) * CKB_SCREEN_TILE;
+    *w = (s.w - *x < CKB_SCREEN_TILE) ? s.w - *x : CKB_SCREEN_TILE;
+    *h = (s.h - *y < CKB_SCREEN_TILE) ? s.h - *y : CKB_SCREEN_TILE;
+}
+
+/* ── Scan: hash every tile, stamp the ones that changed ────────── */
+static uint32_t ckb_screen_hash_tile(uint16_t i) {
+    const ckb_screen_t &s = _ckb_screen;
+    uint16_t x, y, w, h;
+    ckb_screen_tile_rect(i, &x, &y, &w, &h);
+    uint32_t hash = 2166136261u;                     /* FNV-1a over 32-bit pixel pairs */
+    const uint16_t *row = s.fb + (uint32_t)y * s.w + x;
+    for (uint16_t r = 0; r < h; r++, row += s.w) {
+        for (uint16_t c = 0; c + 1 < w; c += 2) {
+            hash ^= (uint32_t)row[c] | ((uint32_t)row[c + 1] << 16);
+            hash *= 16777619u;
+        }
+        if (w & 1) {
+            hash ^= row[w - 1];
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+/* Returns the sequence number a client should send back as ?since= */
+static uint32_t ckb_screen_scan() {
+    ckb_screen_t &s = _ckb_screen;
+    if (!s.fb) return 0;
+    uint32_t next = s.seq + 1;
+    bool any = false;
+    for (uint8_t ty = 0; ty < s.tiles_y; ty++) {
+        for (uint8_t tx = 0; tx < s.tiles_x; tx++) {
+            uint16_t i = (uint16_t)ty * s.tiles_x + tx;
+            uint32_t hash = ckb_screen_hash_tile(i);
+            if (hash != s.hash[i] || s.changed[i] == 0) {
+                s.hash[i] = hash;
+                s.changed[i] = next;
+                any = true;
+            }
+        }
+        ckb_screen_yield();                          /* one tile row per slice */
+    }
+    if (any) s.seq = next;
+    return s.seq;
+}
+
+/* Does the client need tile i? since == 0 means it has nothing */
+static bool ckb_screen_changed(uint16_t i, uint32_t since) {
+    return since == 0 || _ckb_screen.changed[i] > since;
+}
+
+/* Resolve what the client asked for: 0 = send a full frame */
+static uint32_t ckb_screen_since(uint32_t session, uint32_t since) {
+    const ckb_screen_t &s = _ckb_screen;
+    if (session != s.session || since > s.seq) return 0;
+    return since;
+}
+
+static uint16_t ckb_screen_count(uint32_t since) {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < ckb_screen_tiles(); i++)
+        if (ckb_screen_changed(i, since)) n++;
+    return n;
+}
+
+/* ── Encoding ──────────────────────────────────────────────────── */
+static void ckb_screen_put16(uint8_t *p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static void ckb_screen_put32(uint8_t *p, uint32_t v) {
+    ckb_screen_put16(p, (uint16_t)v);
+    ckb_screen_put16(p + 2, (uint16_t)(v >> 16));
+}
+
+static size_t ckb_screen_header(uint8_t *out, uint32_t since, uint16_t count) {
+    const ckb_screen_t &s = _ckb_screen;
+    memcpy(out, "CKBS", 4);
+    out[4] = CKB_SCREEN_VERSION;
+    out[5] = CKB_SCREEN_TILE;
+    out[6] = since == 0 ? CKB_SCREEN_FLAG_FULL : 0;
+    out[7] = 0;
+    ckb_screen_put16(out + 8, s.w);
+    ckb_screen_put16(out + 10, s.h);
+    ckb_screen_put32(out + 12, s.session);
+    ckb_screen_put32(out + 16, s.seq);
+    ckb_screen_put16(out + 20, count);
+    out[22] = out[23] = 0;
+    return CKB_SCREEN_HDR_LEN;
+}
+
+/* Encode tile i (index, length, RLE) into out[CKB_SCREEN_TILE_MAX] */
+static size_t ckb_screen_encode(uint16_t i, uint8_t *out) {
+    const ckb_screen_t &s = _ckb_screen;
+    uint16_t x, y, w, h;
+    ckb_screen_tile_rect(i, &x, &y, &w, &h);
+
+    /* Copy the tile out of PSRAM once, row by row */
+    uint16_t px[CKB_SCREEN_TILE * CKB_SCREEN_TILE];
+    const uint16_t *row = s.fb + (uint32_t)y * s.w + x;
+    for (uint16_t r = 0; r < h; r++, row += s.w)
+        memcpy(px + r * w, row, w * 2);
+    uint16_t n = w * h;
+
+    uint8_t *p = out + 4;
+    uint16_t k = 0;
+    while (k < n) {
+        uint16_t run = 1;
+        while (k + run < n && run < 128 && px[k + run] == px[k]) run++;
+        if (run >= 2) {
+            *p++ = 0x80 | (run - 1);
+            ckb_screen_put16(p, px[k]);
+            p += 2;
+            k += run;
+            continue;
+        }
+        /* Literal block up to the next run of two or more */
+        uint16_t lit = 1;
+        while (k + lit < n && lit < 128 &&
+               !(k + lit + 1 < n && px[k + lit] == px[k + lit + 1])) lit++;
+        *p++ = lit - 1;
+        for (uint16_t j = 0; j < lit; j++, p += 2)
+            ckb_screen_put16(p, px[k + j]);
+        k += lit;
+    }
+
+    size_t len = p - out;
+    ckb_screen_put16(out, i);
+    ckb_screen_put16(out + 2, (uint16_t)(len - 4));
+    return len;
+}
+
+static uint32_t ckb_screen_session() {
+    return _ckb_screen.session;
+}
@@ -0,0 +1,196 @@
+/*
+ * ckb_snapshot.h — Last-known chain state across reboots
+ * ======================================================
+ * Lets the dashboard come up showing the figures it had before a reset
+ * instead of a "connecting..." splash while WiFi joins and the first poll
+ * runs. After each good poll the app hands over its state. The module
+ * adds a compact history: the last CKB_SNAP_HIST headers from the header
+ * cache, as block number, timestamp delta and compact_target.
+ *
+ *   RTC memory  rewritten after every poll. It costs nothing and survives
+ *               resets, panics and watchdog reboots, but not a power cut.
+ *   NVS         for boots after a power cut. Writes are coalesced: the
+ *               first good poll of a boot is written, then at most one
+ *               write per CKB_SNAP_NVS_MS carrying the latest state. The
+ *               polls in between only reach RTC. A ~650 byte blob every
+ *               10 min wears the default 20 KB NVS partition by a few
+ *               erase cycles a day.
+ *
+ * At boot ckb_snap_load() takes the RTC copy if its CRC holds, else the NVS
+ * one. It skips records that were saved for another node list (FNV key)
+ * and replays the history into the hashrate ring (ckb_hashrate.h). The
+ * difficulty and hashrate tile therefore has figures before any RPC. The
+ * app draws those values greyed and marked stale until a poll succeeds,
+ * and records the boot-to-first-frame times here for /status and /metrics.
+ *
+ * Usage:
+ *   ckb_snap_state_t s;
+ *   if (ckb_snap_load(s, url)) ... draw s greyed ...
+ *   ckb_snap_store(s, url, millis());    // after every good poll
+ *   _ckb_snap.frame_ms / live_ms         // set by the app
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_attr.h>
+#include "ckb_headers.h"
+#include "ckb_hashrate.h"
+
+#ifndef CKB_SNAP_HIST
+#define CKB_SNAP_HIST     CKB_HR_WINDOW   /* block intervals kept */
+#endif
+#ifndef CKB_SNAP_NVS_MS
+#define CKB_SNAP_NVS_MS   600000          /* at most one flash write per 10 min */
+#endif
+#define CKB_SNAP_MAGIC    0xC4B5A9A1
+#define CKB_SNAP_VERSION  1
+
+enum { CKB_SNAP_NONE, CKB_SNAP_RTC, CKB_SNAP_NVS };
+
+/* ── What the app saves and gets back ──────────────────────────── */
+struct ckb_snap_state_t {
+    uint64_t height;
+    uint64_t block_ts_ms;
+    uint64_t epoch_num;
+    uint64_t best_known;
+    uint32_t peers;
+    uint32_t mempool_tx;
+    uint32_t epoch_idx;
+    uint32_t epoch_len;
+    char     node_id[20];
+};
+
+/* ── Stored record (RTC + NVS) ─────────────────────────────────── */
+struct ckb_snap_rec_t {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t hist_count;          /* headers in hist_*, base included */
+    uint32_t key;                 /* FNV-1a of the node URL / list */
+    uint32_t seq;                 /* stores since the record was created */
+    ckb_snap_state_t state;
+    uint64_t hist_base;           /* number of the oldest header kept */
+    uint64_t hist_base_ts;        /* its timestamp, ms */
+    int32_t  hist_dt[CKB_SNAP_HIST + 1];       /* ms after the previous one */
+    uint32_t hist_compact[CKB_SNAP_HIST + 1];
+    uint32_t crc;
+};
+
+static RTC_NOINIT_ATTR ckb_snap_rec_t _ckb_snap_rtc;
+
+/* ── Telemetry ─────────────────────────────────────────────────── */
+struct ckb_snap_t {
+    uint8_t  source;              /* CKB_SNAP_*: where the boot state came from */
+    uint64_t restored_height;
+    uint16_t restored_hist;
+    uint32_t stores;              /* RTC writes (one per good poll) */
+    uint32_t nvs_writes;
+    uint32_t coalesced;           /* stores that did not reach flash */
+    uint32_t nvs_at;              /* millis() of the last NVS write, 0: none yet */
+    uint64_t nvs_height;          /* height in the last NVS write */
+    uint32_t frame_ms;            /* reset → first meaningful frame (stale or live) */
+    uint32_t live_ms;             /* reset → first frame from a live poll */
+};
+
+static ckb_snap_t _ckb_snap = {};
+
+static uint32_t ckb_snap_fnv(const uint8_t *p, size_t n, uint32_t h = 2166136261u) {
+    while (n--) h = (h ^ *p++) * 16777619u;
+    return h;
+}
+
+static uint32_t ckb_snap_crc(const ckb_snap_rec_t &r) {
+    return ckb_snap_fnv((const uint8_t *)&r, offsetof(ckb_snap_rec_t, crc));
+}
+
+static bool ckb_snap_ok(const ckb_snap_rec_t &r, uint32_t key) {
+    return r.magic == CKB_SNAP_MAGIC && r.version == CKB_SNAP_VERSION &&
+           r.hist_count <= CKB_SNAP_HIST + 1 && r.crc == ckb_snap_crc(r) && r.key == key;
+}
+
+static uint32_t ckb_snap_key(const char *url) {
+    return ckb_snap_fnv((const uint8_t *)url, strlen(url));
+}
+
+/* Rebuild the hashrate ring from the stored headers */
+static void ckb_snap_replay(const ckb_snap_rec_t &r) {
+    uint64_t ts = r.hist_base_ts;
+    for (uint16_t i = 0; i < r.hist_count; i++) {
+        ts += r.hist_dt[i];
+        ckb_hr_push(r.hist_base + i, ts, r.hist_compact[i]);
+    }
+}
+
+/* Boot: last-known state for this node list, false if there is none */
+static bool ckb_snap_load(ckb_snap_state_t &s, const char *url) {
+    uint32_t key = ckb_snap_key(url);
+    ckb_snap_t &t = _ckb_snap;
+    if (ckb_snap_ok(_ckb_snap_rtc, key)) {
+        t.source = CKB_SNAP_RTC;
+    } else {
+        Preferences prefs;
+        prefs.begin("ckbsnap", true);
+        bool got = prefs.getBytes("state", &_ckb_snap_rtc, sizeof(_ckb_snap_rtc)) == sizeof(_ckb_snap_rtc);
+        prefs.end();
+        if (!got || !ckb_snap_ok(_ckb_snap_rtc, key)) {
+            _ckb_snap_rtc.magic = 0;
+            return false;
+        }
+        t.source = CKB_SNAP_NVS;
+        t.nvs_height = _ckb_snap_rtc.state.height;
+    }
+    const ckb_snap_rec_t &r = _ckb_snap_rtc;
+    s = r.state;
+    t.restored_height = r.state.height;
+    t.restored_hist = r.hist_count;
+    ckb_snap_replay(r);
+    return true;
+}
+
+/* After a good poll: RTC every time, NVS coalesced (see above) */
+static void ckb_snap_store(const ckb_snap_state_t &s, const char *url, uint32_t now) {
+    ckb_snap_rec_t &r = _ckb_snap_rtc;
+    uint32_t key = ckb_snap_key(url);
+    if (r.magic != CKB_SNAP_MAGIC || r.key != key) r.seq = 0;
+    r.magic = CKB_SNAP_MAGIC;
+    r.version = CKB_SNAP_VERSION;
+    r.key = key;
+    r.seq++;
+    r.state = s;
+
+    /* History: the newest CKB_SNAP_HIST + 1 headers of the cache */
+    const ckb_hdr_cache_t &c = _ckb_hdr;
+    r.hist_count = 0;
+    if (c.count) {
+        uint64_t lo = c.hi - c.lo >= CKB_SNAP_HIST ? c.hi - CKB_SNAP_HIST : c.lo;
+        r.hist_base = lo;
+        r.hist_base_ts = ckb_hdr_by_number(lo)->timestamp;
+        uint64_t prev = r.hist_base_ts;
+        for (uint64_t n = lo; n <= c.hi; n++) {
+            const ckb_hdr_t *h = ckb_hdr_by_number(n);
+            r.hist_dt[r.hist_count] = (int32_t)(h->timestamp - prev);
+            r.hist_compact[r.hist_count++] = h->compact_target;
+            prev = h->timestamp;
+        }
+    }
+    r.crc = ckb_snap_crc(r);
+
+    ckb_snap_t &t = _ckb_snap;
+    t.stores++;
+    if ((t.nvs_at && now - t.nvs_at < CKB_SNAP_NVS_MS) || s.height == t.nvs_height) {
+        t.coalesced++;
+        return;
+    }
+    Preferences prefs;
+    prefs.begin("ckbsnap", false);
+    prefs.putBytes("state", &r, sizeof(r));
+    prefs.end();
+    t.nvs_writes++;
+    t.nvs_at = now ? now : 1;
+    t.nvs_height = s.height;
+}
+
+static const char *ckb_snap_source_name(uint8_t s) {
+    return s == CKB_SNAP_RTC ? "rtc" : s == CKB_SNAP_NVS ? "nvs" : "none";
+}
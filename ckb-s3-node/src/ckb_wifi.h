@@ -0,0 +1,430 @@
+/*
+ * ckb_wifi.h — Fast WiFi connect and background reconnect
+ * ========================================================
+ * Replaces the blocking connect loop. A small task on core 0 runs the
+ * station through a state machine driven by WiFi events, so setup() and
+ * the render loop never wait on the radio:
+ *
+ *   CONNECTING ──got IP──▶ UP ──disconnect──▶ CONNECTING (fast path)
+ *       │                                          │
+ *       └──timeout / refused──▶ BACKOFF ◀──────────┘
+ *                                  │ 1 s, 2 s, 4 s … CKB_WIFI_BACKOFF_MAX_MS
+ *                                  └──▶ CONNECTING
+ *
+ * Fast path: the last association (BSSID, channel) and IP settings are
+ * cached in RTC memory, which survives resets, and in NVS for boots
+ * after a power cut. NVS is only written when the cached values change.
+ * With a cache the station skips the scan and joins the known AP on its
+ * channel. It also reuses the last DHCP lease as a static config, so
+ * there is no DHCP round trip either. If the fast
+ * attempt fails within CKB_WIFI_FAST_MS, a full scan + DHCP attempt
+ * follows at once.
+ *
+ * A reused lease is handed back to DHCP after CKB_WIFI_LEASE_HOLD_MS of
+ * uptime. Every CKB_WIFI_LEASE_BOOTS fast boots, one boot uses DHCP from
+ * the start. Together these keep a unit from holding an address the
+ * router has since given to someone else. With CKB_WIFI_STATIC_IP set
+ * ("ip,gateway,mask,dns") DHCP is never used.
+ *
+ * Telemetry: boot-to-connected time (millis() since reset), the time
+ * the last attempt took and which path it used, and connect / fast /
+ * failure / disconnect counts plus total downtime.
+ *
+ * Usage:
+ *   ckb_wifi_begin(ssid, pass);          // returns at once
+ *   if (ckb_wifi_up()) ...
+ *   static ckb_wifi_info_t w; ckb_wifi_copy(&w);   // /status, /metrics
+ *   ckb_wifi_set(ssid, pass);            // new credentials: rejoin in the background
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+
+#ifndef CKB_WIFI_FAST_MS
+#define CKB_WIFI_FAST_MS         2500    /* cached BSSID + lease: association and IP */
+#endif
+#ifndef CKB_WIFI_FULL_MS
+#define CKB_WIFI_FULL_MS         15000   /* scan + DHCP */
+#endif
+#ifndef CKB_WIFI_BACKOFF_MS
+#define CKB_WIFI_BACKOFF_MS      1000
+#endif
+#ifndef CKB_WIFI_BACKOFF_MAX_MS
+#define CKB_WIFI_BACKOFF_MAX_MS  30000
+#endif
+#ifndef CKB_WIFI_LEASE_HOLD_MS
+#define CKB_WIFI_LEASE_HOLD_MS   600000  /* reused lease → DHCP after 10 min up */
+#endif
+#ifndef CKB_WIFI_LEASE_BOOTS
+#define CKB_WIFI_LEASE_BOOTS     4
+#endif
+#define CKB_WIFI_TICK_MS         50
+#define CKB_WIFI_MAGIC           0xC4B1F1A5
+
+enum { CKB_WIFI_CONNECTING, CKB_WIFI_UP, CKB_WIFI_BACKOFF };
+enum { CKB_WIFI_PATH_FULL, CKB_WIFI_PATH_FAST, CKB_WIFI_PATH_LEASE, CKB_WIFI_PATH_STATIC };
+
+/* ── Association cache (RTC + NVS) ─────────────────────────────── */
+struct ckb_wifi_cache_t {
+    uint32_t magic;
+    uint32_t key;            /* FNV-1a of ssid + pass: new credentials, no cache */
+    uint8_t  bssid[6];
+    uint8_t  channel;
+    uint8_t  lease_boots;    /* boots in a row that reused the lease */
+    uint32_t ip, gw, mask, dns;
+    uint32_t crc;
+};
+
+static RTC_NOINIT_ATTR ckb_wifi_cache_t _ckb_wifi_rtc;
+
+/* ── What /metrics and /status see ─────────────────────────────── */
+struct ckb_wifi_info_t {
+    uint8_t  state;
+    uint8_t  path;           /* how the last connect was made */
+    uint8_t  channel;
+    int8_t   rssi;
+    uint32_t boot_ms;        /* reset → first IP, 0 until then */
+    uint32_t connect_ms;     /* last attempt start → IP */
+    uint32_t connects;
+    uint32_t fast;           /* connects that skipped the scan */
+    uint32_t failures;       /* attempts that timed out or were refused */
+    uint32_t disconnects;
+    uint32_t down_ms;        /* total time without IP after the first connect */
+    uint8_t  reason;         /* last disconnect reason (wifi_err_reason_t) */
+};
+
+struct ckb_wifi_t {
+    char     ssid[64];
+    char     pass[64];
+    ckb_wifi_cache_t cache;
+    bool     have_cache;
+    bool     have_static;
+    uint32_t static_ip[4];   /* ip, gw, mask, dns */
+    uint8_t  path;           /* of the attempt in flight */
+    uint32_t t0;             /* attempt start */
+    uint32_t backoff_ms;
+    uint32_t retry_at;
+    uint32_t up_at;
+    uint32_t down_at;
+    /* Set by the event callback, consumed by the task */
+    volatile bool ev_connected, ev_got_ip, ev_lost;
+    volatile uint8_t ev_reason;
+    uint8_t  ev_bssid[6];
+    volatile uint8_t ev_channel;
+    /* Credentials waiting for the task (ckb_wifi_set) */
+    char     next_ssid[64];
+    char     next_pass[64];
+    bool     next_set;
+    ckb_wifi_info_t info;
+};
+
+static ckb_wifi_t       _ckb_wifi = {};
+static ckb_wifi_info_t  _ckb_wifi_pub = {};
+static portMUX_TYPE     _ckb_wifi_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t ckb_wifi_fnv(const uint8_t *p, size_t n, uint32_t h = 2166136261u) {
+    while (n--) h = (h ^ *p++) * 16777619u;
+    return h;
+}
+
+static uint32_t ckb_wifi_key() {
+    uint32_t h = ckb_wifi_fnv((const uint8_t *)_ckb_wifi.ssid, strlen(_ckb_wifi.ssid));
+    return ckb_wifi_fnv((const uint8_t *)_ckb_wifi.pass, strlen(_ckb_wifi.pass), h);
+}
+
+static uint32_t ckb_wifi_crc(const ckb_wifi_cache_t &c) {
+    return ckb_wifi_fnv((const uint8_t *)&c, offsetof(ckb_wifi_cache_t, crc));
+}
+
+static bool ckb_wifi_cache_ok(const ckb_wifi_cache_t &c) {
+    return c.magic == CKB_WIFI_MAGIC && c.crc == ckb_wifi_crc(c) &&
+           c.key == ckb_wifi_key() && c.channel >= 1 && c.channel <= 14;
+}
+
+/* RTC first (no flash read); NVS after a power cut */
+static void ckb_wifi_cache_load() {
+    ckb_wifi_t &w = _ckb_wifi;
+    if (ckb_wifi_cache_ok(_ckb_wifi_rtc)) {
+        w.cache = _ckb_wifi_rtc;
+        w.have_cache = true;
+        return;
+    }
+    Preferences prefs;
+    prefs.begin("ckbwifi", true);
+    w.have_cache = prefs.getBytes("cache", &w.cache, sizeof(w.cache)) == sizeof(w.cache) &&
+                   ckb_wifi_cache_ok(w.cache);
+    prefs.end();
+    if (w.have_cache) _ckb_wifi_rtc = w.cache;
+}
+
+/* RTC always; NVS only when a value moved, so a unit that keeps
+ * rejoining the same AP with the same lease doesn't wear the flash.
+ * The lease counter has to reach NVS: power cuts are the common reboot. */
+static void ckb_wifi_cache_store(const ckb_wifi_cache_t &c) {
+    ckb_wifi_t &w = _ckb_wifi;
+    bool changed = !w.have_cache || memcmp(w.cache.bssid, c.bssid, 6) != 0 ||
+                   w.cache.channel != c.channel || w.cache.lease_boots != c.lease_boots ||
+                   w.cache.ip != c.ip || w.cache.gw != c.gw || w.cache.mask != c.mask ||
+                   w.cache.dns != c.dns;
+    w.cache = c;
+    w.cache.magic = CKB_WIFI_MAGIC;
+    w.cache.key = ckb_wifi_key();
+    w.cache.crc = ckb_wifi_crc(w.cache);
+    w.have_cache = true;
+    _ckb_wifi_rtc = w.cache;
+    if (!changed) return;
+    Preferences prefs;
+    prefs.begin("ckbwifi", false);
+    prefs.putBytes("cache", &w.cache, sizeof(w.cache));
+    prefs.end();
+}
+
+static void ckb_wifi_cache_drop() {
+    _ckb_wifi.have_cache = false;
+    _ckb_wifi_rtc.magic = 0;
+}
+
+/* ── Events (WiFi event task) ──────────────────────────────────── */
+static void ckb_wifi_event(arduino_event_id_t event, arduino_event_info_t info) {
+    ckb_wifi_t &w = _ckb_wifi;
+    switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_CONNECTED:
+        memcpy(w.ev_bssid, info.wifi_sta_connected.bssid, 6);
+        w.ev_channel = info.wifi_sta_connected.channel;
+        w.ev_connected = true;
+        break;
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+        w.ev_got_ip = true;
+        break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+        /* Our own disconnect before a new attempt says nothing about it */
+        if (info.wifi_sta_disconnected.reason == WIFI_REASON_ASSOC_LEAVE &&
+            w.info.state == CKB_WIFI_CONNECTING) break;
+        w.ev_reason = info.wifi_sta_disconnected.reason;
+        w.ev_lost = true;
+        break;
+    case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+        w.ev_lost = true;
+        break;
+    default:
+        break;
+    }
+}
+
+/* ── State machine (its own task) ──────────────────────────────── */
+static void ckb_wifi_publish() {
+    _ckb_wifi.info.rssi = _ckb_wifi.info.state == CKB_WIFI_UP ? (int8_t)WiFi.RSSI() : 0;
+    portENTER_CRITICAL(&_ckb_wifi_mux);
+    _ckb_wifi_pub = _ckb_wifi.info;
+    portEXIT_CRITICAL(&_ckb_wifi_mux);
+}
+
+static void ckb_wifi_attempt(bool fast) {
+    ckb_wifi_t &w = _ckb_wifi;
+    const ckb_wifi_cache_t &c = w.cache;
+    fast = fast && w.have_cache;
+    w.ev_connected = w.ev_got_ip = w.ev_lost = false;
+
+    if (w.have_static) {
+        WiFi.config(IPAddress(w.static_ip[0]), IPAddress(w.static_ip[1]),
+                    IPAddress(w.static_ip[2]), IPAddress(w.static_ip[3]));
+        w.path = CKB_WIFI_PATH_STATIC;
+    } else if (fast && c.ip && c.lease_boots < CKB_WIFI_LEASE_BOOTS) {
+        WiFi.config(IPAddress(c.ip), IPAddress(c.gw), IPAddress(c.mask), IPAddress(c.dns));
+        w.path = CKB_WIFI_PATH_LEASE;
+    } else {
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);   /* DHCP */
+        w.path = fast ? CKB_WIFI_PATH_FAST : CKB_WIFI_PATH_FULL;
+    }
+    if (fast) WiFi.begin(w.ssid, w.pass, c.channel, c.bssid, true);
+    else      WiFi.begin(w.ssid, w.pass);
+    w.t0 = millis();
+    w.info.state = CKB_WIFI_CONNECTING;
+}
+
+static void ckb_wifi_up_now(uint32_t now) {
+    ckb_wifi_t &w = _ckb_wifi;
+    ckb_wifi_info_t &n = w.info;
+    n.state = CKB_WIFI_UP;
+    n.path = w.path;
+    n.channel = w.ev_channel;
+    n.connect_ms = now - w.t0;
+    n.connects++;
+    if (w.path != CKB_WIFI_PATH_FULL) n.fast++;
+    if (!n.boot_ms) n.boot_ms = now;
+    else n.down_ms += now - w.down_at;
+    w.backoff_ms = CKB_WIFI_BACKOFF_MS;
+    w.up_at = now;
+
+    ckb_wifi_cache_t c = {};
+    memcpy(c.bssid, w.ev_bssid, 6);
+    c.channel = w.ev_channel;
+    c.ip   = (uint32_t)WiFi.localIP();
+    c.gw   = (uint32_t)WiFi.gatewayIP();
+    c.mask = (uint32_t)WiFi.subnetMask();
+    c.dns  = (uint32_t)WiFi.dnsIP();
+    c.lease_boots = w.path == CKB_WIFI_PATH_LEASE ? w.cache.lease_boots + 1 : 0;
+    ckb_wifi_cache_store(c);
+
+    Serial.printf("[WiFi] %s, ch %u, %s in %lu ms (boot +%lu ms)\n",
+        WiFi.localIP().toString().c_str(), (unsigned)n.channel,
+        w.path == CKB_WIFI_PATH_FULL ? "scan + DHCP" : w.path == CKB_WIFI_PATH_FAST ? "cached AP + DHCP" :
+        w.path == CKB_WIFI_PATH_LEASE ? "cached AP + lease" : "cached AP + static IP",
+        (unsigned long)n.connect_ms, (unsigned long)now);
+}
+
+static void ckb_wifi_step(uint32_t now) {
+    ckb_wifi_t &w = _ckb_wifi;
+    ckb_wifi_info_t &n = w.info;
+    switch (n.state) {
+    case CKB_WIFI_CONNECTING: {
+        if (w.ev_got_ip && WiFi.status() == WL_CONNECTED) {
+            w.ev_lost = false;
+            ckb_wifi_up_now(now);
+            break;
+        }
+        bool fast = w.path != CKB_WIFI_PATH_FULL;
+        uint32_t limit = fast && w.path != CKB_WIFI_PATH_STATIC ? CKB_WIFI_FAST_MS : CKB_WIFI_FULL_MS;
+        if (!w.ev_lost && now - w.t0 < limit) break;
+        n.failures++;
+        if (w.ev_lost) n.reason = w.ev_reason;
+        Serial.printf("[WiFi] attempt failed after %lu ms (reason %u)\n",
+            (unsigned long)(now - w.t0), (unsigned)n.reason);
+        WiFi.disconnect(false, false);
+        if (fast && w.path != CKB_WIFI_PATH_STATIC) {
+            /* AP moved channel, was replaced, or the lease went stale: full join now */
+            ckb_wifi_cache_drop();
+            ckb_wifi_attempt(false);
+            break;
+        }
+        w.retry_at = now + w.backoff_ms + esp_random() % (w.backoff_ms / 4 + 1);
+        w.backoff_ms = w.backoff_ms * 2 > CKB_WIFI_BACKOFF_MAX_MS ? CKB_WIFI_BACKOFF_MAX_MS : w.backoff_ms * 2;
+        n.state = CKB_WIFI_BACKOFF;
+        break;
+    }
+    case CKB_WIFI_UP:
+        if (w.ev_lost || WiFi.status() != WL_CONNECTED) {
+            n.disconnects++;
+            n.reason = w.ev_reason;
+            w.down_at = now;
+            Serial.printf("[WiFi] lost (reason %u), rejoining\n", (unsigned)n.reason);
+            ckb_wifi_attempt(true);
+        } else if (w.path == CKB_WIFI_PATH_LEASE && now - w.up_at >= CKB_WIFI_LEASE_HOLD_MS) {
+            /* Hand the borrowed lease back to DHCP; the router normally
+             * answers with the same address, so this is a blip */
+            Serial.println("[WiFi] reused lease: renewing via DHCP");
+            w.ev_got_ip = false;
+            w.path = CKB_WIFI_PATH_FAST;
+            w.t0 = w.down_at = now;
+            WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+            n.state = CKB_WIFI_CONNECTING;
+        }
+        break;
+    case CKB_WIFI_BACKOFF:
+        if ((int32_t)(now - w.retry_at) >= 0) ckb_wifi_attempt(true);
+        break;
+    }
+}
+
+/* New credentials: the old cache can't apply, so a full join at once */
+static void ckb_wifi_take_credentials(uint32_t now) {
+    ckb_wifi_t &w = _ckb_wifi;
+    portENTER_CRITICAL(&_ckb_wifi_mux);
+    bool set = w.next_set;
+    if (set) {
+        memcpy(w.ssid, w.next_ssid, sizeof(w.ssid));
+        memcpy(w.pass, w.next_pass, sizeof(w.pass));
+        w.next_set = false;
+    }
+    portEXIT_CRITICAL(&_ckb_wifi_mux);
+    if (!set) return;
+    Serial.printf("[WiFi] new credentials for %s, rejoining\n", w.ssid);
+    if (w.info.state == CKB_WIFI_UP) w.down_at = now;
+    ckb_wifi_cache_drop();
+    WiFi.disconnect(false, false);
+    w.backoff_ms = CKB_WIFI_BACKOFF_MS;
+    ckb_wifi_attempt(false);
+}
+
+static void ckb_wifi_task(void *) {
+    uint8_t last = 0xFF;
+    uint32_t tick = 0;
+    for (;;) {
+        ckb_wifi_take_credentials(millis());
+        ckb_wifi_step(millis());
+        if (_ckb_wifi.info.state != last || ++tick % (1000 / CKB_WIFI_TICK_MS) == 0) {
+            last = _ckb_wifi.info.state;
+            ckb_wifi_publish();
+        }
+        vTaskDelay(pdMS_TO_TICKS(CKB_WIFI_TICK_MS));
+    }
+}
+
+/* ── Public API ────────────────────────────────────────────────── */
+static bool ckb_wifi_begin(const char *ssid, const char *pass, uint8_t core = 0) {
+    ckb_wifi_t &w = _ckb_wifi;
+    snprintf(w.ssid, sizeof(w.ssid), "%s", ssid);
+    snprintf(w.pass, sizeof(w.pass), "%s", pass);
+    w.backoff_ms = CKB_WIFI_BACKOFF_MS;
+#if defined(CKB_WIFI_STATIC_IP)
+    {
+        char list[] = CKB_WIFI_STATIC_IP;
+        char *save = nullptr;
+        uint8_t k = 0;
+        for (char *t = strtok_r(list, ",", &save); t && k < 4; t = strtok_r(nullptr, ",", &save)) {
+            IPAddress a;
+            if (!a.fromString(t)) break;
+            w.static_ip[k++] = (uint32_t)a;
+        }
+        w.have_static = k == 4;
+    }
+#endif
+    ckb_wifi_cache_load();
+    Serial.printf("[WiFi] %s: %s\n", w.ssid,
+        w.have_cache ? "cached AP, fast join" : "no cache, scanning");
+
+    WiFi.persistent(false);        /* the cache above replaces the driver's own flash copy */
+    WiFi.setAutoReconnect(false);  /* the task reconnects, with backoff */
+    WiFi.mode(WIFI_STA);
+    WiFi.onEvent(ckb_wifi_event);
+    ckb_wifi_attempt(true);
+    ckb_wifi_publish();
+    return xTaskCreatePinnedToCore(ckb_wifi_task, "wifi", 4096, nullptr, 1, nullptr, core) == pdPASS;
+}
+
+/* Any task; returns at once */
+static void ckb_wifi_set(const char *ssid, const char *pass) {
+    ckb_wifi_t &w = _ckb_wifi;
+    char s[sizeof(w.next_ssid)], p[sizeof(w.next_pass)];
+    snprintf(s, sizeof(s), "%s", ssid);
+    snprintf(p, sizeof(p), "%s", pass);
+    portENTER_CRITICAL(&_ckb_wifi_mux);
+    memcpy(w.next_ssid, s, sizeof(s));
+    memcpy(w.next_pass, p, sizeof(p));
+    w.next_set = true;
+    portEXIT_CRITICAL(&_ckb_wifi_mux);
+}
+
+static bool ckb_wifi_up() {
+    return _ckb_wifi.info.state == CKB_WIFI_UP;
+}
+
+static void ckb_wifi_copy(ckb_wifi_info_t *out) {
+    portENTER_CRITICAL(&_ckb_wifi_mux);
+    *out = _ckb_wifi_pub;
+    portEXIT_CRITICAL(&_ckb_wifi_mux);
+}
+
+static const char *ckb_wifi_path_name(uint8_t p) {
+    return p == CKB_WIFI_PATH_FULL ? "scan" : p == CKB_WIFI_PATH_FAST ? "fast" :
+           p == CKB_WIFI_PATH_LEASE ? "lease" : "static";
+}
+
+static const char *ckb_wifi_state_name(uint8_t s) {
+    return s == CKB_WIFI_UP ? "up" : s == CKB_WIFI_CONNECTING ? "connecting" : "backoff";
+}
@@ -0,0 +1,135 @@
+// Subset of Digital7Mono28.h by tools/gfxfont_subset.py
+// chars: " %-.0123456789TX"
+const uint8_t digital_7__mono_28pt7b_numBitmaps[] PROGMEM = {
+  0x00, 0x7F, 0x60, 0x18, 0x7F, 0xB8, 0x1F, 0x3F, 0xDC, 0x0F, 0x83, 0xDE,
+  0x0F, 0x8E, 0x0F, 0x07, 0xC7, 0x87, 0x87, 0xC3, 0xC3, 0xC3, 0xE1, 0xE0,
+  0xE3, 0xE0, 0xF7, 0x81, 0xF0, 0x77, 0xF9, 0xF0, 0x3B, 0xFC, 0xF8, 0x0D,
+  0xFC, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0,
+  0x00, 0x03, 0xE0, 0x00, 0x01, 0xF3, 0xFB, 0x01, 0xF3, 0xFD, 0xC0, 0xF9,
+  0xFE, 0xE0, 0xF8, 0x1E, 0xF0, 0x7C, 0x70, 0x78, 0x7C, 0x3C, 0x3C, 0x3E,
+  0x1E, 0x1E, 0x3E, 0x0F, 0x07, 0x1F, 0x07, 0xBC, 0x1F, 0x03, 0xBF, 0xCF,
+  0x81, 0xDF, 0xE1, 0x80, 0x6F, 0xE0, 0x7F, 0xFE, 0x7F, 0xFF, 0xBF, 0xFF,
+  0xCF, 0xFF, 0xC0, 0xFF, 0xFF, 0x7F, 0xFF, 0xB7, 0xFF, 0xFD, 0xFF, 0xFF,
+  0xEE, 0x3F, 0xFE, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE,
+  0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
+  0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x07, 0xC0,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x3E, 0x00, 0x03,
+  0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80,
+  0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F,
+  0xC0, 0x01, 0xFC, 0x00, 0x0F, 0x1F, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF,
+  0xEE, 0xFF, 0xFF, 0x60, 0x67, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0x30, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x76, 0x7F, 0xFF,
+  0xB7, 0xFF, 0xFD, 0xFF, 0xFF, 0xEE, 0x3F, 0xFE, 0xF0, 0x00, 0x07, 0x80,
+  0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03,
+  0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x1F, 0xFF, 0xD9, 0xFF, 0xFF, 0x0F, 0xFF, 0xF9,
+  0xBF, 0xFF, 0x8E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0xFF,
+  0xC7, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xB7,
+  0xFF, 0xFD, 0xFF, 0xFF, 0xEE, 0x3F, 0xFE, 0xF0, 0x00, 0x07, 0x80, 0x00,
+  0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x07, 0x0F, 0xFF, 0xD8, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xB0, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00,
+  0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x1F, 0xFF, 0x7F,
+  0xFF, 0xFD, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x30, 0x00,
+  0x01, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F,
+  0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00,
+  0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFC,
+  0x00, 0x07, 0xDF, 0xFF, 0xD9, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF,
+  0xB0, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x7F, 0xFF, 0xE7, 0xFF, 0xFE,
+  0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x8E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00,
+  0x00, 0xDF, 0xFF, 0xC1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xB0,
+  0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80,
+  0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x1F, 0xFF, 0x7F, 0xFF, 0xFD,
+  0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0x60, 0x7F, 0xFF, 0xE7, 0xFF, 0xFE, 0x3F,
+  0xFF, 0xF0, 0x3F, 0xFF, 0x8E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00,
+  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0,
+  0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x00,
+  0xDF, 0xFF, 0xC1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF9, 0xBF, 0xFF, 0xBE, 0x00,
+  0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
+  0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00,
+  0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0x1F, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF,
+  0xFF, 0xEE, 0xFF, 0xFF, 0x60, 0x7F, 0xFF, 0xB7, 0xFF, 0xFD, 0xFF, 0xFF,
+  0xEE, 0x3F, 0xFE, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE,
+  0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
+  0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x07, 0xC0,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03,
+  0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00,
+  0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xC0, 0x00,
+  0x0E, 0x00, 0x00, 0x60, 0x7F, 0xFF, 0xB7, 0xFF, 0xFD, 0xFF, 0xFF, 0xEE,
+  0x3F, 0xFE, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
+  0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
+  0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x07, 0xDF, 0xFF,
+  0xD9, 0xFF, 0xFF, 0x0F, 0xFF, 0xF9, 0xBF, 0xFF, 0xBE, 0x00, 0x03, 0xF8,
+  0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03,
+  0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0,
+  0x01, 0xFC, 0x00, 0x0F, 0x1F, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xEE,
+  0xFF, 0xFF, 0x60, 0x7F, 0xFF, 0xB7, 0xFF, 0xFD, 0xFF, 0xFF, 0xEE, 0x3F,
+  0xFE, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F,
+  0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00,
+  0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x07, 0xDF, 0xFF, 0xD9,
+  0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xB0, 0x00, 0x03, 0x80, 0x00,
+  0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x1F, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xEE, 0xFF,
+  0xFF, 0x60, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00,
+  0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00,
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00,
+  0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00,
+  0x1E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xC0,
+  0x00, 0x30, 0x00, 0x67, 0xC0, 0x07, 0xFE, 0x00, 0x3E, 0xF8, 0x03, 0xE7,
+  0xC0, 0x1F, 0x1F, 0x01, 0xF0, 0xF8, 0x0F, 0x83, 0xE0, 0xF8, 0x1F, 0x07,
+  0xC0, 0x7C, 0x7C, 0x03, 0xE3, 0xE0, 0x0F, 0xBE, 0x00, 0x7D, 0xF0, 0x01,
+  0xEF, 0x00, 0x0F, 0x78, 0x00, 0x3B, 0x80, 0x01, 0xDC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xB8, 0x00, 0x1D, 0xC0, 0x01, 0xEF, 0x00, 0x0F,
+  0x78, 0x00, 0xFB, 0xE0, 0x07, 0xDF, 0x00, 0x7C, 0x7C, 0x03, 0xE3, 0xE0,
+  0x3E, 0x0F, 0x81, 0xF0, 0x7C, 0x1F, 0x01, 0xF0, 0xF8, 0x0F, 0x8F, 0x80,
+  0x3E, 0x7C, 0x01, 0xF7, 0xC0, 0x07, 0xFE, 0x00, 0x3E, 0x60, 0x00, 0xC0 };
+
+const GFXglyph digital_7__mono_28pt7b_numGlyphs[] PROGMEM = {
+  {     0,   1,   1,  25,    0,    0 },   // 0x20 ' '
+  {     1,  25,  36,  26,    0,  -35 },   // 0x25 '%'
+  {   114,  17,   4,  25,    4,  -19 },   // 0x2D '-'
+  {   123,   4,   4,  25,   10,   -3 },   // 0x2E '.'
+  {   125,  21,  36,  25,    2,  -35 },   // 0x30 '0'
+  {   220,   4,  36,  25,   19,  -35 },   // 0x31 '1'
+  {   238,  21,  36,  25,    2,  -35 },   // 0x32 '2'
+  {   333,  21,  36,  25,    2,  -35 },   // 0x33 '3'
+  {   428,  21,  36,  25,    2,  -35 },   // 0x34 '4'
+  {   523,  21,  36,  25,    2,  -35 },   // 0x35 '5'
+  {   618,  21,  36,  25,    2,  -35 },   // 0x36 '6'
+  {   713,  21,  36,  25,    2,  -35 },   // 0x37 '7'
+  {   808,  21,  36,  25,    2,  -35 },   // 0x38 '8'
+  {   903,  21,  36,  25,    2,  -35 },   // 0x39 '9'
+  {   998,  21,  36,  25,    2,  -35 },   // 0x54 'T'
+  {  1093,  21,  36,  25,    2,  -35 } };   // 0x58 'X'
+
+const uint8_t digital_7__mono_28pt7b_numRemap[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+  0x0C, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0xFF, 0xFF, 0xFF, 0x0F };
+
+const GFXsubfont digital_7__mono_28pt7b_num PROGMEM = { {
+  (uint8_t  *)digital_7__mono_28pt7b_numBitmaps,
+  (GFXglyph *)digital_7__mono_28pt7b_numGlyphs,
+  0x20, 0x58, 56 },
+  (uint8_t  *)digital_7__mono_28pt7b_numRemap, false };
+
+// Approx. 1369 bytes
@@ -9,12 +9,44 @@
  *   get_tip_header       — height, timestamp, epoch
  *   get_peers            — peer count
  *   get_raw_tx_pool      — mempool pending TX count
+ *   sync_state           — best known block number (sync gauge)
+ *   get_header_by_number — batched, header cache backfill / reorg walk
  *   send_transaction     — broadcast (inbound from HTTP POST /broadcast)
  *
+ * Single-node build: the poll RPCs go through ckb_failover.h, which spreads
+ * them over the node URL plus any "nodes" endpoints — per-endpoint latency
+ * and error tracking, circuit breakers, hedged requests — and names the
+ * endpoint that answered in the footer.
+ *
+ * Every new header is re-hashed (blake2b) and PoW-checked (Eaglesong)
+ * against its compact_target in a background task (ckb_pow.h).
+ *
  * HTTP server (port 8080):
  *   POST /broadcast      — body: signed tx JSON → forwards to CKB node
- *   GET  /status         — returns current chain state as JSON
+ *   GET  /status         — returns current chain state (and WiFi link) as JSON
+ *   GET  /screen         — framebuffer snapshot, ?session=&since= for deltas
  *   GET  /health         — "OK"
+ *   GET  /metrics        — Prometheus text: chain state, header cache, reorgs, PoW,
+ *                          per-endpoint RPC health, WiFi connect timing,
+ *                          boot-to-first-frame
+ *   GET  /nodes          — per-node table (multi-node build)
+ *   GET/POST /config     — read / change config live (Bearer api_token)
+ *   Served from its own task on core 0, independent of the poll loop.
+ *
+ * Multi-node build (env:guition4848-multinode, CKB_MULTINODE):
+ *   Watches up to CKB_MN_MAX_NODES full nodes / light clients at once
+ *   (ckb_multinode.h) instead of the single node above. The hero shows
+ *   the best tip, the since bar a fork/lag/down alarm, and the lower half
+ *   one row per node: tip, lag behind the best tip, peers, RPC latency.
+ *
+ * Instant-on: the last good poll (plus recent header history) is kept in
+ * RTC memory and, rate-limited, NVS (ckb_snapshot.h). At boot those
+ * figures are drawn greyed and marked "last known" before WiFi is up.
+ *
+ * Power (ckb_power.h): frequency scaling and, where the framework allows,
+ * automatic light sleep between polls. In the configured quiet hours the
+ * backlight is off and the panel DMA paused; a touch or a new block brings
+ * the panel back, dimmed, for a while.
  *
  * Platform: PlatformIO + espressif32@6.5.0 (IDF 4.4.6)
  * Library:  Arduino_GFX 1.2.9 (lib/Arduino_GFX — factory version)
@@ -26,15 +58,48 @@
 #include <WebServer.h>
 #include "ckb_config.h"
 #include <Arduino_GFX_Library.h>
-
-/* 7-segment style fonts for block height display */
-#include "fonts/Digital7Mono72.h"
-#include "fonts/Digital7Mono48.h"
-#include "fonts/Digital7Mono28.h"
+#include "ckb_gauge.h"
+#include "ckb_screen.h"
+#include "ckb_headers.h"
+#include "ckb_pow.h"
+#include "ckb_hashrate.h"
+#include "ckb_failover.h"
+#include "ckb_wifi.h"
+#include "ckb_snapshot.h"
+#include "ckb_power.h"
+#include "gt911.h"
+#if defined(CKB_MULTINODE)
+#include "ckb_multinode.h"
+#endif
+
+#if defined(CKB_FONTS_PARTITION)
+/* Fonts resolved by name from the memory-mapped "fonts" partition
+ * (ckb_fonts.h, env:guition4848-fontpack) — not linked into the app. */
+#include "ckb_fonts.h"
+
+static const GFXsubfont *font_7seg_hero  = nullptr;
+static const GFXsubfont *font_7seg_med   = nullptr;
+static const GFXsubfont *font_7seg_small = nullptr;
+static const GFXsubfont *font_label      = nullptr;
+static const GFXsubfont *font_small      = nullptr;
+
+#define FONT_7SEG_HERO   font_7seg_hero
+#define FONT_7SEG_MED    font_7seg_med
+#define FONT_7SEG_SMALL  font_7seg_small
+#define FONT_LABEL       font_label
+#define FONT_SMALL       font_small
+
+#else
+/* 7-segment style fonts for block height display.
+ * HERO/MED are subsets holding only " %-.0123456789TX" (HERO is also
+ * run-length encoded) — regenerate with tools/gfxfont_subset.py if a
+ * screen needs another character. SMALL stays full: it prints node ids. */
+#include "fonts/Digital7Mono48Num.h"
+#include "fonts/Digital7Mono28Num.h"
 #include "fonts/Digital7Mono14.h"
 
-#define FONT_7SEG_HERO   (&digital_7__mono_48pt7b)
-#define FONT_7SEG_MED    (&digital_7__mono_28pt7b)
+#define FONT_7SEG_HERO   (&digital_7__mono_48pt7b_num)
+#define FONT_7SEG_MED    (&digital_7__mono_28pt7b_num)
 #define FONT_7SEG_SMALL  (&digital_7__mono_14pt7b)
 
 /* JMH Typewriter — slab serif for headings and labels */
@@ -47,6 +112,7 @@
 /* Convenience: label font = Bold16, small label = Bold12 */
 #define FONT_LABEL  (&JMH_Typewriter_Bold16pt7b)
 #define FONT_SMALL  (&JMH_Typewriter_Bold12pt7b)
+#endif
 
 /* ═══════════════════════════════════════════════════════════════════
  * CONFIG
@@ -55,6 +121,11 @@
 #define WIFI_PASS   "Ajeip853jw5590!"
 #define CKB_RPC     "http://192.168.68.87:8114"
 #define POLL_MS     6000       /* ~1 block time */
+#define GAUGE_TICK_MS 1000     /* epoch ring steps between polls */
+/* Multi-node build: "name=url" list, comma separated; the "nodes"
+ * config key overrides it. Single-node build: extra failover endpoints
+ * behind the node URL, taken from the "nodes" key only */
+#define CKB_NODES   "main=" CKB_RPC
 
 #define BL_PIN  38
 #define W       480
@@ -62,10 +133,14 @@
 
 /* ═══════════════════════════════════════════════════════════════════
  * COLOURS (RGB565)
- * ═══════════════════════════════════════════════════════════════════ */
-#define COL_BG          0x0841  /* #101020 near-black blue */
+ * ═══════════════════════════════════════════════════════════════════
+ * Background and accent come from config ("bg_*", "accent_*") and can
+ * change at run time; apply_config() redraws in the new colours. */
+static uint16_t col_bg     = 0x0841;  /* #101020 near-black blue */
+static uint16_t col_accent = 0xFD00;  /* #FF6800 CKB orange */
+#define COL_BG          col_bg
 #define COL_PANEL       0x10A3  /* #21264A dark card */
-#define COL_ACCENT      0xFD00  /* #FF6800 CKB orange */
+#define COL_ACCENT      col_accent
 #define COL_ACCENT_DIM  0x9940  /* dimmed orange */
 #define COL_OK          0x2FC6  /* #27C34C green */
 #define COL_WARN        0xFE60  /* #FFCC00 amber */
@@ -87,7 +162,11 @@ static Arduino_ST7701_RGBPanel *gfx = nullptr;
  *                    (the "transaction" field value from send_transaction)
  *                    Returns: {"result":"<txhash>"} or {"error":"..."}
  * GET  /status     — chain state JSON
+ * GET  /screen     — RLE framebuffer tiles (ckb_screen.h); with
+ *                    ?session=S&since=N only tiles changed since seq N
  * GET  /health     — "OK"
+ * GET  /metrics    — Prometheus exposition format
+ * GET  /nodes      — multi-node table JSON (CKB_MULTINODE)
  * ═══════════════════════════════════════════════════════════════════ */
 static WebServer http_server(8080);
 
@@ -116,28 +195,65 @@ struct NodeState {
     uint64_t epoch_num     = 0;
     uint32_t epoch_idx     = 0;
     uint32_t epoch_len     = 1800;
+    uint64_t best_known    = 0;   /* sync_state best_known_block_number */
     bool     ok            = false;
     uint32_t last_ok_ms    = 0;
     uint32_t query_count   = 0;
     char     node_id[20]   = "";  /* last 16 chars of node id, e.g. "...a1b2c3d4" */
+    uint32_t reorg_ms      = 0;   /* when ckb_headers.h last saw a reorg */
 };
 static NodeState state;
 static ckb_cfg_t  cfg;     /* loaded from NVS at boot */
+static bool       stale;   /* on screen: last-known state from before the reset */
+
+/* What /status and /metrics serve. The loop task owns state and the
+ * header, hashrate and snapshot modules and copies them here after every
+ * poll; the HTTP task on core 0 reads the copy under status_mux, so no
+ * 64-bit height is ever read half-written. */
+struct StatusPub {
+    NodeState       node;
+    bool            stale;
+    ckb_hdr_cache_t hdr;          /* counters; ring and idx not used */
+    ckb_pow_stats_t pow;
+    ckb_snap_t      snap;
+    double          difficulty, hashrate, ema, block_time;
+    char            rpc_url[sizeof(cfg.node_url)];   /* /broadcast without failover */
+};
+static StatusPub    status_pub;
+static portMUX_TYPE status_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static void publish_status() {
+    static StatusPub p;           /* loop task only */
+    p.node  = state;
+    p.stale = stale;
+    p.hdr   = _ckb_hdr;
+    ckb_pow_copy(&p.pow);
+    p.snap  = _ckb_snap;
+    p.difficulty = _ckb_hr.difficulty;
+    p.hashrate   = ckb_hr_hashrate();
+    p.ema        = ckb_hr_ema();
+    p.block_time = ckb_hr_block_time();
+    snprintf(p.rpc_url, sizeof(p.rpc_url), "%s", (cfg.valid && cfg.node_url[0]) ? cfg.node_url : CKB_RPC);
+    portENTER_CRITICAL(&status_mux);
+    status_pub = p;
+    portEXIT_CRITICAL(&status_mux);
+}
+
+static void status_copy(StatusPub *out) {
+    portENTER_CRITICAL(&status_mux);
+    *out = status_pub;
+    portEXIT_CRITICAL(&status_mux);
+}
 
 /* ═══════════════════════════════════════════════════════════════════
  * RPC HELPERS
  * ═══════════════════════════════════════════════════════════════════ */
+/* Healthiest endpoint answers, hedged / retried on the others (ckb_failover.h) */
 static String rpc_call(const char *body) {
-    if (WiFi.status() != WL_CONNECTED) return "";
-    HTTPClient http;
-    const char *url = (cfg.valid && cfg.node_url[0]) ? cfg.node_url : CKB_RPC;
-    http.begin(url);
-    http.addHeader("Content-Type", "application/json");
-    http.setTimeout(5000);
-    int code = http.POST(body);
-    String resp = (code == 200) ? http.getString() : "";
-    http.end();
-    return resp;
+    if (!ckb_wifi_up()) return "";
+    uint32_t len = 0;
+    const char *resp = ckb_fo_call(body, &len);
+    return resp ? String(resp) : "";
 }
 
 static uint64_t parse_hex_field(const String &json, const char *key) {
@@ -181,6 +297,16 @@ static void parse_epoch(const String &json, uint64_t &num, uint32_t &idx, uint32
     if (len == 0) len = 1800;
 }
 
+/* Header cache backfill: one batched get_header_by_number round trip */
+static uint16_t fetch_headers(uint64_t from, uint16_t count, ckb_hdr_t *out) {
+    static char body[(CKB_HDR_PREFILL > CKB_HDR_BATCH ? CKB_HDR_PREFILL : CKB_HDR_BATCH) * 96 + 8];
+    if (!ckb_hdr_batch_body(body, sizeof(body), from, count)) return 0;
+    String resp = rpc_call(body);
+    if (resp.isEmpty()) return 0;
+    ckb_pow_submit_json(resp.c_str());
+    return ckb_hdr_parse_batch(resp.c_str(), from, count, out);
+}
+
 static bool fetch_tip_header() {
     String resp = rpc_call(
         "{\"jsonrpc\":\"2.0\",\"method\":\"get_tip_header\",\"params\":[],\"id\":1}");
@@ -188,6 +314,25 @@ static bool fetch_tip_header() {
     state.height     = parse_hex_field(resp, "number");
     state.block_ts_ms = parse_hex_field(resp, "timestamp");
     parse_epoch(resp, state.epoch_num, state.epoch_idx, state.epoch_len);
+
+    ckb_hdr_t tip;
+    if (ckb_hdr_parse(resp.c_str(), resp.c_str() + resp.length(), tip)) {
+        static uint8_t last_hash[32];
+        if (memcmp(last_hash, tip.hash, 32)) {      /* verify each tip once */
+            memcpy(last_hash, tip.hash, 32);
+            ckb_pow_submit_json(resp.c_str());
+        }
+        if (!_ckb_hdr.count && ckb_hdr_prefill(tip.number, fetch_headers))
+            Serial.printf("[hdr] prefilled %lu headers up to %llu\n",
+                (unsigned long)_ckb_hdr.count, (unsigned long long)_ckb_hdr.hi);
+        int depth = ckb_hdr_tip(tip, fetch_headers);
+        if (depth > 0) {
+            state.reorg_ms = millis();
+            Serial.printf("[hdr] reorg: %d blocks above %llu replaced (%lu total)\n",
+                depth, (unsigned long long)_ckb_hdr.last_fork, (unsigned long)_ckb_hdr.reorgs);
+        }
+        ckb_hr_sync();
+    }
     return state.height > 0;
 }
 
@@ -205,6 +350,13 @@ static void fetch_mempool() {
         state.mempool_tx = parse_array_length(resp, "pending");
 }
 
+static void fetch_sync_state() {
+    String resp = rpc_call(
+        "{\"jsonrpc\":\"2.0\",\"method\":\"sync_state\",\"params\":[],\"id\":5}");
+    if (!resp.isEmpty())
+        state.best_known = parse_hex_field(resp, "best_known_block_number");
+}
+
 static void fetch_node_id() {
     /* Fetch once — extract node_id, store last 16 hex chars prefixed with "..." */
     String resp = rpc_call(
@@ -236,11 +388,11 @@ static void fetch_node_id() {
  *  ├──────────────────────────────┤  y=156
  *  │  Last block: 4s ago          │  h=44  since bar
  *  ├──────────────────────────────┤  y=200
- *  │  Peers: 21   |  Mempool: 14  │  h=72  stats
+ *  │  Peers | Mempool | Hashrate  │  h=72  stats
  *  ├──────────────────────────────┤  y=272
  *  │  Epoch 3142  ████░░  67%     │  h=88  epoch bar
  *  ├──────────────────────────────┤  y=360
- *  │  node IP · polls · IP        │  h=30  footer
+ *  │  node IP · polls · IP   ◔ ◔  │  h=30  footer + epoch/sync rings
  *  └──────────────────────────────┘  y=390..480 (pad)
  */
 
@@ -258,6 +410,9 @@ static void fetch_node_id() {
 #define EPOCH_H     79
 #define FOOTER_Y    367
 #define FOOTER_H    113
+#define GAUGE_X     336     /* footer text stays left of the rings */
+#define GAUGE_R     32
+#define GAUGE_W     8
 
 /* ═══════════════════════════════════════════════════════════════════
  * DRAW HELPERS
@@ -267,13 +422,27 @@ static void fill_section(int y, int h, uint16_t col) {
 }
 
 static void draw_header(bool ok) {
-    uint16_t accent = (cfg.valid) ? cfg.accent_col : COL_ACCENT;
-    fill_section(HEADER_Y, HEADER_H, ok ? accent : COL_ERR);
+    fill_section(HEADER_Y, HEADER_H, ok ? COL_ACCENT : COL_ERR);
     gfx->setFont(FONT_LABEL);
     gfx->setTextColor(0x0000);
     gfx->setTextSize(1);
     gfx->setCursor(14, HEADER_H - 23);
     gfx->print("CKB NODE");
+
+    /* Header verification of the latest checked block, left of the dot.
+     * Failures stay in /metrics unless built with CKB_POW_SHOW_BAD. */
+    ckb_pow_stats_t pow;
+    ckb_pow_copy(&pow);
+    const char *tag = pow.last_result == CKB_POW_OK      ? "PoW ok"
+                    : pow.last_result == CKB_POW_HASH_OK ? "hash ok"
+                    : CKB_POW_SHOW_BAD                   ? "BAD HDR" : nullptr;
+    if (tag && (pow.verified || pow.bad_hash || pow.bad_pow)) {
+        gfx->setFont(FONT_SMALL);
+        int16_t tx, ty; uint16_t tw, th;
+        gfx->getTextBounds(tag, 0, 0, &tx, &ty, &tw, &th);
+        gfx->setCursor(W - 50 - tw - tx, HEADER_H - 19);
+        gfx->print(tag);
+    }
     gfx->setFont(nullptr);
     /* Status dot */
     gfx->fillCircle(W-28, HEADER_H/2, 11, 0x0000);
@@ -298,8 +467,8 @@ static void draw_block_height(uint64_t h) {
     char buf[24];
     snprintf(buf, sizeof(buf), "%llu", (unsigned long long)h);
 
-    gfx->setFont(&digital_7__mono_48pt7b);
-    gfx->setTextColor((cfg.valid) ? cfg.accent_col : COL_ACCENT);
+    gfx->setFont(FONT_7SEG_HERO);
+    gfx->setTextColor(COL_ACCENT);
     gfx->setTextSize(1);
 
     int16_t x1, y1; uint16_t tw, th;
@@ -328,6 +497,13 @@ static void draw_since(uint64_t /*block_ts_ms*/) {
         snprintf(label, sizeof(label), "Last block:  >1h ago!");
 
     uint16_t col = (age_s < 20) ? COL_OK : (age_s < 60) ? COL_WARN : COL_ERR;
+
+    /* A fresh reorg takes the bar for half a minute */
+    if (state.reorg_ms && millis() - state.reorg_ms < 30000) {
+        snprintf(label, sizeof(label), "Reorg: %lu blocks after %llu",
+            (unsigned long)_ckb_hdr.last_depth, (unsigned long long)_ckb_hdr.last_fork);
+        col = COL_WARN;
+    }
     gfx->setFont(FONT_SMALL);
     gfx->setTextColor(col);
     gfx->setTextSize(1);
@@ -339,43 +515,89 @@ static void draw_since(uint64_t /*block_ts_ms*/) {
     gfx->setFont(nullptr);
 }
 
-static void draw_stats(uint32_t peers, uint32_t mempool) {
-    fill_section(STATS_Y, STATS_H, COL_BG);
-    gfx->drawFastVLine(W/2, STATS_Y+8, STATS_H-16, COL_DIVIDER);
+/* Stats row: Peers | Mempool | Hashrate tiles, left edges below */
+static const int16_t stats_col_x[] = { 0, 112, 264, W };
 
-    /* Left: Peers */
+static void draw_stats_label(uint8_t col, const char *label) {
     gfx->setFont(FONT_SMALL);
     gfx->setTextSize(1);
     gfx->setTextColor(COL_DIM);
-    gfx->setCursor(20, STATS_Y + 18);
-    gfx->print("Peers");
+    gfx->setCursor(stats_col_x[col] + 20, STATS_Y + 18);
+    gfx->print(label);
+}
+
+static void draw_stats(uint32_t peers, uint32_t mempool) {
+    gfx->fillRect(0, STATS_Y, stats_col_x[2], STATS_H, COL_BG);
+    gfx->drawFastVLine(stats_col_x[1], STATS_Y+8, STATS_H-16, COL_DIVIDER);
+    gfx->drawFastVLine(stats_col_x[2], STATS_Y+8, STATS_H-16, COL_DIVIDER);
+
+    /* Left: Peers */
+    draw_stats_label(0, "Peers");
 
     /* Peers value in 7-seg — vertically centred in zone */
     char pbuf[8];
     snprintf(pbuf, sizeof(pbuf), "%lu", (unsigned long)peers);
     uint16_t pcol = (peers >= 5) ? COL_OK : (peers > 0) ? COL_WARN : COL_ERR;
-    gfx->setFont(&digital_7__mono_28pt7b);
+    gfx->setFont(FONT_7SEG_MED);
     gfx->setTextColor(pcol);
     gfx->setTextSize(1);
     /* 28pt font is ~32px tall; zone is STATS_H=72px; label=16px; remaining=56px; centre of remaining ≈ label+28+14=label+42 */
     gfx->setCursor(20, STATS_Y + STATS_H - 10);
     gfx->print(pbuf);
 
-    /* Right: Mempool */
-    gfx->setFont(FONT_SMALL);
-    gfx->setTextSize(1);
-    gfx->setTextColor(COL_DIM);
-    gfx->setCursor(W/2 + 20, STATS_Y + 18);
-    gfx->print("Mempool");
+    /* Middle: Mempool */
+    draw_stats_label(1, "Mempool");
 
     char mbuf[12];
-    snprintf(mbuf, sizeof(mbuf), "%lu TX", (unsigned long)mempool);
-    gfx->setFont(&digital_7__mono_28pt7b);
+    snprintf(mbuf, sizeof(mbuf), "%lu", (unsigned long)mempool);
+    gfx->setFont(FONT_7SEG_MED);
     gfx->setTextColor(COL_TEXT);
     gfx->setTextSize(1);
-    gfx->setCursor(W/2 + 20, STATS_Y + STATS_H - 10);
+    gfx->setCursor(stats_col_x[1] + 20, STATS_Y + STATS_H - 10);
     gfx->print(mbuf);
+    gfx->setFont(FONT_SMALL);
+    gfx->setTextColor(COL_DIM);
+    gfx->print(" tx");
+
+    gfx->setFont(nullptr);
+}
+
+/* Right: difficulty on the label line, EMA hashrate below */
+static void draw_hashrate() {
+    int16_t x = stats_col_x[2];
+    gfx->fillRect(x + 1, STATS_Y, W - x - 1, STATS_H, COL_BG);
+
+    char buf[12];
+    char prefix;
+    draw_stats_label(2, "Diff ");
+    gfx->setTextColor(COL_TEXT);
+    if (_ckb_hr.difficulty > 0) {
+        prefix = ckb_hr_si(_ckb_hr.difficulty, buf, sizeof(buf));
+        size_t n = strlen(buf);
+        buf[n] = prefix;
+        buf[n + 1] = '\0';
+        gfx->print(buf);
+    } else {
+        gfx->print("--");
+    }
 
+    gfx->setFont(FONT_7SEG_MED);
+    gfx->setTextSize(1);
+    gfx->setCursor(x + 20, STATS_Y + STATS_H - 10);
+    if (!ckb_hr_ready()) {
+        gfx->setTextColor(COL_DIM);
+        gfx->print("--");
+        gfx->setFont(nullptr);
+        return;
+    }
+    prefix = ckb_hr_si(ckb_hr_ema(), buf, sizeof(buf));
+    gfx->setTextColor(COL_ACCENT);
+    gfx->print(buf);
+    char unit[8] = " H/s";
+    if (prefix != ' ') snprintf(unit, sizeof(unit), " %cH/s", prefix);
+    gfx->setFont(FONT_SMALL);
+    gfx->setTextColor(COL_DIM);
+    gfx->print(unit);
     gfx->setFont(nullptr);
 }
 
@@ -420,8 +642,37 @@ static void draw_epoch(uint64_t num, uint32_t idx, uint32_t len) {
     gfx->setFont(nullptr);
 }
 
+/* Epoch / sync rings — painted incrementally, only the wedge that moved */
+static ckb_gauge_t gauge_epoch = ckb_gauge(GAUGE_X + GAUGE_R, FOOTER_Y + 52,
+                                           GAUGE_R, GAUGE_R - GAUGE_W, COL_ACCENT, COL_DIVIDER);
+static ckb_gauge_t gauge_sync  = ckb_gauge(W - 8 - GAUGE_R, FOOTER_Y + 52,
+                                           GAUGE_R, GAUGE_R - GAUGE_W, COL_OK, COL_DIVIDER);
+
+static uint32_t tip_seen_ms = 0;   /* millis() when the current tip arrived */
+
+/* Epoch progress in thousandths of a block. Between polls it moves on at
+ * the mean block interval, but stops short of the next block's mark. */
+static uint32_t epoch_progress_milli() {
+    uint32_t v = state.epoch_idx * 1000;
+    double bt = ckb_hr_block_time();
+    if (bt > 0 && tip_seen_ms) {
+        double f = (millis() - tip_seen_ms) / bt;   /* ms / s: thousandths */
+        v += f < 999 ? (uint32_t)f : 999;
+    }
+    return v;
+}
+
+static void draw_gauges() {
+    ckb_gauge_colors(gauge_epoch, COL_ACCENT, COL_DIVIDER);
+    ckb_gauge_set(gfx, gauge_epoch, epoch_progress_milli(), state.epoch_len * 1000);
+    /* No sync_state answer yet → empty ring rather than a false 100% */
+    uint64_t best = state.best_known > state.height ? state.best_known : state.height;
+    ckb_gauge_set(gfx, gauge_sync, state.best_known ? (uint32_t)(state.height * 1000 / best) : 0, 1000);
+}
+
 static void draw_footer() {
-    fill_section(FOOTER_Y, FOOTER_H, COL_BG);
+    /* Rings keep their pixels between polls — clear only the text column */
+    gfx->fillRect(0, FOOTER_Y, GAUGE_X, FOOTER_H, COL_BG);
     gfx->drawFastHLine(0, FOOTER_Y, W, COL_DIVIDER);
     char buf[48];
     int line_h = 24;
@@ -430,11 +681,17 @@ static void draw_footer() {
     int y3 = y2 + line_h + 1;
     int y4 = y3 + line_h + 1;
 
-    /* Line 1: "node:" label + node IP in 7-seg */
+    /* Line 1: "node:" label + host that answered the last poll in 7-seg;
+     * amber when that wasn't the first endpoint (failed over), red if none */
+    static ckb_fo_snapshot_t fo;
+    ckb_fo_copy(&fo);
+    int8_t ep = fo.last >= 0 ? fo.last : fo.primary;
     gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
     gfx->setCursor(8, y1); gfx->print("node:");
-    gfx->setFont(FONT_7SEG_SMALL); gfx->setTextColor(COL_TEXT);
-    gfx->print(" 192.168.68.87");
+    gfx->setFont(FONT_7SEG_SMALL);
+    gfx->setTextColor(fo.last < 0 ? COL_ERR : fo.last ? COL_WARN : COL_TEXT);
+    snprintf(buf, sizeof(buf), " %s", fo.count ? fo.ep[ep].host : "-");
+    gfx->print(buf);
 
     /* Line 2: "polls:" label + count in 7-seg */
     gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM);
@@ -443,11 +700,28 @@ static void draw_footer() {
     snprintf(buf, sizeof(buf), " %lu", (unsigned long)state.query_count);
     gfx->print(buf);
 
-    /* Line 3: "ip:" label + device IP in 7-seg */
+    /* ...then reorg count / deepest, once there has been one */
+    if (_ckb_hdr.reorgs) {
+        gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM);
+        gfx->print("  reorgs:");
+        gfx->setFont(FONT_7SEG_SMALL); gfx->setTextColor(COL_WARN);
+        snprintf(buf, sizeof(buf), " %lu/%lu",
+            (unsigned long)_ckb_hdr.reorgs, (unsigned long)_ckb_hdr.max_depth);
+        gfx->print(buf);
+    }
+
+    /* Line 3: "ip:" label + device IP in 7-seg, or the link state while
+     * the WiFi task is (re)joining */
     gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM);
     gfx->setCursor(8, y3); gfx->print("ip:");
-    gfx->setFont(FONT_7SEG_SMALL); gfx->setTextColor(COL_TEXT);
-    snprintf(buf, sizeof(buf), " %s", WiFi.localIP().toString().c_str());
+    gfx->setFont(FONT_7SEG_SMALL);
+    if (ckb_wifi_up()) {
+        gfx->setTextColor(COL_TEXT);
+        snprintf(buf, sizeof(buf), " %s", WiFi.localIP().toString().c_str());
+    } else {
+        gfx->setTextColor(COL_WARN);
+        snprintf(buf, sizeof(buf), " %s", ckb_wifi_state_name(_ckb_wifi.info.state));
+    }
     gfx->print(buf);
 
     /* Line 4: "id:" label + truncated node_id in 7-seg */
@@ -459,7 +733,15 @@ static void draw_footer() {
         gfx->print(buf);
     }
 
+    /* Ring captions */
+    if (!gauge_epoch.drawn) {
+        gfx->fillRect(GAUGE_X, FOOTER_Y + 1, W - GAUGE_X, FOOTER_H - 1, COL_BG);
+        gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM);
+        gfx->setCursor(gauge_epoch.x - 14, H - 8); gfx->print("ep");
+        gfx->setCursor(gauge_sync.x - 28, H - 8); gfx->print("sync");
+    }
     gfx->setFont(nullptr);
+    draw_gauges();
 }
 
 static void draw_chrome() {
@@ -472,6 +754,8 @@ static void draw_chrome() {
     fill_section(STATS_Y,  STATS_H,  COL_BG);
     fill_section(EPOCH_Y,  EPOCH_H,  COL_PANEL);
     fill_section(FOOTER_Y, FOOTER_H, COL_BG);
+    ckb_gauge_invalidate(gauge_epoch);
+    ckb_gauge_invalidate(gauge_sync);
 }
 
 static void draw_splash() {
@@ -494,6 +778,134 @@ static void draw_splash() {
     gfx->setFont(nullptr);
 }
 
+/* Whole frame to dimmed greyscale, in place in the panel framebuffer */
+static void grey_frame() {
+    uint16_t *fb = gfx->getFramebuffer();
+    if (!fb) return;
+    for (uint32_t i = 0; i < (uint32_t)W * H; i++) {
+        uint16_t c = fb[i];
+        uint32_t r = (c >> 11) << 3, g = ((c >> 5) & 0x3F) << 2, b = (c & 0x1F) << 3;
+        uint32_t y = (77 * r + 150 * g + 29 * b) >> 9;   /* luma at half brightness */
+        fb[i] = ((y >> 3) << 11) | ((y >> 2) << 5) | (y >> 3);
+    }
+    Cache_WriteBack_Addr((uint32_t)fb, W * H * 2);
+}
+
+#if defined(CKB_MULTINODE)
+/* ═══════════════════════════════════════════════════════════════════
+ * MULTI-NODE TABLE
+ * ═══════════════════════════════════════════════════════════════════
+ * Replaces stats / epoch / footer below the since bar:
+ *
+ *  ├──────────────────────────────┤  y=200
+ *  │ node   tip       lag peers ms│  h=24  column heads
+ *  │ a      18709215    0   21  43│  h=32  one row per node (8 max)
+ *  │ b      18709212   -3    8 210│
+ *  └──────────────────────────────┘  y=480
+ */
+#define MN_HEAD_Y   200
+#define MN_HEAD_H   24
+#define MN_ROW_Y    224
+#define MN_ROW_H    32
+
+/* Column left edges; each cell is clipped so a long name or tip never
+ * runs into its neighbour */
+static const int16_t mn_col_x[] = { 10, 110, 262, 336, 410, W };
+
+static void mn_cell(uint8_t col, int16_t y, int16_t h, const char *text) {
+    gfx->pushClipRect(mn_col_x[col], y, mn_col_x[col + 1] - mn_col_x[col] - 6, h);
+    gfx->setCursor(mn_col_x[col], y + h - 9);
+    gfx->print(text);
+    gfx->popClipRect();
+}
+
+static void draw_mn_head() {
+    fill_section(MN_HEAD_Y, H - MN_HEAD_Y, COL_BG);
+    gfx->setFont(FONT_SMALL);
+    gfx->setTextColor(COL_DIM);
+    gfx->setTextSize(1);
+    static const char *const heads[] = { "node", "tip", "lag", "peers", "ms" };
+    for (uint8_t c = 0; c < 5; c++) mn_cell(c, MN_HEAD_Y, MN_HEAD_H + 4, heads[c]);
+    gfx->drawFastHLine(0, MN_ROW_Y - 1, W, COL_DIVIDER);
+    gfx->setFont(nullptr);
+}
+
+static void draw_mn_row(uint8_t i, const ckb_mn_info_t &n) {
+    int16_t y = MN_ROW_Y + i * MN_ROW_H;
+    gfx->fillRect(0, y, W, MN_ROW_H, (i & 1) ? COL_PANEL : COL_BG);
+    gfx->setTextSize(1);
+    char buf[24];
+
+    gfx->setFont(FONT_SMALL);
+    gfx->setTextColor(n.ok ? COL_TEXT : COL_ERR);
+    mn_cell(0, y, MN_ROW_H, n.name);
+
+    gfx->setFont(FONT_7SEG_SMALL);
+    if (n.seen) snprintf(buf, sizeof(buf), "%llu", (unsigned long long)n.tip);
+    else strcpy(buf, "--");
+    gfx->setTextColor(n.forked ? COL_ERR : n.ok ? COL_TEXT : COL_DIM);
+    mn_cell(1, y, MN_ROW_H, buf);
+
+    if (!n.ok) {
+        gfx->setFont(FONT_SMALL);
+        gfx->setTextColor(COL_ERR);
+        mn_cell(2, y, MN_ROW_H, "down");
+        gfx->setFont(FONT_7SEG_SMALL);
+    } else {
+        snprintf(buf, sizeof(buf), n.lag ? "-%lu" : "0", (unsigned long)n.lag);
+        gfx->setTextColor(n.lag == 0 ? COL_OK : n.lag <= CKB_MN_LAG_BLOCKS ? COL_WARN : COL_ERR);
+        mn_cell(2, y, MN_ROW_H, buf);
+    }
+
+    snprintf(buf, sizeof(buf), "%lu", (unsigned long)n.peers);
+    gfx->setTextColor(!n.seen ? COL_DIM : (n.peers >= 5) ? COL_OK : (n.peers > 0) ? COL_WARN : COL_ERR);
+    mn_cell(3, y, MN_ROW_H, buf);
+
+    if (n.seen) snprintf(buf, sizeof(buf), "%lu", (unsigned long)n.latency_ms);
+    else strcpy(buf, "--");
+    gfx->setTextColor(n.latency_ms > 1000 ? COL_WARN : COL_DIM);
+    mn_cell(4, y, MN_ROW_H, buf);
+    gfx->setFont(nullptr);
+}
+
+/* Since bar doubles as the alarm line: fork beats down beats lag */
+static void draw_mn_alarm(const ckb_mn_snapshot_t &s) {
+    fill_section(SINCE_Y, SINCE_H, COL_PANEL);
+    gfx->drawFastHLine(0, SINCE_Y,            W, COL_DIVIDER);
+    gfx->drawFastHLine(0, SINCE_Y+SINCE_H-1,  W, COL_DIVIDER);
+
+    char label[48];
+    uint16_t col = COL_OK;
+    uint8_t down = 0, worst = 0;
+    for (uint8_t i = 0; i < s.count; i++) {
+        if (s.node[i].fails >= 2) down++;
+        if (s.node[i].lag > s.node[worst].lag) worst = i;
+    }
+    if (s.alarm & CKB_MN_ALARM_FORK) {
+        snprintf(label, sizeof(label), "FORK at block %llu", (unsigned long long)s.fork_height);
+        col = COL_ERR;
+    } else if (s.alarm & CKB_MN_ALARM_DOWN) {
+        snprintf(label, sizeof(label), "%u of %u nodes down", down, s.count);
+        col = COL_ERR;
+    } else if (s.alarm & CKB_MN_ALARM_LAG) {
+        snprintf(label, sizeof(label), "LAG: %s %lu behind", s.node[worst].name,
+            (unsigned long)s.node[worst].lag);
+        col = COL_WARN;
+    } else {
+        snprintf(label, sizeof(label), "%u nodes in sync", s.count);
+    }
+
+    gfx->setFont(FONT_SMALL);
+    gfx->setTextColor(col);
+    gfx->setTextSize(1);
+    int16_t sx, sy; uint16_t stw, sth;
+    gfx->getTextBounds(label, 0, 0, &sx, &sy, &stw, &sth);
+    gfx->setCursor((W - stw)/2 - sx, SINCE_Y + 28);
+    gfx->print(label);
+    gfx->setFont(nullptr);
+}
+#endif
+
 /* ═══════════════════════════════════════════════════════════════════
  * HTTP HANDLERS
  * ═══════════════════════════════════════════════════════════════════ */
@@ -501,23 +913,285 @@ static void handle_health() {
     http_server.send(200, "text/plain", "OK");
 }
 
+/* Same path as a serial session (ckb_config.h): parse over the saved
+ * config, save, and let the loop apply it live. Plain HTTP, so the token
+ * only keeps out other LAN clients, not a sniffer. */
+static bool config_authorized() {
+    ckb_cfg_t saved = ckb_config_load();
+    if (ckb_config_auth(saved, http_server.header("Authorization").c_str())) return true;
+    http_server.send(saved.api_token[0] ? 401 : 403, "application/json",
+        saved.api_token[0] ? "{\"error\":\"bad token\"}"
+                           : "{\"error\":\"set api_token over serial first\"}");
+    return false;
+}
+
+static void handle_config_get() {
+    if (!config_authorized()) return;
+    ckb_cfg_t c = ckb_config_load();
+    char buf[768];
+    snprintf(buf, sizeof(buf),
+        "{\"wifi_ssid\":\"%s\",\"node_url\":\"%s\",\"nodes\":\"%s\","
+        "\"quiet\":\"%s\",\"tz\":\"%s\","
+        "\"accent_r\":%u,\"accent_g\":%u,\"accent_b\":%u,"
+        "\"bg_r\":%u,\"bg_g\":%u,\"bg_b\":%u}",
+        c.wifi_ssid, c.node_url, c.nodes, c.quiet, c.tz,
+        (c.accent_col >> 11) << 3, ((c.accent_col >> 5) & 0x3F) << 2, (c.accent_col & 0x1F) << 3,
+        (c.bg_col >> 11) << 3, ((c.bg_col >> 5) & 0x3F) << 2, (c.bg_col & 0x1F) << 3);
+    http_server.send(200, "application/json", buf);
+}
+
+static void handle_config_post() {
+    if (!config_authorized()) return;
+    String body = http_server.arg("plain");
+    if (body.isEmpty() || body.length() > CKB_CFG_BUF) {
+        char err[64];
+        snprintf(err, sizeof(err), "{\"error\":\"body must be 1..%u bytes of JSON\"}", (unsigned)CKB_CFG_BUF);
+        http_server.send(400, "application/json", err);
+        return;
+    }
+    /* A leaked token must not be able to replace itself and lock the owner out */
+    if (strstr(body.c_str(), "\"api_token\"")) {
+        http_server.send(403, "application/json", "{\"error\":\"api_token can only be set over serial\"}");
+        return;
+    }
+    ckb_cfg_t c = ckb_config_load();
+    uint8_t keys = ckb_config_parse(body.c_str(), c);
+    if (!keys) {
+        http_server.send(400, "application/json", "{\"error\":\"no config keys\"}");
+        return;
+    }
+    ckb_config_submit(c);
+    char buf[48];
+    snprintf(buf, sizeof(buf), "{\"ok\":true,\"keys\":%u}", (unsigned)keys);
+    http_server.send(200, "application/json", buf);
+    Serial.printf("[cfg] %u keys over HTTP from %s\n", (unsigned)keys,
+        http_server.client().remoteIP().toString().c_str());
+}
+
 static void handle_status() {
-    char buf[256];
+    char buf[896];
+    ckb_wifi_info_t wl;
+    ckb_wifi_copy(&wl);
+    ckb_pwr_info_t pw;
+    ckb_pwr_copy(&pw);
+    static StatusPub st;
+    status_copy(&st);
     snprintf(buf, sizeof(buf),
         "{\"height\":%llu,\"peers\":%lu,\"mempool\":%lu,"
         "\"epoch\":%llu,\"epoch_idx\":%lu,\"epoch_len\":%lu,"
-        "\"ok\":%s,\"polls\":%lu}",
-        (unsigned long long)state.height,
-        (unsigned long)state.peers,
-        (unsigned long)state.mempool_tx,
-        (unsigned long long)state.epoch_num,
-        (unsigned long)state.epoch_idx,
-        (unsigned long)state.epoch_len,
-        state.ok ? "true" : "false",
-        (unsigned long)state.query_count);
+        "\"ok\":%s,\"polls\":%lu,\"reorgs\":%lu,\"reorg_depth\":%lu,"
+        "\"pow_verified\":%lu,"
+        "\"difficulty\":%.4g,\"hashrate\":%.4g,\"block_time\":%.2f,"
+        "\"wifi\":{\"state\":\"%s\",\"path\":\"%s\",\"rssi\":%d,"
+        "\"boot_ms\":%lu,\"connect_ms\":%lu,\"reconnects\":%lu},"
+        "\"boot\":{\"stale\":%s,\"snapshot\":\"%s\",\"first_frame_ms\":%lu,\"live_ms\":%lu},"
+        "\"power\":{\"state\":\"%s\",\"pm\":\"%s\",\"clock\":%s,\"backlight\":%u,"
+        "\"ma\":%.1f,\"avg_ma\":%.1f,\"resume_us\":%lu,\"resume_max_us\":%lu}}",
+        (unsigned long long)st.node.height,
+        (unsigned long)st.node.peers,
+        (unsigned long)st.node.mempool_tx,
+        (unsigned long long)st.node.epoch_num,
+        (unsigned long)st.node.epoch_idx,
+        (unsigned long)st.node.epoch_len,
+        st.node.ok ? "true" : "false",
+        (unsigned long)st.node.query_count,
+        (unsigned long)st.hdr.reorgs,
+        (unsigned long)st.hdr.last_depth,
+        (unsigned long)st.pow.verified,
+        st.difficulty,
+        st.ema,
+        st.block_time,
+        ckb_wifi_state_name(wl.state),
+        ckb_wifi_path_name(wl.path),
+        (int)wl.rssi,
+        (unsigned long)wl.boot_ms,
+        (unsigned long)wl.connect_ms,
+        (unsigned long)wl.disconnects,
+        st.stale ? "true" : "false",
+        ckb_snap_source_name(st.snap.source),
+        (unsigned long)st.snap.frame_ms,
+        (unsigned long)st.snap.live_ms,
+        ckb_pwr_state_name(pw.state),
+        ckb_pwr_pm_name(pw.pm),
+        pw.clock ? "true" : "false",
+        (unsigned)pw.duty,
+        ckb_pwr_ma(pw, pw.state),
+        ckb_pwr_avg_ma(pw),
+        (unsigned long)pw.resume_us,
+        (unsigned long)pw.resume_max_us);
     http_server.send(200, "application/json", buf);
 }
 
+static void handle_metrics() {
+    static char buf[6656];
+    static ckb_fo_snapshot_t fo;
+    static ckb_pwr_info_t pw;
+    static StatusPub st;
+    status_copy(&st);
+    ckb_wifi_info_t wl;
+    ckb_wifi_copy(&wl);
+    int n = snprintf(buf, sizeof(buf),
+        "# TYPE ckb_tip_height gauge\nckb_tip_height %llu\n"
+        "# TYPE ckb_peers gauge\nckb_peers %lu\n"
+        "# TYPE ckb_mempool_tx gauge\nckb_mempool_tx %lu\n"
+        "# TYPE ckb_rpc_ok gauge\nckb_rpc_ok %d\n"
+        "# TYPE ckb_polls_total counter\nckb_polls_total %lu\n"
+        "# TYPE ckb_header_cache_size gauge\nckb_header_cache_size %lu\n"
+        "# TYPE ckb_header_backfill_total counter\nckb_header_backfill_total %lu\n"
+        "# TYPE ckb_header_fetches_total counter\nckb_header_fetches_total %lu\n"
+        "# TYPE ckb_reorgs_total counter\nckb_reorgs_total %lu\n"
+        "# TYPE ckb_reorg_depth_last gauge\nckb_reorg_depth_last %lu\n"
+        "# TYPE ckb_reorg_depth_max gauge\nckb_reorg_depth_max %lu\n"
+        "# TYPE ckb_reorg_fork_height gauge\nckb_reorg_fork_height %llu\n"
+        "# TYPE ckb_pow_verified_total counter\nckb_pow_verified_total %lu\n"
+        "# TYPE ckb_pow_checked_total counter\nckb_pow_checked_total %lu\n"
+        "# TYPE ckb_pow_bad_hash_total counter\nckb_pow_bad_hash_total %lu\n"
+        "# TYPE ckb_pow_bad_pow_total counter\nckb_pow_bad_pow_total %lu\n"
+        "# TYPE ckb_pow_dropped_total counter\nckb_pow_dropped_total %lu\n"
+        "# TYPE ckb_pow_queue_max gauge\nckb_pow_queue_max %lu\n"
+        "# TYPE ckb_pow_worst_us gauge\nckb_pow_worst_us %lu\n"
+        "# TYPE ckb_pow_bench_headers_per_second gauge\nckb_pow_bench_headers_per_second %lu\n"
+        "# TYPE ckb_pow_bench_eaglesong_per_second gauge\nckb_pow_bench_eaglesong_per_second %lu\n"
+        "# TYPE ckb_difficulty gauge\nckb_difficulty %.6g\n"
+        "# TYPE ckb_hashrate_window gauge\nckb_hashrate_window %.6g\n"
+        "# TYPE ckb_hashrate_ema gauge\nckb_hashrate_ema %.6g\n"
+        "# TYPE ckb_block_interval_seconds gauge\nckb_block_interval_seconds %.3f\n"
+        "# TYPE ckb_wifi_up gauge\nckb_wifi_up %d\n"
+        "# TYPE ckb_wifi_rssi_dbm gauge\nckb_wifi_rssi_dbm %d\n"
+        "# TYPE ckb_wifi_boot_to_connected_ms gauge\nckb_wifi_boot_to_connected_ms %lu\n"
+        "# TYPE ckb_wifi_connect_ms gauge\nckb_wifi_connect_ms{path=\"%s\"} %lu\n"
+        "# TYPE ckb_wifi_connects_total counter\nckb_wifi_connects_total %lu\n"
+        "# TYPE ckb_wifi_fast_connects_total counter\nckb_wifi_fast_connects_total %lu\n"
+        "# TYPE ckb_wifi_failures_total counter\nckb_wifi_failures_total %lu\n"
+        "# TYPE ckb_wifi_disconnects_total counter\nckb_wifi_disconnects_total %lu\n"
+        "# TYPE ckb_wifi_down_seconds_total counter\nckb_wifi_down_seconds_total %.1f\n"
+        "# TYPE ckb_wifi_last_reason gauge\nckb_wifi_last_reason %u\n"
+        "# TYPE ckb_boot_first_frame_ms gauge\nckb_boot_first_frame_ms{snapshot=\"%s\"} %lu\n"
+        "# TYPE ckb_boot_live_frame_ms gauge\nckb_boot_live_frame_ms %lu\n"
+        "# TYPE ckb_snapshot_stores_total counter\nckb_snapshot_stores_total %lu\n"
+        "# TYPE ckb_snapshot_nvs_writes_total counter\nckb_snapshot_nvs_writes_total %lu\n",
+        (unsigned long long)st.node.height,
+        (unsigned long)st.node.peers,
+        (unsigned long)st.node.mempool_tx,
+        st.node.ok ? 1 : 0,
+        (unsigned long)st.node.query_count,
+        (unsigned long)st.hdr.count,
+        (unsigned long)st.hdr.backfilled,
+        (unsigned long)st.hdr.fetches,
+        (unsigned long)st.hdr.reorgs,
+        (unsigned long)st.hdr.last_depth,
+        (unsigned long)st.hdr.max_depth,
+        (unsigned long long)st.hdr.last_fork,
+        (unsigned long)st.pow.verified,
+        (unsigned long)st.pow.pow_checked,
+        (unsigned long)st.pow.bad_hash,
+        (unsigned long)st.pow.bad_pow,
+        (unsigned long)st.pow.dropped,
+        (unsigned long)st.pow.queue_max,
+        (unsigned long)st.pow.worst_us,
+        (unsigned long)st.pow.bench_hps,
+        (unsigned long)st.pow.bench_es_hps,
+        st.difficulty,
+        st.hashrate,
+        st.ema,
+        st.block_time,
+        wl.state == CKB_WIFI_UP ? 1 : 0,
+        (int)wl.rssi,
+        (unsigned long)wl.boot_ms,
+        ckb_wifi_path_name(wl.path), (unsigned long)wl.connect_ms,
+        (unsigned long)wl.connects,
+        (unsigned long)wl.fast,
+        (unsigned long)wl.failures,
+        (unsigned long)wl.disconnects,
+        wl.down_ms / 1000.0,
+        (unsigned)wl.reason,
+        ckb_snap_source_name(st.snap.source), (unsigned long)st.snap.frame_ms,
+        (unsigned long)st.snap.live_ms,
+        (unsigned long)st.snap.stores,
+        (unsigned long)st.snap.nvs_writes);
+
+    /* RPC router: totals, then one labelled series per endpoint */
+    ckb_fo_copy(&fo);
+    if (n > 0 && n < (int)sizeof(buf))
+        n += snprintf(buf + n, sizeof(buf) - n,
+            "# TYPE ckb_rpc_calls_total counter\nckb_rpc_calls_total %lu\n"
+            "# TYPE ckb_rpc_failed_total counter\nckb_rpc_failed_total %lu\n"
+            "# TYPE ckb_rpc_hedges_total counter\nckb_rpc_hedges_total %lu\n"
+            "# TYPE ckb_rpc_hedge_wins_total counter\nckb_rpc_hedge_wins_total %lu\n"
+            "# TYPE ckb_rpc_primary_switches_total counter\nckb_rpc_primary_switches_total %lu\n"
+            "# TYPE ckb_rpc_endpoint_latency_ewma_ms gauge\n"
+            "# TYPE ckb_rpc_endpoint_latency_p95_ms gauge\n"
+            "# TYPE ckb_rpc_endpoint_error_ratio gauge\n"
+            "# TYPE ckb_rpc_endpoint_breaker gauge\n"
+            "# TYPE ckb_rpc_endpoint_primary gauge\n"
+            "# TYPE ckb_rpc_endpoint_requests_total counter\n"
+            "# TYPE ckb_rpc_endpoint_errors_total counter\n"
+            "# TYPE ckb_rpc_endpoint_wins_total counter\n"
+            "# TYPE ckb_rpc_endpoint_hedges_total counter\n"
+            "# TYPE ckb_rpc_endpoint_trips_total counter\n",
+            (unsigned long)fo.calls, (unsigned long)fo.failed, (unsigned long)fo.hedges,
+            (unsigned long)fo.hedge_wins, (unsigned long)fo.switches);
+    for (uint8_t i = 0; i < fo.count && n > 0 && n < (int)sizeof(buf); i++) {
+        const ckb_fo_info_t &e = fo.ep[i];
+        n += snprintf(buf + n, sizeof(buf) - n,
+            "ckb_rpc_endpoint_latency_ewma_ms{ep=\"%s\"} %lu\n"
+            "ckb_rpc_endpoint_latency_p95_ms{ep=\"%s\"} %lu\n"
+            "ckb_rpc_endpoint_error_ratio{ep=\"%s\"} %.3f\n"
+            "ckb_rpc_endpoint_breaker{ep=\"%s\",state=\"%s\"} %u\n"
+            "ckb_rpc_endpoint_primary{ep=\"%s\"} %d\n"
+            "ckb_rpc_endpoint_requests_total{ep=\"%s\"} %lu\n"
+            "ckb_rpc_endpoint_errors_total{ep=\"%s\"} %lu\n"
+            "ckb_rpc_endpoint_wins_total{ep=\"%s\"} %lu\n"
+            "ckb_rpc_endpoint_hedges_total{ep=\"%s\"} %lu\n"
+            "ckb_rpc_endpoint_trips_total{ep=\"%s\"} %lu\n",
+            e.name, (unsigned long)e.ewma_ms,
+            e.name, (unsigned long)e.p95_ms,
+            e.name, e.err_pm / 1000.0,
+            e.name, ckb_fo_breaker_name(e.breaker), (unsigned)e.breaker,
+            e.name, i == fo.primary ? 1 : 0,
+            e.name, (unsigned long)e.calls,
+            e.name, (unsigned long)e.errors,
+            e.name, (unsigned long)e.wins,
+            e.name, (unsigned long)e.hedges,
+            e.name, (unsigned long)e.trips);
+    }
+
+    /* Power: per-state time and estimated draw, wakes, panel resume latency */
+    ckb_pwr_copy(&pw);
+    float mah, avg = ckb_pwr_avg_ma(pw, &mah);
+    if (n > 0 && n < (int)sizeof(buf))
+        n += snprintf(buf + n, sizeof(buf) - n,
+            "# TYPE ckb_power_state gauge\nckb_power_state{state=\"%s\",pm=\"%s\"} %u\n"
+            "# TYPE ckb_power_backlight_duty gauge\nckb_power_backlight_duty %u\n"
+            "# TYPE ckb_power_estimated_ma_avg gauge\nckb_power_estimated_ma_avg %.1f\n"
+            "# TYPE ckb_power_estimated_mah_total counter\nckb_power_estimated_mah_total %.2f\n"
+            "# TYPE ckb_power_resume_us gauge\nckb_power_resume_us %lu\n"
+            "# TYPE ckb_power_resume_max_us gauge\nckb_power_resume_max_us %lu\n"
+            "# TYPE ckb_power_slow_resumes_total counter\nckb_power_slow_resumes_total %lu\n"
+            "# TYPE ckb_power_state_seconds_total counter\n"
+            "# TYPE ckb_power_busy_seconds_total counter\n"
+            "# TYPE ckb_power_estimated_ma gauge\n"
+            "# TYPE ckb_power_wakes_total counter\n",
+            ckb_pwr_state_name(pw.state), ckb_pwr_pm_name(pw.pm), (unsigned)pw.state,
+            (unsigned)pw.duty, avg, mah,
+            (unsigned long)pw.resume_us,
+            (unsigned long)pw.resume_max_us,
+            (unsigned long)pw.slow_resumes);
+    for (uint8_t s = 0; s < CKB_PWR_STATES && n > 0 && n < (int)sizeof(buf); s++)
+        n += snprintf(buf + n, sizeof(buf) - n,
+            "ckb_power_state_seconds_total{state=\"%s\"} %.1f\n"
+            "ckb_power_busy_seconds_total{state=\"%s\"} %.1f\n"
+            "ckb_power_estimated_ma{state=\"%s\"} %.1f\n",
+            ckb_pwr_state_name(s), pw.ms[s] / 1000.0,
+            ckb_pwr_state_name(s), pw.busy_ms[s] / 1000.0,
+            ckb_pwr_state_name(s), ckb_pwr_ma(pw, s));
+    for (uint8_t w = 0; w < CKB_PWR_WAKE_SOURCES && n > 0 && n < (int)sizeof(buf); w++)
+        n += snprintf(buf + n, sizeof(buf) - n,
+            "ckb_power_wakes_total{source=\"%s\"} %lu\n",
+            ckb_pwr_wake_name(w), (unsigned long)pw.wakes[w]);
+    http_server.send(200, "text/plain; version=0.0.4", buf);
+}
+
 static void handle_broadcast() {
     if (http_server.method() != HTTP_POST) {
         http_server.send(405, "text/plain", "POST required");
@@ -533,7 +1207,18 @@ static void handle_broadcast() {
     String body = "{\"jsonrpc\":\"2.0\",\"method\":\"send_transaction\","
                   "\"params\":[" + tx_json + ",\"passthrough\"],\"id\":1}";
 
-    const char *url = (cfg.valid && cfg.node_url[0]) ? cfg.node_url : CKB_RPC;
+    /* Not hedged: a transaction goes to one node only, the current primary.
+     * Both sources are copies the loop task published, never cfg itself. */
+    static ckb_fo_snapshot_t fo;
+    static StatusPub st;
+    ckb_fo_copy(&fo);
+    char url[128];
+    if (fo.count) {
+        ckb_fo_url(fo, fo.primary, url, sizeof(url));
+    } else {
+        status_copy(&st);
+        snprintf(url, sizeof(url), "%s", st.rpc_url);
+    }
     HTTPClient http;
     http.begin(url);
     http.addHeader("Content-Type", "application/json");
@@ -551,41 +1236,127 @@ static void handle_broadcast() {
     Serial.println("[broadcast] tx forwarded: " + resp.substring(0, 80));
 }
 
+#if defined(CKB_MULTINODE)
+static void handle_nodes() {
+    static ckb_mn_snapshot_t snap;
+    static char buf[256 + CKB_MN_MAX_NODES * 192];
+    ckb_mn_copy(&snap);
+    int n = snprintf(buf, sizeof(buf),
+        "{\"best\":%llu,\"fork\":%s,\"fork_height\":%llu,\"lag\":%s,\"down\":%s,"
+        "\"cycle\":%lu,\"cycle_ms\":%lu,\"nodes\":[",
+        (unsigned long long)snap.best_tip,
+        (snap.alarm & CKB_MN_ALARM_FORK) ? "true" : "false",
+        (unsigned long long)snap.fork_height,
+        (snap.alarm & CKB_MN_ALARM_LAG) ? "true" : "false",
+        (snap.alarm & CKB_MN_ALARM_DOWN) ? "true" : "false",
+        (unsigned long)snap.cycle,
+        (unsigned long)snap.cycle_ms);
+    for (uint8_t i = 0; i < snap.count; i++) {
+        const ckb_mn_info_t &nd = snap.node[i];
+        n += snprintf(buf + n, sizeof(buf) - n,
+            "%s{\"name\":\"%s\",\"ok\":%s,\"tip\":%llu,\"lag\":%lu,\"peers\":%lu,"
+            "\"latency_ms\":%lu,\"forked\":%s,\"polls\":%lu,\"errors\":%lu}",
+            i ? "," : "", nd.name, nd.ok ? "true" : "false",
+            (unsigned long long)nd.tip, (unsigned long)nd.lag, (unsigned long)nd.peers,
+            (unsigned long)nd.latency_ms, nd.forked ? "true" : "false",
+            (unsigned long)nd.polls, (unsigned long)nd.errors);
+    }
+    snprintf(buf + n, sizeof(buf) - n, "]}");
+    http_server.send(200, "application/json", buf);
+}
+#endif
+
+/* Tiles are batched into chunks of about this size */
+#define SCREEN_CHUNK  4096
+
+static void handle_screen() {
+    uint32_t session = strtoul(http_server.arg("session").c_str(), nullptr, 10);
+    uint32_t since   = strtoul(http_server.arg("since").c_str(), nullptr, 10);
+    uint32_t t0 = millis();
+    ckb_screen_scan();
+    since = ckb_screen_since(session, since);
+    uint16_t count = ckb_screen_count(since);
+
+    http_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    http_server.sendHeader("Cache-Control", "no-store");
+    http_server.send(200, "application/octet-stream", "");
+
+    static uint8_t chunk[SCREEN_CHUNK + CKB_SCREEN_TILE_MAX];
+    size_t used = ckb_screen_header(chunk, since, count);
+    size_t total = 0;
+    for (uint16_t i = 0; i < ckb_screen_tiles(); i++) {
+        if (!ckb_screen_changed(i, since)) continue;
+        used += ckb_screen_encode(i, chunk + used);
+        if (used >= SCREEN_CHUNK) {
+            http_server.sendContent((const char *)chunk, used);
+            total += used;
+            used = 0;
+        }
+    }
+    if (used) http_server.sendContent((const char *)chunk, used);
+    total += used;
+    http_server.sendContent("");
+    Serial.printf("[screen] %u tiles, %u bytes, %lu ms\n",
+        count, (unsigned)total, (unsigned long)(millis() - t0));
+}
+
+/* The server runs in its own task on core 0 so requests are answered
+ * while the loop sleeps between polls, and a /screen transfer never
+ * delays a redraw on core 1 */
+static void http_task(void *) {
+    for (;;) {
+        http_server.handleClient();
+        vTaskDelay(pdMS_TO_TICKS(ckb_pwr_tick_ms(2)));
+    }
+}
+
 static void start_http_server() {
+    ckb_screen_begin(gfx->getFramebuffer(), W, H);
     http_server.on("/health",    HTTP_GET,  handle_health);
     http_server.on("/status",    HTTP_GET,  handle_status);
+    http_server.on("/metrics",   HTTP_GET,  handle_metrics);
+    http_server.on("/screen",    HTTP_GET,  handle_screen);
     http_server.on("/broadcast", HTTP_POST, handle_broadcast);
+    http_server.on("/config",    HTTP_GET,  handle_config_get);
+    http_server.on("/config",    HTTP_POST, handle_config_post);
+#if defined(CKB_MULTINODE)
+    http_server.on("/nodes",     HTTP_GET,  handle_nodes);
+#endif
+    static const char *headers[] = { "Authorization" };
+    http_server.collectHeaders(headers, 1);
     http_server.begin();
+    xTaskCreatePinnedToCore(http_task, "http", 8192, nullptr, 1, nullptr, 0);
     Serial.println("[HTTP] server started on :8080");
 }
 
 /* ═══════════════════════════════════════════════════════════════════
- * WIFI
+ * MAIN QUERY + RENDER
  * ═══════════════════════════════════════════════════════════════════ */
-static void connect_wifi() {
-    const char *ssid = (cfg.valid && cfg.wifi_ssid[0]) ? cfg.wifi_ssid : WIFI_SSID;
-    const char *pass = (cfg.valid && cfg.wifi_pass[0]) ? cfg.wifi_pass : WIFI_PASS;
-    Serial.printf("[WiFi] connecting to %s\n", ssid);
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, pass);
-    uint32_t t0 = millis();
-    while (WiFi.status() != WL_CONNECTED && millis() - t0 < 30000) delay(300);
-    if (WiFi.status() == WL_CONNECTED)
-        Serial.printf("[WiFi] IP: %s\n", WiFi.localIP().toString().c_str());
-    else
-        Serial.println("[WiFi] FAILED");
+/* Every section from state; backgrounds too when `full` */
+static void draw_dashboard(bool full) {
+    if (full) draw_chrome();
+    draw_header(state.ok);
+    draw_block_height(state.height);
+    draw_since(state.block_ts_ms);
+    draw_stats(state.peers, state.mempool_tx);
+    draw_hashrate();
+    draw_epoch(state.epoch_num, state.epoch_idx, state.epoch_len);
+    draw_footer();
 }
 
-/* ═══════════════════════════════════════════════════════════════════
- * MAIN QUERY + RENDER
- * ═══════════════════════════════════════════════════════════════════ */
+static void snap_save();
+static void power_chain(uint64_t tip_ts, bool new_block);
+
 static void update() {
+    uint32_t t0 = millis();
+    uint64_t prev = (state.query_count && !stale) ? state.height : 0;
     state.query_count++;
     bool ok = fetch_tip_header();
     if (ok) {
         fetch_peers();
         fetch_mempool();
-        if (state.query_count == 1) fetch_node_id(); /* once on first successful poll */
+        fetch_sync_state();
+        if (!state.node_id[0]) fetch_node_id(); /* once per node, on its first good poll */
         state.ok = true;
         state.last_ok_ms = millis();
         Serial.printf("[OK] height=%llu peers=%lu pool=%lu epoch=%llu %lu/%lu\n",
@@ -599,15 +1370,259 @@ static void update() {
         Serial.println("[ERR] RPC failed");
     }
 
-    draw_header(state.ok);
-    if (state.query_count == 1) draw_chrome(); /* full repaint on first update to clear any remnants */
+    /* Full repaint on the first update (or over the stale frame) to clear any
+     * remnants; the last-known frame stays up until a poll succeeds */
+    if (ok && state.height != prev) tip_seen_ms = millis();
+    if (ok || !stale) {
+        draw_dashboard(state.query_count == 1 || stale);
+        stale = false;
+    }
+    if (ok) {
+        snap_save();
+        power_chain(state.block_ts_ms, prev && state.height > prev);
+    }
+    publish_status();
+    ckb_pwr_busy(millis() - t0);
+}
+
+#if defined(CKB_MULTINODE)
+static ckb_mn_snapshot_t mn_snap;
+static int16_t           mn_rows = -1;   /* rows laid out; -1: chrome needed */
+
+static void draw_multinode() {
+    const ckb_mn_snapshot_t &snap = mn_snap;
+    if (mn_rows != snap.count) {         /* first cycle, or a new node list */
+        draw_chrome();
+        draw_mn_head();
+        mn_rows = snap.count;
+    }
+    draw_header(state.ok && !snap.alarm);
+    draw_block_height(snap.best_tip);
+    draw_mn_alarm(snap);
+    for (uint8_t i = 0; i < snap.count; i++) draw_mn_row(i, snap.node[i]);
+}
+
+/* Redraw once per finished poller cycle; the poller itself runs on core 0 */
+static void update_multinode() {
+    static uint8_t last_alarm = 0;
+    ckb_mn_snapshot_t &snap = mn_snap;
+    if (!ckb_mn_snapshot(&snap)) return;
+
+    uint64_t prev = (state.query_count && !stale) ? state.height : 0, tip_ts = 0;
+    state.query_count = snap.cycle;
+    state.height = snap.best_tip;
+    state.ok = false;
+    for (uint8_t i = 0; i < snap.count; i++) {
+        if (!snap.node[i].ok) continue;
+        state.ok = true;
+        if (snap.node[i].tip_ts > tip_ts) tip_ts = snap.node[i].tip_ts;
+    }
+    if (state.ok) state.last_ok_ms = millis();
+    Serial.printf("[mn] cycle %lu: best=%llu alarm=%02x %lu ms\n",
+        (unsigned long)snap.cycle, (unsigned long long)snap.best_tip,
+        snap.alarm, (unsigned long)snap.cycle_ms);
+    if (snap.alarm != last_alarm)
+        Serial.printf("[mn] alarm %02x -> %02x (fork height %llu)\n",
+            last_alarm, snap.alarm, (unsigned long long)snap.fork_height);
+    last_alarm = snap.alarm;
+    if (!stale || state.ok) {            /* else the last-known frame stays up */
+        if (stale) mn_rows = -1;
+        stale = false;
+        draw_multinode();
+    }
+    if (state.ok) {
+        snap_save();
+        power_chain(tip_ts, prev && state.height > prev);
+    }
+    publish_status();
+}
+#endif
+
+/* ═══════════════════════════════════════════════════════════════════
+ * INSTANT-ON (ckb_snapshot.h)
+ * ═══════════════════════════════════════════════════════════════════
+ * After every good poll the state goes to RTC memory (and now and then
+ * NVS). At boot it comes back before the radio is up: the dashboard is
+ * drawn from it, greyed, with a "last known" marker in the since bar,
+ * and stays that way until the first poll succeeds. */
+static const char *snap_key() {
+#if defined(CKB_MULTINODE)
+    return (cfg.valid && cfg.nodes[0]) ? cfg.nodes : CKB_NODES;
+#else
+    return (cfg.valid && cfg.node_url[0]) ? cfg.node_url : CKB_RPC;
+#endif
+}
+
+static void snap_save() {
+    ckb_snap_state_t s = {};
+    s.height      = state.height;
+    s.block_ts_ms = state.block_ts_ms;
+    s.epoch_num   = state.epoch_num;
+    s.best_known  = state.best_known;
+    s.peers       = state.peers;
+    s.mempool_tx  = state.mempool_tx;
+    s.epoch_idx   = state.epoch_idx;
+    s.epoch_len   = state.epoch_len;
+    memcpy(s.node_id, state.node_id, sizeof(s.node_id));
+    ckb_snap_store(s, snap_key(), millis());
+
+    ckb_snap_t &t = _ckb_snap;
+    if (t.live_ms) return;
+    t.live_ms = millis();
+    if (!t.frame_ms) t.frame_ms = t.live_ms;
+    Serial.printf("[boot] first frame %lu ms (%s), live data %lu ms\n",
+        (unsigned long)t.frame_ms, t.source ? "last known" : "live",
+        (unsigned long)t.live_ms);
+}
+
+static bool snap_restore() {
+    ckb_snap_state_t s;
+    if (!ckb_snap_load(s, snap_key())) return false;
+    state.height      = s.height;
+    state.block_ts_ms = s.block_ts_ms;
+    state.epoch_num   = s.epoch_num;
+    state.best_known  = s.best_known;
+    state.peers       = s.peers;
+    state.mempool_tx  = s.mempool_tx;
+    state.epoch_idx   = s.epoch_idx;
+    state.epoch_len   = s.epoch_len ? s.epoch_len : 1800;
+    memcpy(state.node_id, s.node_id, sizeof(state.node_id));
+    state.node_id[sizeof(state.node_id) - 1] = '\0';
+    state.ok = true;
+    Serial.printf("[snap] last known from %s: height %llu, %u headers of history\n",
+        ckb_snap_source_name(_ckb_snap.source), (unsigned long long)s.height,
+        (unsigned)_ckb_snap.restored_hist);
+    return true;
+}
+
+static void draw_stale() {
+#if defined(CKB_MULTINODE)
+    draw_chrome();
+    draw_header(true);
     draw_block_height(state.height);
-    draw_since(state.block_ts_ms);
-    draw_stats(state.peers, state.mempool_tx);
-    draw_epoch(state.epoch_num, state.epoch_idx, state.epoch_len);
-    draw_footer();
+#else
+    draw_dashboard(true);
+#endif
+    fill_section(SINCE_Y + 1, SINCE_H - 2, COL_PANEL);   /* room for the marker */
+    grey_frame();
+
+    const char *label = "Last known - reconnecting...";
+    gfx->setFont(FONT_SMALL);
+    gfx->setTextColor(COL_WARN);
+    gfx->setTextSize(1);
+    int16_t sx, sy; uint16_t stw, sth;
+    gfx->getTextBounds(label, 0, 0, &sx, &sy, &stw, &sth);
+    gfx->setCursor((W - stw)/2 - sx, SINCE_Y + 28);
+    gfx->print(label);
+    gfx->setFont(nullptr);
+    stale = true;
+    _ckb_snap.frame_ms = millis();
 }
 
+/* ═══════════════════════════════════════════════════════════════════
+ * POWER (ckb_power.h)
+ * ═══════════════════════════════════════════════════════════════════
+ * In quiet hours the panel stream is paused and the backlight off; the
+ * framebuffer is still drawn, so the panel resumes on the current frame.
+ * The touch controller is only polled while the panel is off or dimmed. */
+static GT911 touch;
+static bool  touch_ok = false;
+
+static void panel_pause()  { bus->pauseStream(); }
+static void panel_resume() { bus->resumeStream(); }
+
+/* After a good poll: the chain is the quiet-hours clock */
+static void power_chain(uint64_t tip_ts, bool new_block) {
+    ckb_pwr_clock(tip_ts, millis());
+    if (new_block) ckb_pwr_wake(CKB_PWR_WAKE_BLOCK, CKB_PWR_BLOCK_MS, millis());
+}
+
+static void power_tick() {
+    if (touch_ok && _ckb_pwr.info.state != CKB_PWR_ACTIVE && touch.update())
+        ckb_pwr_wake(CKB_PWR_WAKE_TOUCH, CKB_PWR_TOUCH_MS, millis());
+    ckb_pwr_tick(millis());
+}
+
+static void apply_power() {
+    const char *quiet = cfg.valid ? cfg.quiet : "";
+    if (!ckb_pwr_quiet(quiet, cfg.valid ? cfg.tz : ""))
+        Serial.printf("[pwr] no quiet hours%s%s\n", quiet[0] ? ", bad spec: " : "", quiet);
+    else
+        Serial.printf("[pwr] quiet hours %s (%s)\n", quiet, cfg.tz[0] ? cfg.tz : "UTC");
+}
+
+/* ═══════════════════════════════════════════════════════════════════
+ * LIVE CONFIG
+ * ═══════════════════════════════════════════════════════════════════
+ * Serial sessions and POST /config land here through ckb_config.h, on
+ * the loop task: nothing restarts, and only what changed is touched. */
+static void apply_colours() {
+    col_accent = cfg.valid ? cfg.accent_col : 0xFD00;
+    col_bg     = cfg.valid ? cfg.bg_col     : 0x0841;
+}
+
+#if !defined(CKB_MULTINODE)
+static void set_endpoints() {
+    const char *url = (cfg.valid && cfg.node_url[0]) ? cfg.node_url : CKB_RPC;
+    char buf[128];
+    ckb_fo_clear();
+    ckb_fo_add("main", url, strlen(url));
+    if (cfg.valid && cfg.nodes[0]) ckb_fo_add_list(cfg.nodes);
+    for (uint8_t i = 0; i < _ckb_fo.count; i++)
+        Serial.printf("[rpc] endpoint %s: %s\n", _ckb_fo.ep[i].name,
+            ckb_fo_url(_ckb_fo, i, buf, sizeof(buf)));
+}
+#endif
+
+static void apply_config() {
+    uint8_t ch = ckb_config_changes(cfg);
+    if (!ch) return;
+    Serial.printf("[cfg] applying live:%s%s%s%s%s\n",
+        ch & CKB_CFG_CH_WIFI ? " wifi" : "", ch & CKB_CFG_CH_URL ? " node_url" : "",
+        ch & CKB_CFG_CH_NODES ? " nodes" : "", ch & CKB_CFG_CH_COLOUR ? " colours" : "",
+        ch & CKB_CFG_CH_POWER ? " quiet" : "");
+
+    if (ch & CKB_CFG_CH_WIFI)
+        ckb_wifi_set((cfg.valid && cfg.wifi_ssid[0]) ? cfg.wifi_ssid : WIFI_SSID,
+                     (cfg.valid && cfg.wifi_pass[0]) ? cfg.wifi_pass : WIFI_PASS);
+#if defined(CKB_MULTINODE)
+    if (ch & CKB_CFG_CH_NODES) ckb_mn_set_list(cfg.nodes[0] ? cfg.nodes : CKB_NODES);
+    if (ch & CKB_CFG_CH_URL) publish_status();          /* /broadcast target */
+#else
+    if (ch & (CKB_CFG_CH_URL | CKB_CFG_CH_NODES)) set_endpoints();
+    if (ch & CKB_CFG_CH_URL) {
+        /* Possibly another chain: headers, hashrate and node id start over */
+        ckb_hdr_clear();
+        _ckb_hr = {};
+        state.node_id[0] = '\0';
+        state.best_known = 0;
+        publish_status();
+    }
+#endif
+    if (ch & CKB_CFG_CH_COLOUR) {
+        apply_colours();
+#if defined(CKB_MULTINODE)
+        mn_rows = -1;
+        if (mn_snap.cycle) draw_multinode();
+#else
+        if (state.query_count) draw_dashboard(true);
+#endif
+    }
+    if (ch & CKB_CFG_CH_POWER) apply_power();
+}
+
+#if defined(CKB_FONTS_PARTITION)
+static void load_fonts() {
+    /* Missing fonts fall back to the built-in 6x8 font via setFont(NULL) */
+    ckb_fonts_mount();
+    font_7seg_hero  = ckb_font("d7m48_num");
+    font_7seg_med   = ckb_font("d7m28_num");
+    font_7seg_small = ckb_font("d7m14");
+    font_label      = ckb_font("jmh_bold16");
+    font_small      = ckb_font("jmh_bold12");
+}
+#endif
+
 /* ═══════════════════════════════════════════════════════════════════
  * SETUP / LOOP
  * ═══════════════════════════════════════════════════════════════════ */
@@ -615,25 +1630,80 @@ void setup() {
     Serial.begin(115200);
     delay(500);
     Serial.println("[boot] CKB dashboard");
-    ckb_config_check(3000);  /* 3s window for browser config session */
+    ckb_config_start();      /* browser config sessions, any time (background task) */
     cfg = ckb_config_load();  /* load saved config (colours, wifi, url) */
+    apply_colours();
+    /* Radio first: it joins in the background while the panel comes up */
+    ckb_wifi_begin((cfg.valid && cfg.wifi_ssid[0]) ? cfg.wifi_ssid : WIFI_SSID,
+                   (cfg.valid && cfg.wifi_pass[0]) ? cfg.wifi_pass : WIFI_PASS);
+#if defined(CKB_FONTS_PARTITION)
+    load_fonts();
+#endif
 
     init_display();
-    pinMode(BL_PIN, OUTPUT);
-    digitalWrite(BL_PIN, LOW);
+    ckb_pwr_begin(BL_PIN, panel_pause, panel_resume);   /* backlight off, esp_pm */
     gfx->begin();
     gfx->fillScreen(0x0000);
-    digitalWrite(BL_PIN, HIGH);
-    delay(100);
-
-    draw_splash();
-    connect_wifi();
+    static const int16_t radii[] = { 6, 8, 11 };   /* status dot, epoch bar caps */
+    gfx->prewarmRadii(radii, sizeof(radii) / sizeof(radii[0]));
+    /* Last-known state straight away, or the splash if there is none */
+    if (snap_restore()) draw_stale();
+    else                draw_splash();
+    ckb_pwr_backlight(CKB_PWR_BRIGHT);
+    apply_power();
+    touch_ok = touch.begin();
+
+    if (ckb_hdr_begin())
+        Serial.printf("[hdr] cache: %u headers, %u KB PSRAM\n",
+            CKB_HDR_CAP, (unsigned)(sizeof(ckb_hdr_t) * CKB_HDR_CAP / 1024));
+    else
+        Serial.println("[hdr] cache allocation failed, reorg tracking off");
+    if (ckb_pow_begin(0))
+        Serial.printf("[pow] %s: %lu headers/s, %lu eaglesong/s\n",
+            !CKB_POW_EAGLESONG ? "blake2b hash only (no eaglesong tables)"
+            : CKB_POW_TESTNET ? "eaglesong + blake2b (testnet)" : "eaglesong (mainnet)",
+            (unsigned long)_ckb_pow.bench_hps, (unsigned long)_ckb_pow.bench_es_hps);
+
+    publish_status();
     start_http_server();
+#if defined(CKB_MULTINODE)
+    ckb_mn_add_list((cfg.valid && cfg.nodes[0]) ? cfg.nodes : CKB_NODES);
+    Serial.printf("[mn] watching %u nodes\n", ckb_mn_count());
+    ckb_mn_start(0);
+#else
+    if (!ckb_fo_begin())
+        Serial.println("[rpc] reply buffers allocation failed");
+    set_endpoints();
+#endif
     delay(200);
 }
 
 void loop() {
-    http_server.handleClient();
-    update();
-    delay(POLL_MS);
+    apply_config();
+    power_tick();
+#if defined(CKB_MULTINODE)
+    uint32_t t0 = millis();
+    update_multinode();
+    ckb_pwr_busy(millis() - t0);
+    delay(ckb_pwr_tick_ms(100));
+#else
+    /* Poll every POLL_MS, and at once when the link comes (back) up. The
+     * splash stays until the first join succeeds or has had CKB_WIFI_FULL_MS. */
+    static uint32_t last_poll = 0, last_connects = 0, last_gauge = 0;
+    uint32_t connects = _ckb_wifi.info.connects;
+    bool first = !state.query_count;
+    if (first && !connects && millis() < CKB_WIFI_FULL_MS) {
+        delay(ckb_pwr_tick_ms(20));
+        return;
+    }
+    if (first || connects != last_connects || millis() - last_poll >= POLL_MS) {
+        last_connects = connects;
+        last_poll = millis();
+        update();
+    } else if (millis() - last_gauge >= GAUGE_TICK_MS) {
+        last_gauge = millis();
+        if (state.ok && !stale && gauge_epoch.drawn) draw_gauges();   /* only the wedge that moved */
+    }
+    delay(ckb_pwr_tick_ms(20));
+#endif
 }
@@ -97,6 +97,13 @@ Arduino_GFX *gfx = new Arduino_ILI9341(bus, DF_GFX_RST, 3 /* rotation */, false
 
 #include "GifClass.h"
 static GifClass gifClass;
+static int16_t gif_x, gif_y;
+
+// changed-pixel callback: only runs whose colour differs from the last frame
+static void gifDrawSpan(gd_GIF *gif, uint16_t x, uint16_t y, uint16_t *pixels, uint16_t w)
+{
+  gfx->draw16bitRGBBitmap(gif_x + x, gif_y + y, pixels, w, 1);
+}
 
 void setup()
 {
@@ -176,8 +183,9 @@ void loop()
       }
       else
       {
-        int16_t x = (gfx->width() - gif->width) / 2;
-        int16_t y = (gfx->height() - gif->height) / 2;
+        gif_x = (gfx->width() - gif->width) / 2;
+        gif_y = (gfx->height() - gif->height) / 2;
+        gif->draw_span = gifDrawSpan; // gd_get_frame() draws as it decodes
 
         Serial.println(F("GIF video start"));
         int32_t t_fstart, t_delay = 0, t_real_delay, delay_until;
@@ -195,8 +203,6 @@ void loop()
           }
           else if (res > 0)
           {
-            gfx->drawIndexedBitmap(x, y, buf, gif->palette->colors, gif->width, gif->height);
-
             t_real_delay = t_delay - (millis() - t_fstart);
             duration += t_delay;
             remain += t_real_delay;
@@ -130,17 +130,17 @@ void Arduino_TFT_18bit::drawBitmap(int16_t x, int16_t y,
                                    uint16_t color, uint16_t bg)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -190,17 +190,17 @@ void Arduino_TFT_18bit::drawBitmap(int16_t x, int16_t y,
                                    uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -247,17 +247,17 @@ void Arduino_TFT_18bit::drawGrayscaleBitmap(int16_t x, int16_t y,
                                             const uint8_t bitmap[], int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -297,17 +297,17 @@ void Arduino_TFT_18bit::drawGrayscaleBitmap(int16_t x, int16_t y,
                                             uint8_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -347,17 +347,17 @@ void Arduino_TFT_18bit::drawIndexedBitmap(int16_t x, int16_t y,
                                           uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -388,17 +388,17 @@ void Arduino_TFT_18bit::draw16bitRGBBitmap(int16_t x, int16_t y,
                                            const uint16_t bitmap[], int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -441,17 +441,17 @@ void Arduino_TFT_18bit::draw16bitRGBBitmap(int16_t x, int16_t y,
                                            uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -529,17 +529,17 @@ void Arduino_TFT_18bit::draw16bitRGBBitmap(int16_t x, int16_t y,
                                            uint16_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -580,17 +580,17 @@ void Arduino_TFT_18bit::draw16bitBeRGBBitmap(int16_t x, int16_t y,
                                              uint16_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -630,17 +630,17 @@ void Arduino_TFT_18bit::draw24bitRGBBitmap(int16_t x, int16_t y,
                                            const uint8_t bitmap[], int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
@@ -679,17 +679,17 @@ void Arduino_TFT_18bit::draw24bitRGBBitmap(int16_t x, int16_t y,
                                            uint8_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
   }
   else if (
-      (x < 0) ||                // Clip left
-      (y < 0) ||                // Clip top
+      (x < _min_x) ||           // Clip left
+      (y < _min_y) ||           // Clip top
       ((x + w - 1) > _max_x) || // Clip right
       ((y + h - 1) > _max_y)    // Clip bottom
   )
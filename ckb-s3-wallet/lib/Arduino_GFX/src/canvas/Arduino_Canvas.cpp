@@ -6,13 +6,24 @@
 
 Arduino_Canvas::Arduino_Canvas(
     int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y)
-    : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y)
+    : Arduino_GFX(w, h), _framebuffer(NULL), _output(output), _output_x(output_x), _output_y(output_y)
 {
 }
 
+Arduino_Canvas::~Arduino_Canvas()
+{
+    if (_framebuffer)
+    {
+        free(_framebuffer);
+    }
+}
+
 void Arduino_Canvas::begin(int32_t speed)
 {
-    _output->begin(speed);
+    if (speed != GFX_SKIP_OUTPUT_BEGIN)
+    {
+        _output->begin(speed);
+    }
 
     size_t s = _width * _height * 2;
 #if defined(ESP32)
@@ -44,13 +55,14 @@ void Arduino_Canvas::begin(int32_t speed)
 
 void Arduino_Canvas::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
+    _dirty.add(x, y, 1, 1);
     _framebuffer[((int32_t)y * _width) + x] = color;
 }
 
 void Arduino_Canvas::writeFastVLine(int16_t x, int16_t y,
                                     int16_t h, uint16_t color)
 {
-    if (_ordered_in_range(x, 0, _max_x) && h)
+    if (_ordered_in_range(x, _min_x, _max_x) && h)
     { // X on screen, nonzero height
         if (h < 0)
         {               // If negative height...
@@ -60,19 +72,21 @@ void Arduino_Canvas::writeFastVLine(int16_t x, int16_t y,
         if (y <= _max_y)
         { // Not off bottom
             int16_t y2 = y + h - 1;
-            if (y2 >= 0)
+            if (y2 >= _min_y)
             { // Not off top
                 // Line partly or fully overlaps screen
-                if (y < 0)
+                if (y < _min_y)
                 {
-                    y = 0;
-                    h = y2 + 1;
+                    y = _min_y;
+                    h = y2 - _min_y + 1;
                 } // Clip top
                 if (y2 > _max_y)
                 {
                     h = _max_y - y + 1;
                 } // Clip bottom
 
+                _dirty.add(x, y, 1, h);
+
                 uint16_t *fb = _framebuffer + ((int32_t)y * _width) + x;
                 while (h--)
                 {
@@ -87,7 +101,7 @@ void Arduino_Canvas::writeFastVLine(int16_t x, int16_t y,
 void Arduino_Canvas::writeFastHLine(int16_t x, int16_t y,
                                     int16_t w, uint16_t color)
 {
-    if (_ordered_in_range(y, 0, _max_y) && w)
+    if (_ordered_in_range(y, _min_y, _max_y) && w)
     { // Y on screen, nonzero width
         if (w < 0)
         {               // If negative width...
@@ -97,19 +111,21 @@ void Arduino_Canvas::writeFastHLine(int16_t x, int16_t y,
         if (x <= _max_x)
         { // Not off right
             int16_t x2 = x + w - 1;
-            if (x2 >= 0)
+            if (x2 >= _min_x)
             { // Not off left
                 // Line partly or fully overlaps screen
-                if (x < 0)
+                if (x < _min_x)
                 {
-                    x = 0;
-                    w = x2 + 1;
+                    x = _min_x;
+                    w = x2 - _min_x + 1;
                 } // Clip left
                 if (x2 > _max_x)
                 {
                     w = _max_x - x + 1;
                 } // Clip right
 
+                _dirty.add(x, y, w, 1);
+
                 uint16_t *fb = _framebuffer + ((int32_t)y * _width) + x;
                 while (w--)
                 {
@@ -123,6 +139,7 @@ void Arduino_Canvas::writeFastHLine(int16_t x, int16_t y,
 void Arduino_Canvas::writeFillRectPreclipped(int16_t x, int16_t y,
                                              int16_t w, int16_t h, uint16_t color)
 {
+    _dirty.add(x, y, w, h);
     uint16_t *row = _framebuffer;
     row += y * _width;
     row += x;
@@ -140,10 +157,10 @@ void Arduino_Canvas::draw16bitRGBBitmap(int16_t x, int16_t y,
                                         uint16_t *bitmap, int16_t w, int16_t h)
 {
     if (
-        ((x + w - 1) < 0) || // Outside left
-        ((y + h - 1) < 0) || // Outside top
-        (x > _max_x) ||      // Outside right
-        (y > _max_y)         // Outside bottom
+        ((x + w - 1) < _min_x) || // Outside left
+        ((y + h - 1) < _min_y) || // Outside top
+        (x > _max_x) ||           // Outside right
+        (y > _max_y)              // Outside bottom
     )
     {
         return;
@@ -155,24 +172,25 @@ void Arduino_Canvas::draw16bitRGBBitmap(int16_t x, int16_t y,
         {
             h -= (y + h - 1) - _max_y;
         }
-        if (y < 0)
+        if (y < _min_y)
         {
-            bitmap -= y * w;
-            h += y;
-            y = 0;
+            bitmap += (_min_y - y) * w;
+            h -= _min_y - y;
+            y = _min_y;
         }
         if ((x + w - 1) > _max_x)
         {
             xskip = (x + w - 1) - _max_x;
             w -= xskip;
         }
-        if (x < 0)
+        if (x < _min_x)
         {
-            bitmap -= x;
-            xskip -= x;
-            w += x;
-            x = 0;
+            bitmap += _min_x - x;
+            xskip += _min_x - x;
+            w -= _min_x - x;
+            x = _min_x;
         }
+        _dirty.add(x, y, w, h);
         uint16_t *row = _framebuffer;
         row += y * _width;
         row += x;
@@ -192,10 +210,10 @@ void Arduino_Canvas::draw16bitBeRGBBitmap(int16_t x, int16_t y,
                                           uint16_t *bitmap, int16_t w, int16_t h)
 {
     if (
-        ((x + w - 1) < 0) || // Outside left
-        ((y + h - 1) < 0) || // Outside top
-        (x > _max_x) ||      // Outside right
-        (y > _max_y)         // Outside bottom
+        ((x + w - 1) < _min_x) || // Outside left
+        ((y + h - 1) < _min_y) || // Outside top
+        (x > _max_x) ||           // Outside right
+        (y > _max_y)              // Outside bottom
     )
     {
         return;
@@ -207,24 +225,25 @@ void Arduino_Canvas::draw16bitBeRGBBitmap(int16_t x, int16_t y,
         {
             h -= (y + h - 1) - _max_y;
         }
-        if (y < 0)
+        if (y < _min_y)
         {
-            bitmap -= y * w;
-            h += y;
-            y = 0;
+            bitmap += (_min_y - y) * w;
+            h -= _min_y - y;
+            y = _min_y;
         }
         if ((x + w - 1) > _max_x)
         {
             xskip = (x + w - 1) - _max_x;
             w -= xskip;
         }
-        if (x < 0)
+        if (x < _min_x)
         {
-            bitmap -= x;
-            xskip -= x;
-            w += x;
-            x = 0;
+            bitmap += _min_x - x;
+            xskip += _min_x - x;
+            w -= _min_x - x;
+            x = _min_x;
         }
+        _dirty.add(x, y, w, h);
         uint16_t *row = _framebuffer;
         row += y * _width;
         row += x;
@@ -243,8 +262,39 @@ void Arduino_Canvas::draw16bitBeRGBBitmap(int16_t x, int16_t y,
 }
 
 void Arduino_Canvas::flush()
+{
+    // Push only what changed since the last flush. Full-width rects go out
+    // in one call, narrower ones row by row since the output has no stride.
+    for (uint8_t i = 0; i < _dirty.count(); i++)
+    {
+        const Arduino_DirtyRect &r = _dirty.get(i);
+        int16_t w = r.x2 - r.x1 + 1;
+        uint16_t *row = _framebuffer + ((int32_t)r.y1 * _width) + r.x1;
+        if (w == _width)
+        {
+            _output->draw16bitRGBBitmap(_output_x, _output_y + r.y1, row, w, r.y2 - r.y1 + 1);
+        }
+        else
+        {
+            for (int16_t y = r.y1; y <= r.y2; y++)
+            {
+                _output->draw16bitRGBBitmap(_output_x + r.x1, _output_y + y, row, w, 1);
+                row += _width;
+            }
+        }
+    }
+    _dirty.clear();
+}
+
+void Arduino_Canvas::flushAll()
 {
     _output->draw16bitRGBBitmap(_output_x, _output_y, _framebuffer, _width, _height);
+    _dirty.clear();
+}
+
+uint16_t *Arduino_Canvas::getFramebuffer()
+{
+    return _framebuffer;
 }
 
 #endif // !defined(LITTLE_FOOT_PRINT)
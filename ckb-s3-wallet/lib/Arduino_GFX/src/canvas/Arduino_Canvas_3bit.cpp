@@ -11,7 +11,10 @@ Arduino_Canvas_3bit::Arduino_Canvas_3bit(int16_t w, int16_t h, Arduino_G *output
 
 void Arduino_Canvas_3bit::begin(int32_t speed)
 {
-    _output->begin(speed);
+    if (speed != GFX_SKIP_OUTPUT_BEGIN)
+    {
+        _output->begin(speed);
+    }
 
     size_t s = (_width * _height + 1) / 2;
 #if defined(ESP32)
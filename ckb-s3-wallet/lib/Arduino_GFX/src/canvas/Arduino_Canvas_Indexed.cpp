@@ -5,7 +5,7 @@
 #include "Arduino_Canvas_Indexed.h"
 
 Arduino_Canvas_Indexed::Arduino_Canvas_Indexed(int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y, uint8_t mask_level)
-    : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y)
+    : Arduino_GFX(w, h), _framebuffer(NULL), _output(output), _output_x(output_x), _output_y(output_y)
 {
     if (mask_level >= MAXMASKLEVEL)
     {
@@ -13,11 +13,23 @@ Arduino_Canvas_Indexed::Arduino_Canvas_Indexed(int16_t w, int16_t h, Arduino_G *
     }
     _current_mask_level = mask_level;
     _color_mask = mask_level_list[_current_mask_level];
+    memset(_color_hash, 0, sizeof(_color_hash));
+}
+
+Arduino_Canvas_Indexed::~Arduino_Canvas_Indexed()
+{
+    if (_framebuffer)
+    {
+        free(_framebuffer);
+    }
 }
 
 void Arduino_Canvas_Indexed::begin(int32_t speed)
 {
-    _output->begin(speed);
+    if (speed != GFX_SKIP_OUTPUT_BEGIN)
+    {
+        _output->begin(speed);
+    }
 
     size_t s = _width * _height;
 #if defined(ESP32)
@@ -40,13 +52,14 @@ void Arduino_Canvas_Indexed::begin(int32_t speed)
 
 void Arduino_Canvas_Indexed::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
+    _dirty.add(x, y, 1, 1);
     _framebuffer[((int32_t)y * _width) + x] = get_color_index(color);
 }
 
 void Arduino_Canvas_Indexed::writeFastVLine(int16_t x, int16_t y,
                                             int16_t h, uint16_t color)
 {
-    if (_ordered_in_range(x, 0, _max_x) && h)
+    if (_ordered_in_range(x, _min_x, _max_x) && h)
     { // X on screen, nonzero height
         if (h < 0)
         {               // If negative height...
@@ -56,19 +69,21 @@ void Arduino_Canvas_Indexed::writeFastVLine(int16_t x, int16_t y,
         if (y <= _max_y)
         { // Not off bottom
             int16_t y2 = y + h - 1;
-            if (y2 >= 0)
+            if (y2 >= _min_y)
             { // Not off top
                 // Line partly or fully overlaps screen
-                if (y < 0)
+                if (y < _min_y)
                 {
-                    y = 0;
-                    h = y2 + 1;
+                    y = _min_y;
+                    h = y2 - _min_y + 1;
                 } // Clip top
                 if (y2 > _max_y)
                 {
                     h = _max_y - y + 1;
                 } // Clip bottom
 
+                _dirty.add(x, y, 1, h);
+
                 uint8_t idx = get_color_index(color);
 
                 uint8_t *fb = _framebuffer + ((int32_t)y * _width) + x;
@@ -85,7 +100,7 @@ void Arduino_Canvas_Indexed::writeFastVLine(int16_t x, int16_t y,
 void Arduino_Canvas_Indexed::writeFastHLine(int16_t x, int16_t y,
                                             int16_t w, uint16_t color)
 {
-    if (_ordered_in_range(y, 0, _max_y) && w)
+    if (_ordered_in_range(y, _min_y, _max_y) && w)
     { // Y on screen, nonzero width
         if (w < 0)
         {               // If negative width...
@@ -95,19 +110,21 @@ void Arduino_Canvas_Indexed::writeFastHLine(int16_t x, int16_t y,
         if (x <= _max_x)
         { // Not off right
             int16_t x2 = x + w - 1;
-            if (x2 >= 0)
+            if (x2 >= _min_x)
             { // Not off left
                 // Line partly or fully overlaps screen
-                if (x < 0)
+                if (x < _min_x)
                 {
-                    x = 0;
-                    w = x2 + 1;
+                    x = _min_x;
+                    w = x2 - _min_x + 1;
                 } // Clip left
                 if (x2 > _max_x)
                 {
                     w = _max_x - x + 1;
                 } // Clip right
 
+                _dirty.add(x, y, w, 1);
+
                 uint8_t idx = get_color_index(color);
 
                 uint8_t *fb = _framebuffer + ((int32_t)y * _width) + x;
@@ -121,30 +138,83 @@ void Arduino_Canvas_Indexed::writeFastHLine(int16_t x, int16_t y,
 }
 
 void Arduino_Canvas_Indexed::flush()
+{
+    // Push only what changed since the last flush. Full-width rects go out
+    // in one call, narrower ones row by row since the output has no stride.
+    for (uint8_t i = 0; i < _dirty.count(); i++)
+    {
+        const Arduino_DirtyRect &r = _dirty.get(i);
+        int16_t w = r.x2 - r.x1 + 1;
+        uint8_t *row = _framebuffer + ((int32_t)r.y1 * _width) + r.x1;
+        if (w == _width)
+        {
+            _output->drawIndexedBitmap(_output_x, _output_y + r.y1, row, _color_index, w, r.y2 - r.y1 + 1);
+        }
+        else
+        {
+            for (int16_t y = r.y1; y <= r.y2; y++)
+            {
+                _output->drawIndexedBitmap(_output_x + r.x1, _output_y + y, row, _color_index, w, 1);
+                row += _width;
+            }
+        }
+    }
+    _dirty.clear();
+}
+
+void Arduino_Canvas_Indexed::flushAll()
 {
     _output->drawIndexedBitmap(_output_x, _output_y, _framebuffer, _color_index, _width, _height);
+    _dirty.clear();
 }
 
-uint8_t Arduino_Canvas_Indexed::get_color_index(uint16_t color)
+uint16_t *Arduino_Canvas_Indexed::find_color_slot(uint16_t color)
 {
-    color &= _color_mask;
-    for (uint8_t i = 0; i < _indexed_size; i++)
+    // Multiplicative hash on the masked 565 value, linear probing
+    uint16_t h = ((uint16_t)(color * 40503u)) >> 7;
+    while (true)
     {
-        if (_color_index[i] == color)
+        uint16_t *slot = &_color_hash[h & (COLOR_HASH_SIZE - 1)];
+        if ((*slot == 0) || (_color_index[*slot - 1] == color))
         {
-            return i;
+            return slot;
         }
+        h++;
     }
-    if (_indexed_size == (COLOR_IDX_SIZE - 1)) // overflowed
+}
+
+uint8_t Arduino_Canvas_Indexed::get_color_index(uint16_t color)
+{
+    color &= _color_mask;
+    if (_last_valid && (_last_color == color))
     {
-        raise_mask_level();
+        return _last_index;
     }
-    _color_index[_indexed_size] = color;
-    // Serial.print("color_index[");
-    // Serial.print(_indexed_size);
-    // Serial.print("] = ");
-    // Serial.println(color);
-    return _indexed_size++;
+
+    uint16_t *slot = find_color_slot(color);
+    if (*slot == 0)
+    {
+        if (_indexed_size == COLOR_IDX_SIZE) // overflowed
+        {
+            raise_mask_level();
+            color &= _color_mask;
+            slot = find_color_slot(color);
+        }
+        if (*slot == 0)
+        {
+            if (_indexed_size == COLOR_IDX_SIZE)
+            {
+                // Already at the coarsest mask level, reuse the last entry
+                return COLOR_IDX_SIZE - 1;
+            }
+            _color_index[_indexed_size] = color;
+            *slot = ++_indexed_size;
+        }
+    }
+    _last_color = color;
+    _last_index = *slot - 1;
+    _last_valid = true;
+    return _last_index;
 }
 
 uint16_t Arduino_Canvas_Indexed::get_index_color(uint8_t idx)
@@ -157,24 +227,28 @@ void Arduino_Canvas_Indexed::raise_mask_level()
     if ((_current_mask_level + 1) < MAXMASKLEVEL)
     {
         int32_t buffer_size = _width * _height;
-        uint8_t old_indexed_size = _indexed_size;
-        uint8_t new_color;
+        uint16_t old_indexed_size = _indexed_size;
+        uint16_t old_color_index[COLOR_IDX_SIZE];
+        uint8_t translate[COLOR_IDX_SIZE];
+
+        memcpy(old_color_index, _color_index, sizeof(old_color_index));
+        memset(translate, 0, sizeof(translate));
+        memset(_color_hash, 0, sizeof(_color_hash));
         _indexed_size = 0;
+        _last_valid = false;
         _color_mask = mask_level_list[++_current_mask_level];
         Serial.print("Raised mask level: ");
         Serial.println(_current_mask_level);
 
-        // update _framebuffer color index, it is a time consuming job
-        for (uint8_t old_color = 0; old_color < old_indexed_size; old_color++)
+        // Re-index the coarser palette, then remap the framebuffer in one pass
+        for (uint16_t old_color = 0; old_color < old_indexed_size; old_color++)
         {
-            new_color = get_color_index(_color_index[old_color]);
-            for (int32_t i = 0; i < buffer_size; i++)
-            {
-                if (_framebuffer[i] == old_color)
-                {
-                    _framebuffer[i] = new_color;
-                }
-            }
+            translate[old_color] = get_color_index(old_color_index[old_color]);
+        }
+        _last_valid = false;
+        for (int32_t i = 0; i < buffer_size; i++)
+        {
+            _framebuffer[i] = translate[_framebuffer[i]];
         }
     }
 }
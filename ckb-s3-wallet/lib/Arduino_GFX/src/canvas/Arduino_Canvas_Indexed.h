@@ -5,30 +5,42 @@
 #define _ARDUINO_CANVAS_INDEXED_H_
 
 #include "../Arduino_GFX.h"
+#include "Arduino_DirtyRegion.h"
 
 #define COLOR_IDX_SIZE 256
+#define COLOR_HASH_SIZE 512 // power of 2, 2x COLOR_IDX_SIZE keeps probes short
 
 class Arduino_Canvas_Indexed : public Arduino_GFX
 {
 public:
   Arduino_Canvas_Indexed(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0, uint8_t mask_level = 0);
+  ~Arduino_Canvas_Indexed();
 
   void begin(int32_t speed = GFX_NOT_DEFINED) override;
   void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
   void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
   void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
   void flush(void) override;
+  void flushAll(void);
 
   uint8_t get_color_index(uint16_t color);
   uint16_t get_index_color(uint8_t idx);
   void raise_mask_level();
 
+protected:
+  uint16_t *find_color_slot(uint16_t color);
+
 protected:
   uint8_t *_framebuffer;
   Arduino_G *_output;
   int16_t _output_x, _output_y;
+  Arduino_DirtyRegion _dirty;
   uint16_t _color_index[COLOR_IDX_SIZE];
-  uint8_t _indexed_size = 0;
+  uint16_t _color_hash[COLOR_HASH_SIZE]; // open addressed, palette index + 1, 0 = empty
+  uint16_t _indexed_size = 0;
+  uint16_t _last_color;
+  uint8_t _last_index;
+  bool _last_valid = false;
   uint8_t _current_mask_level;
   uint16_t _color_mask;
 #define MAXMASKLEVEL 3
@@ -0,0 +1,102 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "Arduino_DirtyRegion.h"
+
+static inline int32_t rect_area(const Arduino_DirtyRect &r)
+{
+  return (int32_t)(r.x2 - r.x1 + 1) * (r.y2 - r.y1 + 1);
+}
+
+static inline Arduino_DirtyRect rect_union(const Arduino_DirtyRect &a, const Arduino_DirtyRect &b)
+{
+  Arduino_DirtyRect u;
+  u.x1 = (a.x1 < b.x1) ? a.x1 : b.x1;
+  u.y1 = (a.y1 < b.y1) ? a.y1 : b.y1;
+  u.x2 = (a.x2 > b.x2) ? a.x2 : b.x2;
+  u.y2 = (a.y2 > b.y2) ? a.y2 : b.y2;
+  return u;
+}
+
+// Worth merging when the union wastes no more area than the two rects cover
+static inline bool rect_mergeable(const Arduino_DirtyRect &a, const Arduino_DirtyRect &b)
+{
+  return rect_area(rect_union(a, b)) <= 2 * (rect_area(a) + rect_area(b));
+}
+
+void Arduino_DirtyRegion::add(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if ((w <= 0) || (h <= 0))
+  {
+    return;
+  }
+  Arduino_DirtyRect r = {x, y, (int16_t)(x + w - 1), (int16_t)(y + h - 1)};
+
+  // Fast path: consecutive primitives usually land in the same rect
+  if (_count)
+  {
+    Arduino_DirtyRect &l = _rects[_last];
+    if ((r.x1 >= l.x1) && (r.y1 >= l.y1) && (r.x2 <= l.x2) && (r.y2 <= l.y2))
+    {
+      return;
+    }
+  }
+
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    if (rect_mergeable(_rects[i], r))
+    {
+      _rects[i] = rect_union(_rects[i], r);
+      absorb(i);
+      return;
+    }
+  }
+
+  if (_count < DIRTY_RECT_MAX)
+  {
+    _last = _count;
+    _rects[_count++] = r;
+    return;
+  }
+
+  // Full: grow the rect that gains the least area
+  uint8_t best = 0;
+  int32_t best_growth = INT32_MAX;
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    int32_t growth = rect_area(rect_union(_rects[i], r)) - rect_area(_rects[i]);
+    if (growth < best_growth)
+    {
+      best_growth = growth;
+      best = i;
+    }
+  }
+  _rects[best] = rect_union(_rects[best], r);
+  absorb(best);
+}
+
+// Merge every other rect that has become mergeable with the grown rect i
+void Arduino_DirtyRegion::absorb(uint8_t i)
+{
+  uint8_t j = 0;
+  while (j < _count)
+  {
+    if ((j != i) && rect_mergeable(_rects[i], _rects[j]))
+    {
+      _rects[i] = rect_union(_rects[i], _rects[j]);
+      _rects[j] = _rects[--_count];
+      if (i == _count)
+      {
+        i = j; // rect i was the one moved into slot j
+      }
+      j = 0; // union grew, rescan
+    }
+    else
+    {
+      j++;
+    }
+  }
+  _last = i;
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,592 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Canvas.h"
+#include "Arduino_DisplayList.h"
+
+// Records are padded to pointer alignment so fields can be read in place
+#define DL_ALIGN sizeof(void *)
+#define DL_PAD(n) (((n) + DL_ALIGN - 1) & ~(DL_ALIGN - 1))
+
+enum
+{
+  DL_RECT = 1,
+  DL_LINE,
+  DL_CHAR,
+  DL_BITMAP16
+};
+
+enum
+{
+  DL_FONT_PLAIN = 0,
+  DL_FONT_SUB
+};
+
+struct dl_rect_t
+{
+  uint8_t op;
+  uint16_t color;
+  int16_t x, y, w, h;
+};
+
+struct dl_line_t
+{
+  uint8_t op;
+  uint16_t color;
+  int16_t x0, y0, x1, y1;
+};
+
+struct dl_char_t
+{
+  uint8_t op;
+  uint8_t c;
+  uint8_t kind;
+  uint8_t margin;
+  uint8_t size_x, size_y;
+  uint16_t color, bg;
+  int16_t x, y;
+  int16_t bx, by, bw, bh; // everything the glyph touches, background included
+  const GFXfont *font;    // NULL = built-in 6x8 font
+};
+
+struct dl_bitmap_t
+{
+  uint8_t op;
+  int16_t x, y, w, h;
+  uint32_t hash; // content at record time, so diff() sees in-place edits
+  const uint16_t *bitmap;
+};
+
+static size_t dl_record_size(uint8_t op)
+{
+  switch (op)
+  {
+  case DL_RECT:
+    return DL_PAD(sizeof(dl_rect_t));
+  case DL_LINE:
+    return DL_PAD(sizeof(dl_line_t));
+  case DL_CHAR:
+    return DL_PAD(sizeof(dl_char_t));
+  default:
+    return DL_PAD(sizeof(dl_bitmap_t));
+  }
+}
+
+static void dl_bounds(const uint8_t *p, Arduino_DirtyRect *r)
+{
+  int16_t x, y, w, h;
+  switch (*p)
+  {
+  case DL_RECT:
+  {
+    const dl_rect_t *c = (const dl_rect_t *)p;
+    x = c->x, y = c->y, w = c->w, h = c->h;
+    break;
+  }
+  case DL_LINE:
+  {
+    const dl_line_t *c = (const dl_line_t *)p;
+    x = (c->x0 < c->x1) ? c->x0 : c->x1;
+    y = (c->y0 < c->y1) ? c->y0 : c->y1;
+    w = ((c->x0 < c->x1) ? c->x1 : c->x0) - x + 1;
+    h = ((c->y0 < c->y1) ? c->y1 : c->y0) - y + 1;
+    break;
+  }
+  case DL_CHAR:
+  {
+    const dl_char_t *c = (const dl_char_t *)p;
+    x = c->bx, y = c->by, w = c->bw, h = c->bh;
+    break;
+  }
+  default:
+  {
+    const dl_bitmap_t *c = (const dl_bitmap_t *)p;
+    x = c->x, y = c->y, w = c->w, h = c->h;
+    break;
+  }
+  }
+  r->x1 = x;
+  r->y1 = y;
+  r->x2 = x + w - 1;
+  r->y2 = y + h - 1;
+}
+
+static bool dl_intersects(const Arduino_DirtyRect &a, const Arduino_DirtyRect &b)
+{
+  return (a.x1 <= b.x2) && (b.x1 <= a.x2) && (a.y1 <= b.y2) && (b.y1 <= a.y2);
+}
+
+static bool dl_equal(const uint8_t *a, const uint8_t *b)
+{
+  return (*a == *b) && (memcmp(a, b, dl_record_size(*a)) == 0);
+}
+
+static uint32_t dl_hash(const uint16_t *bitmap, int32_t len)
+{
+  uint32_t h = 2166136261u; // FNV-1a over the pixels
+  while (len--)
+  {
+    h = (h ^ pgm_read_word(bitmap++)) * 16777619u;
+  }
+  return h;
+}
+
+// Add the on-screen part of every record in [p, q)
+static void dl_mark(const uint8_t *p, const uint8_t *q, const Arduino_DirtyRect &screen, Arduino_DirtyRegion *out)
+{
+  for (; p < q; p += dl_record_size(*p))
+  {
+    Arduino_DirtyRect r;
+    dl_bounds(p, &r);
+    if (dl_intersects(r, screen))
+    {
+      int16_t x1 = (r.x1 < screen.x1) ? screen.x1 : r.x1;
+      int16_t y1 = (r.y1 < screen.y1) ? screen.y1 : r.y1;
+      int16_t x2 = (r.x2 > screen.x2) ? screen.x2 : r.x2;
+      int16_t y2 = (r.y2 > screen.y2) ? screen.y2 : r.y2;
+      out->add(x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+    }
+  }
+}
+
+// Next record equal to rec within DISPLAY_LIST_LOOKAHEAD records from p
+static const uint8_t *dl_find(const uint8_t *rec, const uint8_t *p, const uint8_t *end)
+{
+  for (uint16_t n = 0; (p < end) && (n < DISPLAY_LIST_LOOKAHEAD); p += dl_record_size(*p), n++)
+  {
+    if (dl_equal(rec, p))
+    {
+      return p;
+    }
+  }
+  return NULL;
+}
+
+static void dl_set_font(Arduino_GFX *gfx, const dl_char_t *c)
+{
+  switch (c->kind)
+  {
+  case DL_FONT_SUB:
+    gfx->setFont((const GFXsubfont *)c->font);
+    break;
+  default:
+    gfx->setFont(c->font);
+    break;
+  }
+  gfx->setTextSize(c->size_x, c->size_y, c->margin);
+}
+
+Arduino_DisplayList::Arduino_DisplayList(int16_t w, int16_t h, size_t capacity)
+    : Arduino_GFX(w, h), _arena(NULL), _capacity(capacity), _used(0), _last(0), _count(0), _overflow(false)
+{
+}
+
+Arduino_DisplayList::~Arduino_DisplayList()
+{
+  if (_arena)
+  {
+    free(_arena);
+  }
+}
+
+void Arduino_DisplayList::begin(int32_t speed)
+{
+  UNUSED(speed);
+  if (_arena)
+  {
+    return;
+  }
+#if defined(ESP32)
+  if (psramFound())
+  {
+    _arena = (uint8_t *)ps_malloc(_capacity);
+  }
+  else
+  {
+    _arena = (uint8_t *)malloc(_capacity);
+  }
+#else
+  _arena = (uint8_t *)malloc(_capacity);
+#endif
+  if (!_arena)
+  {
+    Serial.println(F("display list allocation failed."));
+  }
+  clear();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Drop all recorded commands, keeping the arena
+*/
+/**************************************************************************/
+void Arduino_DisplayList::clear()
+{
+  _used = 0;
+  _count = 0;
+  _overflow = !_arena;
+}
+
+void *Arduino_DisplayList::append(uint8_t op, size_t len)
+{
+  len = DL_PAD(len);
+  if (_overflow || (_used + len > _capacity))
+  {
+    _overflow = true;
+    return NULL;
+  }
+  uint8_t *p = _arena + _used;
+  memset(p, 0, len); // padding takes part in diff() comparisons
+  *p = op;
+  _last = _used;
+  _used += len;
+  _count++;
+  return p;
+}
+
+void Arduino_DisplayList::appendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if (_count && !_overflow)
+  {
+    // grow the previous fill when this one continues it, e.g. glyph spans
+    dl_rect_t *r = (dl_rect_t *)(_arena + _last);
+    if ((r->op == DL_RECT) && (r->color == color))
+    {
+      if ((r->y == y) && (r->h == h) && (r->x + r->w == x))
+      {
+        r->w += w;
+        return;
+      }
+      if ((r->x == x) && (r->w == w) && (r->y + r->h == y))
+      {
+        r->h += h;
+        return;
+      }
+    }
+  }
+  dl_rect_t *r = (dl_rect_t *)append(DL_RECT, sizeof(dl_rect_t));
+  if (r)
+  {
+    r->color = color;
+    r->x = x;
+    r->y = y;
+    r->w = w;
+    r->h = h;
+  }
+}
+
+// Commands cut by a pushed clip rect are recorded as the spans they paint;
+// the screen edges alone never split a command
+bool Arduino_DisplayList::crossesClip(int16_t x, int16_t y, int16_t w, int16_t h) const
+{
+  return isClipped() &&
+         ((x < _min_x) || (y < _min_y) || ((x + w - 1) > _max_x) || ((y + h - 1) > _max_y));
+}
+
+void Arduino_DisplayList::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
+{
+  appendRect(x, y, 1, 1, color);
+}
+
+void Arduino_DisplayList::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  writeFillRect(x, y, 1, h, color);
+}
+
+void Arduino_DisplayList::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  writeFillRect(x, y, w, 1, color);
+}
+
+void Arduino_DisplayList::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  appendRect(x, y, w, h, color);
+}
+
+void Arduino_DisplayList::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  if (crossesClip((x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, _diff(x0, x1) + 1, _diff(y0, y1) + 1))
+  {
+    Arduino_GFX::writeLine(x0, y0, x1, y1, color);
+    return;
+  }
+  dl_line_t *l = (dl_line_t *)append(DL_LINE, sizeof(dl_line_t));
+  if (l)
+  {
+    l->color = color;
+    l->x0 = x0;
+    l->y0 = y0;
+    l->x1 = x1;
+    l->y1 = y1;
+  }
+}
+
+void Arduino_DisplayList::draw16bitRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h)
+{
+  if (crossesClip(x, y, w, h))
+  {
+    Arduino_GFX::draw16bitRGBBitmap(x, y, bitmap, w, h);
+    return;
+  }
+  dl_bitmap_t *b = (dl_bitmap_t *)append(DL_BITMAP16, sizeof(dl_bitmap_t));
+  if (b)
+  {
+    b->x = x;
+    b->y = y;
+    b->w = w;
+    b->h = h;
+    b->hash = dl_hash(bitmap, (int32_t)w * h);
+    b->bitmap = bitmap;
+  }
+}
+
+void Arduino_DisplayList::draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h)
+{
+  draw16bitRGBBitmap(x, y, (const uint16_t *)bitmap, w, h);
+}
+
+void Arduino_DisplayList::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg)
+{
+  int16_t bx, by, bw, bh;
+  uint8_t kind = DL_FONT_PLAIN;
+
+#if defined(U8G2_FONT_SUPPORT)
+  if (!gfxFont && u8g2Font)
+  {
+    // the glyph is decoded from write()'s state, record what it paints
+    Arduino_GFX::drawChar(x, y, c, color, bg);
+    return;
+  }
+#endif // defined(U8G2_FONT_SUPPORT)
+  if (gfxFont)
+  {
+    GFXglyph *glyph = getGlyph(c);
+    if (!glyph)
+    {
+      return;
+    }
+    uint8_t w = pgm_read_byte(&glyph->width),
+            h = pgm_read_byte(&glyph->height),
+            xAdvance = pgm_read_byte(&glyph->xAdvance),
+            yAdvance = pgm_read_byte(&gfxFont->yAdvance),
+            baseline = yAdvance * 2 / 3; // as in Arduino_GFX::drawChar()
+    int8_t xo = pgm_read_byte(&glyph->xOffset),
+           yo = pgm_read_byte(&glyph->yOffset);
+    bx = x + xo * textsize_x;
+    by = y + yo * textsize_y;
+    bw = w * textsize_x;
+    bh = h * textsize_y;
+    if (bg != color)
+    {
+      // union with the background block drawChar() fills
+      int16_t x1 = x;
+      int16_t y1 = y - (baseline * textsize_y);
+      int16_t x2 = x1 + ((xAdvance < w) ? w : xAdvance) * textsize_x;
+      int16_t y2 = y1 + yAdvance * textsize_y;
+      if (bx + bw > x2)
+        x2 = bx + bw;
+      if (by + bh > y2)
+        y2 = by + bh;
+      if (bx < x1)
+        x1 = bx;
+      if (by < y1)
+        y1 = by;
+      bx = x1;
+      by = y1;
+      bw = x2 - x1;
+      bh = y2 - y1;
+    }
+    kind = (gfxFontRemap || gfxFontRle) ? DL_FONT_SUB : DL_FONT_PLAIN;
+  }
+  else
+  {
+    bx = x;
+    by = y;
+    bw = 6 * textsize_x;
+    bh = 8 * textsize_y;
+  }
+  if (crossesClip(bx, by, bw, bh))
+  {
+    Arduino_GFX::drawChar(x, y, c, color, bg);
+    return;
+  }
+
+  dl_char_t *r = (dl_char_t *)append(DL_CHAR, sizeof(dl_char_t));
+  if (r)
+  {
+    r->c = c;
+    r->kind = kind;
+    r->margin = text_pixel_margin;
+    r->size_x = textsize_x;
+    r->size_y = textsize_y;
+    r->color = color;
+    r->bg = bg;
+    r->x = x;
+    r->y = y;
+    r->bx = bx;
+    r->by = by;
+    r->bw = bw;
+    r->bh = bh;
+    r->font = gfxFont;
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw the recorded commands on another target
+  @param  gfx     Target, e.g. a panel or a canvas
+  @param  dx      Offset added to every x coordinate
+  @param  dy      Offset added to every y coordinate
+  @note   Leaves the target's font and text size as the last glyph set them
+*/
+/**************************************************************************/
+void Arduino_DisplayList::replay(Arduino_GFX *gfx, int16_t dx, int16_t dy) const
+{
+  Arduino_DirtyRect all = {INT16_MIN, INT16_MIN, INT16_MAX, INT16_MAX};
+  replay(gfx, all, dx, dy);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw the recorded commands that touch a rectangle
+  @param  gfx     Target, e.g. a panel or a canvas
+  @param  clip    Commands outside this rectangle are skipped; the ones
+                  drawn are not clipped to it
+  @param  dx      Offset added to every x coordinate
+  @param  dy      Offset added to every y coordinate
+*/
+/**************************************************************************/
+void Arduino_DisplayList::replay(Arduino_GFX *gfx, const Arduino_DirtyRect &clip, int16_t dx, int16_t dy) const
+{
+  const dl_char_t *font = NULL;
+  const uint8_t *end = _arena + _used;
+  for (const uint8_t *p = _arena; p < end; p += dl_record_size(*p))
+  {
+    Arduino_DirtyRect r;
+    dl_bounds(p, &r);
+    if (!dl_intersects(r, clip))
+    {
+      continue;
+    }
+    switch (*p)
+    {
+    case DL_RECT:
+    {
+      const dl_rect_t *c = (const dl_rect_t *)p;
+      gfx->fillRect(c->x + dx, c->y + dy, c->w, c->h, c->color);
+      break;
+    }
+    case DL_LINE:
+    {
+      const dl_line_t *c = (const dl_line_t *)p;
+      gfx->drawLine(c->x0 + dx, c->y0 + dy, c->x1 + dx, c->y1 + dy, c->color);
+      break;
+    }
+    case DL_CHAR:
+    {
+      const dl_char_t *c = (const dl_char_t *)p;
+      if (!font || (font->font != c->font) || (font->kind != c->kind) ||
+          (font->size_x != c->size_x) || (font->size_y != c->size_y) || (font->margin != c->margin))
+      {
+        dl_set_font(gfx, c);
+        font = c;
+      }
+      gfx->drawChar(c->x + dx, c->y + dy, c->c, c->color, c->bg);
+      break;
+    }
+    default:
+    {
+      const dl_bitmap_t *c = (const dl_bitmap_t *)p;
+      gfx->draw16bitRGBBitmap(c->x + dx, c->y + dy, (uint16_t *)c->bitmap, c->w, c->h);
+      break;
+    }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Redraw only the given rectangles of an output, exactly clipped
+  @param  output  Where the pixels go, e.g. the panel
+  @param  region  Rectangles to redraw, typically from diff()
+  @return false if a scratch canvas could not be allocated
+  @note   Each rectangle is rendered into a scratch canvas and pushed in one
+          call, so the list must paint every pixel it owns (start screens
+          with fillScreen())
+*/
+/**************************************************************************/
+bool Arduino_DisplayList::replayRegion(Arduino_G *output, const Arduino_DirtyRegion &region) const
+{
+  for (uint8_t i = 0; i < region.count(); i++)
+  {
+    const Arduino_DirtyRect &r = region.get(i);
+    Arduino_Canvas canvas(r.x2 - r.x1 + 1, r.y2 - r.y1 + 1, output, r.x1, r.y1);
+    canvas.begin(GFX_SKIP_OUTPUT_BEGIN);
+    if (!canvas.getFramebuffer())
+    {
+      return false;
+    }
+    replay(&canvas, r, -r.x1, -r.y1);
+    canvas.flushAll();
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Rectangles where this list may paint differently from another
+  @param  prev    List currently on screen
+  @param  out     Receives the changed areas, clipped to the screen
+  @note   Commands are matched in order, resynchronising within
+          DISPLAY_LIST_LOOKAHEAD commands; every unmatched command of
+          either list contributes its bounds
+*/
+/**************************************************************************/
+void Arduino_DisplayList::diff(const Arduino_DisplayList &prev, Arduino_DirtyRegion *out) const
+{
+  if (_overflow || prev._overflow)
+  {
+    out->add(0, 0, _width, _height);
+    return;
+  }
+
+  const uint8_t *a = prev._arena, *a_end = prev._arena + prev._used;
+  const uint8_t *b = _arena, *b_end = _arena + _used;
+  Arduino_DirtyRect screen = {0, 0, (int16_t)(_width - 1), (int16_t)(_height - 1)};
+
+  while ((a < a_end) && (b < b_end))
+  {
+    if (dl_equal(a, b))
+    {
+      a += dl_record_size(*a);
+      b += dl_record_size(*b);
+      continue;
+    }
+    const uint8_t *a_next = a + dl_record_size(*a);
+    const uint8_t *b_next = b + dl_record_size(*b);
+    const uint8_t *in_b = dl_find(a, b_next, b_end); // commands inserted before a
+    const uint8_t *in_a = dl_find(b, a_next, a_end); // commands removed before b
+    if (in_b && (!in_a || (in_b - b) <= (in_a - a)))
+    {
+      dl_mark(b, in_b, screen, out);
+      b = in_b;
+    }
+    else if (in_a)
+    {
+      dl_mark(a, in_a, screen, out);
+      a = in_a;
+    }
+    else
+    {
+      dl_mark(a, a_next, screen, out);
+      dl_mark(b, b_next, screen, out);
+      a = a_next;
+      b = b_next;
+    }
+  }
+  dl_mark(a, a_end, screen, out);
+  dl_mark(b, b_end, screen, out);
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
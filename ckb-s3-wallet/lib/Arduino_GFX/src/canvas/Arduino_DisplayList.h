@@ -0,0 +1,69 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_DISPLAYLIST_H_
+#define _ARDUINO_DISPLAYLIST_H_
+
+#include "../Arduino_GFX.h"
+#include "Arduino_DirtyRegion.h"
+
+#ifndef DISPLAY_LIST_SIZE
+#define DISPLAY_LIST_SIZE 16384 ///< Default arena size in bytes
+#endif
+#ifndef DISPLAY_LIST_LOOKAHEAD
+#define DISPLAY_LIST_LOOKAHEAD 16 ///< Commands diff() searches ahead to resync
+#endif
+
+/// Draw target that records primitives instead of pixels. Fills, lines,
+/// glyphs and RGB565 bitmaps go into a fixed arena as compact commands that
+/// can be replayed to any Arduino_GFX, or diffed against another list to
+/// find the rectangles whose pixels may differ.
+///
+/// Bitmaps are recorded by pointer and must outlive the list. Glyphs keep
+/// the font pointer and text size they were drawn with. u8g2 glyphs, and
+/// lines, bitmaps and glyphs that cross a pushed clip rectangle, are
+/// recorded as the spans they paint.
+class Arduino_DisplayList : public Arduino_GFX
+{
+public:
+  Arduino_DisplayList(int16_t w, int16_t h, size_t capacity = DISPLAY_LIST_SIZE);
+  ~Arduino_DisplayList();
+
+  void begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
+  void draw16bitRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) override;
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg) override;
+
+  void clear(void);
+  size_t size(void) const { return _used; }
+  uint16_t count(void) const { return _count; }
+  bool overflowed(void) const { return _overflow; }
+
+  void replay(Arduino_GFX *gfx, int16_t dx = 0, int16_t dy = 0) const;
+  void replay(Arduino_GFX *gfx, const Arduino_DirtyRect &clip, int16_t dx = 0, int16_t dy = 0) const;
+  bool replayRegion(Arduino_G *output, const Arduino_DirtyRegion &region) const;
+  void diff(const Arduino_DisplayList &prev, Arduino_DirtyRegion *out) const;
+
+protected:
+  void *append(uint8_t op, size_t len);
+  void appendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  bool crossesClip(int16_t x, int16_t y, int16_t w, int16_t h) const;
+
+  uint8_t *_arena;
+  size_t _capacity;
+  size_t _used;
+  size_t _last; // offset of the last record, for merging adjacent fills
+  uint16_t _count;
+  bool _overflow;
+
+private:
+};
+
+#endif // _ARDUINO_DISPLAYLIST_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
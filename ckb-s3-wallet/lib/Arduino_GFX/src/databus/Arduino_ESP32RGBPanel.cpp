@@ -261,6 +261,46 @@ uint16_t *Arduino_ESP32RGBPanel::getFrameBuffer(
   return (uint16_t *)_rgb_panel->fb;
 }
 
+void Arduino_ESP32RGBPanel::pauseStream()
+{
+  if (!_rgb_panel || _paused)
+  {
+    return;
+  }
+  lcd_ll_stop(_rgb_panel->hal.dev);
+  gdma_stop(_rgb_panel->dma_chan);
+#if CONFIG_PM_ENABLE
+  // the driver holds a no-light-sleep lock for as long as the panel streams
+  if (_rgb_panel->pm_lock)
+  {
+    esp_pm_lock_release(_rgb_panel->pm_lock);
+  }
+#endif
+  _paused = true;
+}
+
+void Arduino_ESP32RGBPanel::resumeStream()
+{
+  if (!_rgb_panel || !_paused)
+  {
+    return;
+  }
+#if CONFIG_PM_ENABLE
+  if (_rgb_panel->pm_lock)
+  {
+    esp_pm_lock_acquire(_rgb_panel->pm_lock);
+  }
+#endif
+  // same sequence as the driver's start of transmission: the next frame
+  // starts from the first DMA descriptor, in step with VSYNC
+  gdma_reset(_rgb_panel->dma_chan);
+  lcd_ll_fifo_reset(_rgb_panel->hal.dev);
+  gdma_start(_rgb_panel->dma_chan, (intptr_t)_rgb_panel->dma_nodes);
+  delayMicroseconds(1);
+  lcd_ll_start(_rgb_panel->hal.dev);
+  _paused = false;
+}
+
 INLINE void Arduino_ESP32RGBPanel::CS_HIGH(void)
 {
   *_csPortSet = _csPinMask;
@@ -52,7 +52,7 @@ void Arduino_GC9503V_RGBPanel::writePixelPreclipped(int16_t x, int16_t y, uint16
 void Arduino_GC9503V_RGBPanel::writeFastVLine(int16_t x, int16_t y,
                                               int16_t h, uint16_t color)
 {
-  if (_ordered_in_range(x, 0, _max_x) && h)
+  if (_ordered_in_range(x, _min_x, _max_x) && h)
   { // X on screen, nonzero height
     if (h < 0)
     {             // If negative height...
@@ -62,13 +62,13 @@ void Arduino_GC9503V_RGBPanel::writeFastVLine(int16_t x, int16_t y,
     if (y <= _max_y)
     { // Not off bottom
       int16_t y2 = y + h - 1;
-      if (y2 >= 0)
+      if (y2 >= _min_y)
       { // Not off top
         // Line partly or fully overlaps screen
-        if (y < 0)
+        if (y < _min_y)
         {
-          y = 0;
-          h = y2 + 1;
+          y = _min_y;
+          h = y2 - _min_y + 1;
         } // Clip top
         if (y2 > _max_y)
         {
@@ -90,7 +90,7 @@ void Arduino_GC9503V_RGBPanel::writeFastVLine(int16_t x, int16_t y,
 void Arduino_GC9503V_RGBPanel::writeFastHLine(int16_t x, int16_t y,
                                               int16_t w, uint16_t color)
 {
-  if (_ordered_in_range(y, 0, _max_y) && w)
+  if (_ordered_in_range(y, _min_y, _max_y) && w)
   { // Y on screen, nonzero width
     if (w < 0)
     {             // If negative width...
@@ -100,13 +100,13 @@ void Arduino_GC9503V_RGBPanel::writeFastHLine(int16_t x, int16_t y,
     if (x <= _max_x)
     { // Not off right
       int16_t x2 = x + w - 1;
-      if (x2 >= 0)
+      if (x2 >= _min_x)
       { // Not off left
         // Line partly or fully overlaps screen
-        if (x < 0)
+        if (x < _min_x)
         {
-          x = 0;
-          w = x2 + 1;
+          x = _min_x;
+          w = x2 - _min_x + 1;
         } // Clip left
         if (x2 > _max_x)
         {
@@ -148,10 +148,10 @@ void Arduino_GC9503V_RGBPanel::draw16bitRGBBitmap(int16_t x, int16_t y,
                                                   uint16_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
@@ -163,23 +163,23 @@ void Arduino_GC9503V_RGBPanel::draw16bitRGBBitmap(int16_t x, int16_t y,
     {
       h -= (y + h - 1) - _max_y;
     }
-    if (y < 0)
+    if (y < _min_y)
     {
-      bitmap -= y * w;
-      h += y;
-      y = 0;
+      bitmap += (_min_y - y) * w;
+      h -= _min_y - y;
+      y = _min_y;
     }
     if ((x + w - 1) > _max_x)
     {
       xskip = (x + w - 1) - _max_x;
       w -= xskip;
     }
-    if (x < 0)
+    if (x < _min_x)
     {
-      bitmap -= x;
-      xskip -= x;
-      w += x;
-      x = 0;
+      bitmap += _min_x - x;
+      xskip += _min_x - x;
+      w -= _min_x - x;
+      x = _min_x;
     }
     uint16_t *row = _framebuffer;
     row += y * _width;
@@ -223,10 +223,10 @@ void Arduino_GC9503V_RGBPanel::draw16bitBeRGBBitmap(int16_t x, int16_t y,
                                                     uint16_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
@@ -238,23 +238,23 @@ void Arduino_GC9503V_RGBPanel::draw16bitBeRGBBitmap(int16_t x, int16_t y,
     {
       h -= (y + h - 1) - _max_y;
     }
-    if (y < 0)
+    if (y < _min_y)
     {
-      bitmap -= y * w;
-      h += y;
-      y = 0;
+      bitmap += (_min_y - y) * w;
+      h -= _min_y - y;
+      y = _min_y;
     }
     if ((x + w - 1) > _max_x)
     {
       xskip = (x + w - 1) - _max_x;
       w -= xskip;
     }
-    if (x < 0)
+    if (x < _min_x)
     {
-      bitmap -= x;
-      xskip -= x;
-      w += x;
-      x = 0;
+      bitmap += _min_x - x;
+      xskip += _min_x - x;
+      w -= _min_x - x;
+      x = _min_x;
     }
     uint16_t *row = _framebuffer;
     row += y * _width;
@@ -64,7 +64,7 @@ void Arduino_ST7701_RGBPanel::writePixelPreclipped(int16_t x, int16_t y, uint16_
 void Arduino_ST7701_RGBPanel::writeFastVLine(int16_t x, int16_t y,
                                              int16_t h, uint16_t color)
 {
-  if (_ordered_in_range(x, 0, _max_x) && h)
+  if (_ordered_in_range(x, _min_x, _max_x) && h)
   { // X on screen, nonzero height
     if (h < 0)
     {             // If negative height...
@@ -74,13 +74,13 @@ void Arduino_ST7701_RGBPanel::writeFastVLine(int16_t x, int16_t y,
     if (y <= _max_y)
     { // Not off bottom
       int16_t y2 = y + h - 1;
-      if (y2 >= 0)
+      if (y2 >= _min_y)
       { // Not off top
         // Line partly or fully overlaps screen
-        if (y < 0)
+        if (y < _min_y)
         {
-          y = 0;
-          h = y2 + 1;
+          y = _min_y;
+          h = y2 - _min_y + 1;
         } // Clip top
         if (y2 > _max_y)
         {
@@ -102,7 +102,7 @@ void Arduino_ST7701_RGBPanel::writeFastVLine(int16_t x, int16_t y,
 void Arduino_ST7701_RGBPanel::writeFastHLine(int16_t x, int16_t y,
                                              int16_t w, uint16_t color)
 {
-  if (_ordered_in_range(y, 0, _max_y) && w)
+  if (_ordered_in_range(y, _min_y, _max_y) && w)
   { // Y on screen, nonzero width
     if (w < 0)
     {             // If negative width...
@@ -112,13 +112,13 @@ void Arduino_ST7701_RGBPanel::writeFastHLine(int16_t x, int16_t y,
     if (x <= _max_x)
     { // Not off right
       int16_t x2 = x + w - 1;
-      if (x2 >= 0)
+      if (x2 >= _min_x)
       { // Not off left
         // Line partly or fully overlaps screen
-        if (x < 0)
+        if (x < _min_x)
         {
-          x = 0;
-          w = x2 + 1;
+          x = _min_x;
+          w = x2 - _min_x + 1;
         } // Clip left
         if (x2 > _max_x)
         {
@@ -160,10 +160,10 @@ void Arduino_ST7701_RGBPanel::draw16bitRGBBitmap(int16_t x, int16_t y,
                                                  uint16_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
@@ -175,23 +175,23 @@ void Arduino_ST7701_RGBPanel::draw16bitRGBBitmap(int16_t x, int16_t y,
     {
       h -= (y + h - 1) - _max_y;
     }
-    if (y < 0)
+    if (y < _min_y)
     {
-      bitmap -= y * w;
-      h += y;
-      y = 0;
+      bitmap += (_min_y - y) * w;
+      h -= _min_y - y;
+      y = _min_y;
     }
     if ((x + w - 1) > _max_x)
     {
       xskip = (x + w - 1) - _max_x;
       w -= xskip;
     }
-    if (x < 0)
+    if (x < _min_x)
     {
-      bitmap -= x;
-      xskip -= x;
-      w += x;
-      x = 0;
+      bitmap += _min_x - x;
+      xskip += _min_x - x;
+      w -= _min_x - x;
+      x = _min_x;
     }
     uint16_t *row = _framebuffer;
     row += y * _width;
@@ -235,10 +235,10 @@ void Arduino_ST7701_RGBPanel::draw16bitBeRGBBitmap(int16_t x, int16_t y,
                                                    uint16_t *bitmap, int16_t w, int16_t h)
 {
   if (
-      ((x + w - 1) < 0) || // Outside left
-      ((y + h - 1) < 0) || // Outside top
-      (x > _max_x) ||      // Outside right
-      (y > _max_y)         // Outside bottom
+      ((x + w - 1) < _min_x) || // Outside left
+      ((y + h - 1) < _min_y) || // Outside top
+      (x > _max_x) ||           // Outside right
+      (y > _max_y)              // Outside bottom
   )
   {
     return;
@@ -250,23 +250,23 @@ void Arduino_ST7701_RGBPanel::draw16bitBeRGBBitmap(int16_t x, int16_t y,
     {
       h -= (y + h - 1) - _max_y;
     }
-    if (y < 0)
+    if (y < _min_y)
     {
-      bitmap -= y * w;
-      h += y;
-      y = 0;
+      bitmap += (_min_y - y) * w;
+      h -= _min_y - y;
+      y = _min_y;
     }
     if ((x + w - 1) > _max_x)
     {
       xskip = (x + w - 1) - _max_x;
       w -= xskip;
     }
-    if (x < 0)
+    if (x < _min_x)
     {
-      bitmap -= x;
-      xskip -= x;
-      w += x;
-      x = 0;
+      bitmap += _min_x - x;
+      xskip += _min_x - x;
+      w -= _min_x - x;
+      x = _min_x;
     }
     uint16_t *row = _framebuffer;
     row += y * _width;
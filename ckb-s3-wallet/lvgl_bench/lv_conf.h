@@ -0,0 +1,45 @@
+/*
+ * lv_conf.h — LVGL 8.3 configuration for the Guition 4848S040
+ * Only settings that differ from LVGL's defaults are listed; the rest
+ * come from lv_conf_internal.h. Shared by the benchmark and the wallet UI.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#include <stdint.h>
+
+/* ── Colour: RGB565, native byte order (RGB panel, not SPI) ───── */
+#define LV_COLOR_DEPTH              16
+#define LV_COLOR_16_SWAP            0
+
+/* ── Memory: system heap, so large buffers land in PSRAM ──────── */
+#define LV_MEM_CUSTOM               1
+#define LV_MEM_CUSTOM_INCLUDE       <stdlib.h>
+#define LV_MEM_CUSTOM_ALLOC         malloc
+#define LV_MEM_CUSTOM_FREE          free
+#define LV_MEM_CUSTOM_REALLOC       realloc
+
+/* ── Timing ───────────────────────────────────────────────────── */
+#define LV_TICK_CUSTOM              1
+#define LV_TICK_CUSTOM_INCLUDE      "Arduino.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())
+#define LV_DISP_DEF_REFR_PERIOD     16
+#define LV_INDEV_DEF_READ_PERIOD    16
+#define LV_DPI_DEF                  170     /* 4" 480×480 */
+
+/* ── Diagnostics ──────────────────────────────────────────────── */
+#define LV_USE_LOG                  1
+#define LV_LOG_LEVEL                LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF               0
+#define LV_USE_PERF_MONITOR         1
+#define LV_USE_MEM_MONITOR          0
+
+/* ── Fonts ────────────────────────────────────────────────────── */
+#define LV_FONT_MONTSERRAT_12       1
+#define LV_FONT_MONTSERRAT_14       1
+#define LV_FONT_MONTSERRAT_16       1
+#define LV_FONT_MONTSERRAT_28       1
+#define LV_USE_FONT_COMPRESSED      1       /* benchmark fonts are compressed */
+
+#endif /* LV_CONF_H */
@@ -0,0 +1,99 @@
+/*
+ * LVGL Benchmark — Guition ESP32-S3-4848S040
+ * Runs the stock lv_demo_benchmark on the wallet's LVGL driver
+ * (src/ckb_lvgl.h) and prints the CSV report plus flush statistics
+ * over serial. Results are tracked in README.md → "LVGL baseline".
+ *
+ *   pio run -c platformio_lvgl_bench.ini -t upload -t monitor
+ *
+ * Add -DCKB_LVGL_DIRECT=0 to build_flags to measure the generic
+ * partial-buffer flush for comparison.
+ */
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <lvgl.h>
+#include "ckb_lvgl.h"
+#include "lv_demo_benchmark.h"
+
+/* ── Display ────────────────────────────────────────────────────── */
+#define GFX_BL 38
+#define W 480
+#define H 480
+
+static Arduino_ESP32RGBPanel   *bus = nullptr;
+static Arduino_ST7701_RGBPanel *gfx = nullptr;
+static GT911 touch;
+
+static void init_display() {
+    bus = new Arduino_ESP32RGBPanel(
+        39, 48, 47,
+        18, 17, 16, 21,
+        11,12,13,14,0,
+        8,20,3,46,9,10,
+        4,5,6,7,15);
+    gfx = new Arduino_ST7701_RGBPanel(
+        bus, GFX_NOT_DEFINED, 0, true, W, H,
+        st7701_type1_init_operations, sizeof(st7701_type1_init_operations), true,
+        10,8,50, 10,8,20);
+}
+
+/* ── Reporting ──────────────────────────────────────────────────── */
+static uint32_t bench_start_ms = 0;
+
+static void log_print(const char *buf) {
+    Serial.print(buf);
+}
+
+static void bench_finished() {
+    const ckb_lvgl_stats_t &s = ckb_lvgl_stats();
+    uint32_t secs = (millis() - bench_start_ms) / 1000;
+    Serial.println("\n[bench] flush statistics");
+    Serial.printf("[bench] driver      : %s\n", s.direct ? "direct" : "partial+push");
+    Serial.printf("[bench] run time    : %lu s\n", (unsigned long)secs);
+    Serial.printf("[bench] frames      : %lu (%lu flushes)\n",
+        (unsigned long)s.frames, (unsigned long)s.flushes);
+    Serial.printf("[bench] px/frame    : %lu\n",
+        (unsigned long)(s.frames ? s.pixels / s.frames : 0));
+    Serial.printf("[bench] flush us/frm: %lu\n",
+        (unsigned long)(s.frames ? s.flush_us / s.frames : 0));
+    Serial.printf("[bench] free heap   : %u internal, %u PSRAM\n",
+        (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+        (unsigned)ESP.getFreePsram());
+}
+
+/* ═══════════════════════════════════════════════════════════════════
+ * SETUP / LOOP
+ * ═══════════════════════════════════════════════════════════════════ */
+void setup() {
+    Serial.begin(115200);
+    delay(500);
+    Serial.println("[boot] LVGL benchmark");
+
+    init_display();
+    pinMode(GFX_BL, OUTPUT);
+    digitalWrite(GFX_BL, LOW);
+    gfx->begin();
+    gfx->fillScreen(0x0000);
+    digitalWrite(GFX_BL, HIGH);
+
+    bool has_touch = touch.begin();
+
+    lv_init();
+    lv_log_register_print_cb(log_print);
+    if (!ckb_lvgl_begin(gfx, has_touch ? &touch : nullptr)) {
+        Serial.println("[boot] LVGL driver init failed");
+        return;
+    }
+
+    lv_demo_benchmark_set_finished_cb(bench_finished);
+    lv_demo_benchmark_set_max_speed(true);
+    ckb_lvgl_stats_reset();
+    bench_start_ms = millis();
+    lv_demo_benchmark();
+}
+
+void loop() {
+    lv_timer_handler();
+    delay(1);
+}
@@ -0,0 +1,167 @@
+/*
+ * ckb_lvgl.h — LVGL 8 display + touch driver for the Guition 4848S040
+ * ====================================================================
+ * Display: LVGL renders straight into the ST7701 RGB panel framebuffer
+ * (direct mode). Only invalidated areas are redrawn; the flush callback
+ * writes the touched PSRAM lines back from the CPU cache so the LCD DMA
+ * sees them, and copies nothing. The generic path used by the Arduino_GFX
+ * LVGL examples (partial buffer in internal RAM, pushed with
+ * draw16bitRGBBitmap) is kept as a fallback for rotated panels and for
+ * comparison: build with -DCKB_LVGL_DIRECT=0.
+ *
+ * Touch: GT911 (gt911.h) as an LVGL pointer. The controller only raises
+ * a report when it has new data, so the last point is held between
+ * reports until it signals lift-off or goes quiet for
+ * CKB_LVGL_TOUCH_HOLD_MS.
+ *
+ * Needs lv_conf.h with LV_COLOR_DEPTH 16 and LV_COLOR_16_SWAP 0.
+ *
+ * Usage:
+ *   gfx->begin(); touch.begin();
+ *   ckb_lvgl_begin(gfx, &touch);        // after lv_init()
+ *   lv_timer_handler();                 // in loop()
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <lvgl.h>
+#include "gt911.h"
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 0
+#error "ckb_lvgl.h needs LV_COLOR_DEPTH 16 and LV_COLOR_16_SWAP 0"
+#endif
+
+#ifndef CKB_LVGL_DIRECT
+#define CKB_LVGL_DIRECT  1
+#endif
+#ifndef CKB_LVGL_BUF_LINES
+#define CKB_LVGL_BUF_LINES  40    /* fallback partial buffer, internal RAM */
+#endif
+#ifndef CKB_LVGL_TOUCH_HOLD_MS
+#define CKB_LVGL_TOUCH_HOLD_MS  80
+#endif
+
+/* ── Flush statistics (reset with ckb_lvgl_stats_reset) ────────── */
+struct ckb_lvgl_stats_t {
+    uint32_t flushes;      /* flush_cb calls */
+    uint32_t frames;       /* refresh cycles (last area of a frame) */
+    uint64_t pixels;       /* area pixels handed to the panel */
+    uint32_t flush_us;     /* time spent inside flush_cb */
+    bool     direct;       /* direct-mode driver active */
+};
+
+static ckb_lvgl_stats_t        _ckb_lvgl_stats = {};
+static Arduino_ST7701_RGBPanel *_ckb_lvgl_panel = nullptr;
+static GT911                   *_ckb_lvgl_touch = nullptr;
+static lv_disp_draw_buf_t      _ckb_lvgl_draw_buf;
+static lv_disp_drv_t           _ckb_lvgl_disp_drv;
+static lv_indev_drv_t          _ckb_lvgl_indev_drv;
+
+/* ── Display flush ─────────────────────────────────────────────── */
+/* Direct mode: pixels are already in the framebuffer */
+static void ckb_lvgl_flush_direct(lv_disp_drv_t *drv, const lv_area_t *a, lv_color_t *) {
+    uint32_t t0 = micros();
+    uint16_t *fb = _ckb_lvgl_panel->getFramebuffer();
+    int32_t  w   = drv->hor_res;
+    uint16_t *first = fb + (int32_t)a->y1 * w + a->x1;
+    uint16_t *last  = fb + (int32_t)a->y2 * w + a->x2;
+    Cache_WriteBack_Addr((uint32_t)first, (uint32_t)((last - first + 1) * 2));
+
+    _ckb_lvgl_stats.flushes++;
+    _ckb_lvgl_stats.pixels += (uint32_t)lv_area_get_size(a);
+    if (lv_disp_flush_is_last(drv)) _ckb_lvgl_stats.frames++;
+    _ckb_lvgl_stats.flush_us += micros() - t0;
+    lv_disp_flush_ready(drv);
+}
+
+/* Fallback: push the rendered area like the Arduino_GFX examples */
+static void ckb_lvgl_flush_push(lv_disp_drv_t *drv, const lv_area_t *a, lv_color_t *px) {
+    uint32_t t0 = micros();
+    _ckb_lvgl_panel->draw16bitRGBBitmap(a->x1, a->y1, (uint16_t *)&px->full,
+                                        lv_area_get_width(a), lv_area_get_height(a));
+
+    _ckb_lvgl_stats.flushes++;
+    _ckb_lvgl_stats.pixels += (uint32_t)lv_area_get_size(a);
+    if (lv_disp_flush_is_last(drv)) _ckb_lvgl_stats.frames++;
+    _ckb_lvgl_stats.flush_us += micros() - t0;
+    lv_disp_flush_ready(drv);
+}
+
+/* ── Touch read ────────────────────────────────────────────────── */
+static void ckb_lvgl_touch_read(lv_indev_drv_t *, lv_indev_data_t *data) {
+    static int16_t  last_x = 0, last_y = 0;
+    static bool     down = false;
+    static uint32_t last_report_ms = 0;
+
+    GT911 *t = _ckb_lvgl_touch;
+    if (t->update()) {
+        last_x = constrain(t->x, 0, _ckb_lvgl_disp_drv.hor_res - 1);
+        last_y = constrain(t->y, 0, _ckb_lvgl_disp_drv.ver_res - 1);
+        last_report_ms = millis();
+        down = true;
+    } else if (t->points == 0) {
+        down = false;                                   /* controller reported lift-off */
+    } else if (millis() - last_report_ms > CKB_LVGL_TOUCH_HOLD_MS) {
+        down = false;                                   /* reports stopped */
+    }
+
+    data->point.x = last_x;
+    data->point.y = last_y;
+    data->state   = down ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+}
+
+/* ── Init (call after lv_init(), gfx->begin() and touch.begin()) ─ */
+static lv_disp_t *ckb_lvgl_begin(Arduino_ST7701_RGBPanel *panel, GT911 *touch) {
+    _ckb_lvgl_panel = panel;
+    _ckb_lvgl_touch = touch;
+
+    uint16_t w = panel->width(), h = panel->height();
+    lv_disp_drv_init(&_ckb_lvgl_disp_drv);
+    _ckb_lvgl_disp_drv.hor_res = w;
+    _ckb_lvgl_disp_drv.ver_res = h;
+
+    /* The framebuffer is only in LVGL's coordinate space when unrotated */
+    uint16_t *fb = panel->getFramebuffer();
+    bool direct = CKB_LVGL_DIRECT && fb && panel->getRotation() == 0;
+    if (direct) {
+        lv_disp_draw_buf_init(&_ckb_lvgl_draw_buf, fb, NULL, (uint32_t)w * h);
+        _ckb_lvgl_disp_drv.direct_mode = 1;
+        _ckb_lvgl_disp_drv.flush_cb = ckb_lvgl_flush_direct;
+    } else {
+        uint32_t n = (uint32_t)w * CKB_LVGL_BUF_LINES;
+        lv_color_t *buf = (lv_color_t *)heap_caps_malloc(
+            n * sizeof(lv_color_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!buf) {
+            Serial.println("[lvgl] draw buffer allocation failed");
+            return nullptr;
+        }
+        lv_disp_draw_buf_init(&_ckb_lvgl_draw_buf, buf, NULL, n);
+        _ckb_lvgl_disp_drv.flush_cb = ckb_lvgl_flush_push;
+    }
+    _ckb_lvgl_disp_drv.draw_buf = &_ckb_lvgl_draw_buf;
+    lv_disp_t *disp = lv_disp_drv_register(&_ckb_lvgl_disp_drv);
+    _ckb_lvgl_stats.direct = direct;
+
+    if (touch) {
+        lv_indev_drv_init(&_ckb_lvgl_indev_drv);
+        _ckb_lvgl_indev_drv.type    = LV_INDEV_TYPE_POINTER;
+        _ckb_lvgl_indev_drv.read_cb = ckb_lvgl_touch_read;
+        lv_indev_drv_register(&_ckb_lvgl_indev_drv);
+    }
+
+    Serial.printf("[lvgl] %ux%u %s\n", w, h,
+        direct ? "direct to panel framebuffer" : "partial buffer + push");
+    return disp;
+}
+
+static const ckb_lvgl_stats_t &ckb_lvgl_stats() {
+    return _ckb_lvgl_stats;
+}
+
+static void ckb_lvgl_stats_reset() {
+    bool direct = _ckb_lvgl_stats.direct;
+    _ckb_lvgl_stats = {};
+    _ckb_lvgl_stats.direct = direct;
+}
@@ -0,0 +1,283 @@
+/*
+ * ckb_mjpeg.h — Dual-core pipelined MJPEG player for splash / idle screens
+ * ========================================================================
+ * The ImgViewerMjpeg example reads, decodes and draws each frame in turn
+ * on one core. Here the two halves overlap:
+ *
+ *   reader  (core 0)  frames the stream with MjpegClass::readMjpegBuf()
+ *                     into one of two PSRAM frame slots
+ *   decoder (core 1)  decodes the other slot with JPEGDEC; every MCU strip
+ *                     is copied straight into the ST7701 framebuffer and
+ *                     written back from cache — no draw16bitRGBBitmap,
+ *                     no intermediate canvas
+ *
+ * Slots travel between the tasks on two queues (free → full → free), so
+ * the reader works on frame n+1 while frame n decodes. The JPEGDEC
+ * instance (and its MCU buffers) is static, i.e. in internal RAM.
+ *
+ * Frame-rate governor: frame k is due at start + k / fps. Early frames
+ * wait for their slot; a frame that is already more than one period late
+ * when the decoder gets to it is dropped instead of decoded, so a busy
+ * UI loop on core 1 only costs frames, never a growing backlog.
+ *
+ * Nothing else may draw inside the player's rectangle while it runs.
+ *
+ * Needs JPEGDEC (bitbank2/JPEGDEC) and the Arduino_GFX ImgViewerMjpeg
+ * example directory on the include path (see platformio.ini, -splash env).
+ *
+ * Usage:
+ *   File f = LittleFS.open("/splash.mjpeg");
+ *   ckb_mjpeg_play(gfx, f, 0, 280, 480, 200, 15, true);
+ *   ...                                   // boot work continues meanwhile
+ *   ckb_mjpeg_stop();                     // before drawing over the area
+ *   ckb_mjpeg_report();
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <Arduino_GFX_Library.h>
+#include "MjpegClass.h"
+
+#ifndef CKB_MJPEG_SLOT_BYTES
+#define CKB_MJPEG_SLOT_BYTES  (64 * 1024)   /* largest compressed frame */
+#endif
+#define CKB_MJPEG_SLOTS       2
+#define CKB_MJPEG_END         0xFF          /* reader → decoder: stream over */
+
+/* ── Statistics (ckb_mjpeg_report prints them) ─────────────────── */
+struct ckb_mjpeg_stats_t {
+    uint32_t shown;           /* frames decoded to the panel */
+    uint32_t dropped;         /* late frames skipped by the governor */
+    uint32_t oversized;       /* frames over CKB_MJPEG_SLOT_BYTES, skipped */
+    uint64_t read_us;         /* reader: framing time */
+    uint64_t decode_us;       /* decoder: decode incl. blit */
+    uint64_t blit_us;         /* decoder: framebuffer copies */
+    uint64_t latency_us;      /* framed → on panel, summed over shown */
+    uint32_t latency_max_us;
+    uint32_t start_ms, end_ms;
+};
+
+struct ckb_mjpeg_slot_t {
+    uint8_t *buf;
+    int32_t  len;
+    uint32_t seq;             /* frame index in the stream timeline */
+    uint32_t framed_us;
+};
+
+static Arduino_ST7701_RGBPanel *_ckb_mjpeg_panel = nullptr;
+static fs::File          _ckb_mjpeg_file;
+static MjpegClass        _ckb_mjpeg_reader;
+static JPEGDEC           _ckb_mjpeg_jpeg;
+static ckb_mjpeg_slot_t  _ckb_mjpeg_slot[CKB_MJPEG_SLOTS];
+static QueueHandle_t     _ckb_mjpeg_free = nullptr;
+static QueueHandle_t     _ckb_mjpeg_full = nullptr;
+static SemaphoreHandle_t _ckb_mjpeg_done = nullptr;
+static volatile bool     _ckb_mjpeg_stop = false;
+static bool              _ckb_mjpeg_running = false;
+static bool              _ckb_mjpeg_loop = false;
+static uint32_t          _ckb_mjpeg_period_us = 0;
+static int16_t           _ckb_mjpeg_rx, _ckb_mjpeg_ry, _ckb_mjpeg_rw, _ckb_mjpeg_rh;
+static int16_t           _ckb_mjpeg_ox, _ckb_mjpeg_oy;   /* image origin */
+static int16_t           _ckb_mjpeg_ow, _ckb_mjpeg_oh;   /* image size after scaling */
+static int               _ckb_mjpeg_scale = -1;
+static ckb_mjpeg_stats_t _ckb_mjpeg_stats = {};
+
+/* ── Blit: MCU strip → framebuffer ─────────────────────────────── */
+static int ckb_mjpeg_draw(JPEGDRAW *d) {
+    uint32_t t0 = micros();
+    int16_t pw = _ckb_mjpeg_panel->width();
+    uint16_t *fb = _ckb_mjpeg_panel->getFramebuffer();
+
+    /* MCU strips are padded to 8/16 px; clip to the image rectangle */
+    int16_t x1 = _ckb_mjpeg_ox + _ckb_mjpeg_ow;
+    int16_t y1 = _ckb_mjpeg_oy + _ckb_mjpeg_oh;
+    int16_t w = (d->x + d->iWidth > x1) ? x1 - d->x : d->iWidth;
+    int16_t h = (d->y + d->iHeight > y1) ? y1 - d->y : d->iHeight;
+    if (w <= 0 || h <= 0) return 1;
+
+    const uint16_t *src = d->pPixels;
+    uint16_t *dst = fb + (int32_t)d->y * pw + d->x;
+    for (int16_t r = 0; r < h; r++, src += d->iWidth, dst += pw)
+        memcpy(dst, src, w * 2);
+
+    uint16_t *first = fb + (int32_t)d->y * pw + d->x;
+    Cache_WriteBack_Addr((uint32_t)first, (uint32_t)((dst - pw + w - first) * 2));
+    _ckb_mjpeg_stats.blit_us += micros() - t0;
+    return 1;
+}
+
+/* Pick a power-of-two scale that fits the rectangle, centre the image */
+static void ckb_mjpeg_fit(int iw, int ih) {
+    int shift = 0;
+    while (shift < 3 && ((iw >> shift) > _ckb_mjpeg_rw || (ih >> shift) > _ckb_mjpeg_rh)) shift++;
+    static const int scales[] = { 0, JPEG_SCALE_HALF, JPEG_SCALE_QUARTER, JPEG_SCALE_EIGHTH };
+    _ckb_mjpeg_scale = scales[shift];
+    _ckb_mjpeg_ow = min((int)_ckb_mjpeg_rw, iw >> shift);
+    _ckb_mjpeg_oh = min((int)_ckb_mjpeg_rh, ih >> shift);
+    _ckb_mjpeg_ox = _ckb_mjpeg_rx + (_ckb_mjpeg_rw - _ckb_mjpeg_ow) / 2;
+    _ckb_mjpeg_oy = _ckb_mjpeg_ry + (_ckb_mjpeg_rh - _ckb_mjpeg_oh) / 2;
+}
+
+/* ── Reader task (core 0) ──────────────────────────────────────── */
+static void ckb_mjpeg_reader_task(void *) {
+    uint32_t seq = 0;
+    uint8_t idx;
+    while (!_ckb_mjpeg_stop) {
+        if (xQueueReceive(_ckb_mjpeg_free, &idx, pdMS_TO_TICKS(20)) != pdTRUE) continue;
+        ckb_mjpeg_slot_t &s = _ckb_mjpeg_slot[idx];
+
+        uint32_t t0 = micros();
+        _ckb_mjpeg_reader.setMjpegBuf(s.buf, CKB_MJPEG_SLOT_BYTES);
+        bool ok = _ckb_mjpeg_file.available() && _ckb_mjpeg_reader.readMjpegBuf();
+        if (!ok && _ckb_mjpeg_loop && seq > 0) {
+            _ckb_mjpeg_file.seek(0);                        /* rewind, keep the timeline */
+            _ckb_mjpeg_reader.setup(&_ckb_mjpeg_file, s.buf, ckb_mjpeg_draw, false,
+                                    _ckb_mjpeg_rx, _ckb_mjpeg_ry, _ckb_mjpeg_rw, _ckb_mjpeg_rh);
+            _ckb_mjpeg_reader.setMjpegBuf(s.buf, CKB_MJPEG_SLOT_BYTES);
+            ok = _ckb_mjpeg_reader.readMjpegBuf();
+        }
+        _ckb_mjpeg_stats.read_us += micros() - t0;
+        if (!ok) {
+            xQueueSend(_ckb_mjpeg_free, &idx, 0);
+            break;
+        }
+
+        s.len = _ckb_mjpeg_reader.getMjpegBufLen();
+        if (s.len > CKB_MJPEG_SLOT_BYTES) {
+            /* Only the head fit: decoding it would burn time on a corrupt
+             * frame. The stream is still in sync, so read the next one. */
+            _ckb_mjpeg_stats.oversized++;
+            xQueueSend(_ckb_mjpeg_free, &idx, 0);
+            continue;
+        }
+        s.seq = seq++;
+        s.framed_us = micros();
+        xQueueSend(_ckb_mjpeg_full, &idx, portMAX_DELAY);
+    }
+    idx = CKB_MJPEG_END;
+    xQueueSend(_ckb_mjpeg_full, &idx, portMAX_DELAY);
+    xSemaphoreGive(_ckb_mjpeg_done);
+    vTaskDelete(NULL);
+}
+
+/* ── Decoder task (core 1) ─────────────────────────────────────── */
+static void ckb_mjpeg_decoder_task(void *) {
+    uint32_t start_us = 0;
+    uint8_t idx;
+    for (;;) {
+        if (xQueueReceive(_ckb_mjpeg_full, &idx, pdMS_TO_TICKS(20)) != pdTRUE) {
+            if (_ckb_mjpeg_stop) break;
+            continue;
+        }
+        if (idx == CKB_MJPEG_END) break;
+        ckb_mjpeg_slot_t &s = _ckb_mjpeg_slot[idx];
+
+        /* Governor: frame k is due at start + k periods */
+        uint32_t now = micros();
+        if (s.seq == 0) start_us = now;
+        int32_t late = (int32_t)(now - (start_us + s.seq * _ckb_mjpeg_period_us));
+        if (late > (int32_t)_ckb_mjpeg_period_us || _ckb_mjpeg_stop) {
+            _ckb_mjpeg_stats.dropped++;
+            xQueueSend(_ckb_mjpeg_free, &idx, 0);
+            continue;
+        }
+        if (late < -1000) vTaskDelay(pdMS_TO_TICKS(-late / 1000));
+
+        uint32_t t0 = micros();
+        if (_ckb_mjpeg_jpeg.openRAM(s.buf, s.len, ckb_mjpeg_draw)) {
+            if (_ckb_mjpeg_scale < 0) ckb_mjpeg_fit(_ckb_mjpeg_jpeg.getWidth(), _ckb_mjpeg_jpeg.getHeight());
+            _ckb_mjpeg_jpeg.setMaxOutputSize(_ckb_mjpeg_ow / 16 > 0 ? _ckb_mjpeg_ow / 16 : 1);
+            _ckb_mjpeg_jpeg.decode(_ckb_mjpeg_ox, _ckb_mjpeg_oy, _ckb_mjpeg_scale);
+            _ckb_mjpeg_jpeg.close();
+        }
+        uint32_t t1 = micros();
+        _ckb_mjpeg_stats.decode_us += t1 - t0;
+        uint32_t lat = t1 - s.framed_us;
+        _ckb_mjpeg_stats.latency_us += lat;
+        if (lat > _ckb_mjpeg_stats.latency_max_us) _ckb_mjpeg_stats.latency_max_us = lat;
+        _ckb_mjpeg_stats.shown++;
+        xQueueSend(_ckb_mjpeg_free, &idx, 0);
+    }
+    _ckb_mjpeg_stats.end_ms = millis();
+    xSemaphoreGive(_ckb_mjpeg_done);
+    vTaskDelete(NULL);
+}
+
+/* ── Control ───────────────────────────────────────────────────── */
+/* Play file into the rectangle at fps; loop restarts at end of stream */
+static bool ckb_mjpeg_play(Arduino_ST7701_RGBPanel *panel, fs::File file,
+                           int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint8_t fps, bool loop) {
+    if (_ckb_mjpeg_running || !panel || !panel->getFramebuffer() || !file || fps == 0) return false;
+    if (x < 0 || y < 0 || x + w > panel->width() || y + h > panel->height()) return false;
+
+    for (int i = 0; i < CKB_MJPEG_SLOTS; i++) {
+        if (!_ckb_mjpeg_slot[i].buf)
+            _ckb_mjpeg_slot[i].buf = (uint8_t *)heap_caps_malloc(CKB_MJPEG_SLOT_BYTES, MALLOC_CAP_SPIRAM);
+        if (!_ckb_mjpeg_slot[i].buf) {
+            Serial.println("[mjpeg] frame slot allocation failed");
+            return false;
+        }
+    }
+    if (!_ckb_mjpeg_free) {
+        _ckb_mjpeg_free = xQueueCreate(CKB_MJPEG_SLOTS, 1);
+        _ckb_mjpeg_full = xQueueCreate(CKB_MJPEG_SLOTS + 1, 1);
+        _ckb_mjpeg_done = xSemaphoreCreateCounting(2, 0);
+    }
+    xQueueReset(_ckb_mjpeg_free);
+    xQueueReset(_ckb_mjpeg_full);
+    for (uint8_t i = 0; i < CKB_MJPEG_SLOTS; i++) xQueueSend(_ckb_mjpeg_free, &i, 0);
+
+    _ckb_mjpeg_panel = panel;
+    _ckb_mjpeg_file = file;
+    _ckb_mjpeg_loop = loop;
+    _ckb_mjpeg_period_us = 1000000UL / fps;
+    _ckb_mjpeg_rx = x; _ckb_mjpeg_ry = y; _ckb_mjpeg_rw = w; _ckb_mjpeg_rh = h;
+    _ckb_mjpeg_scale = -1;
+    _ckb_mjpeg_stats = {};
+    _ckb_mjpeg_stats.start_ms = millis();
+    _ckb_mjpeg_stop = false;
+    _ckb_mjpeg_reader.setup(&_ckb_mjpeg_file, _ckb_mjpeg_slot[0].buf, ckb_mjpeg_draw, false, x, y, w, h);
+
+    _ckb_mjpeg_running = true;
+    xTaskCreatePinnedToCore(ckb_mjpeg_reader_task, "mjpeg_rd", 4096, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(ckb_mjpeg_decoder_task, "mjpeg_dec", 6144, NULL, 1, NULL, 1);
+    Serial.printf("[mjpeg] playing %s at %u fps\n", file.name(), fps);
+    return true;
+}
+
+/* Stop both tasks; returns once the framebuffer is no longer written */
+static void ckb_mjpeg_stop() {
+    if (!_ckb_mjpeg_running) return;
+    _ckb_mjpeg_stop = true;
+    xSemaphoreTake(_ckb_mjpeg_done, portMAX_DELAY);
+    xSemaphoreTake(_ckb_mjpeg_done, portMAX_DELAY);
+    _ckb_mjpeg_running = false;
+    _ckb_mjpeg_file.close();
+}
+
+/* False once stopped or a non-looping stream has ended */
+static bool ckb_mjpeg_playing() {
+    return _ckb_mjpeg_running && !_ckb_mjpeg_stop && _ckb_mjpeg_stats.end_ms == 0;
+}
+
+static const ckb_mjpeg_stats_t &ckb_mjpeg_stats() {
+    return _ckb_mjpeg_stats;
+}
+
+static void ckb_mjpeg_report() {
+    const ckb_mjpeg_stats_t &s = _ckb_mjpeg_stats;
+    uint32_t end = s.end_ms ? s.end_ms : millis();
+    uint32_t ms = end - s.start_ms;
+    uint32_t n = s.shown ? s.shown : 1;
+    Serial.printf("[mjpeg] %lu shown, %lu dropped, %lu oversized in %lu ms: %.1f fps\n",
+        (unsigned long)s.shown, (unsigned long)s.dropped, (unsigned long)s.oversized,
+        (unsigned long)ms, ms ? 1000.0f * s.shown / ms : 0.0f);
+    Serial.printf("[mjpeg] per frame: read %lu us, decode %lu us, blit %lu us\n",
+        (unsigned long)(s.read_us / (s.shown + s.dropped ? s.shown + s.dropped : 1)),
+        (unsigned long)((s.decode_us - s.blit_us) / n), (unsigned long)(s.blit_us / n));
+    Serial.printf("[mjpeg] latency framed->panel: avg %lu us, max %lu us\n",
+        (unsigned long)(s.latency_us / n), (unsigned long)s.latency_max_us);
+}
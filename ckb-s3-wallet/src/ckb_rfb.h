@@ -0,0 +1,759 @@
+/*
+ * ckb_rfb.h — Minimal RFB (VNC) server for an RGB565 framebuffer
+ * ===============================================================
+ * Lets a stock VNC viewer watch and operate the panel. One client at a
+ * time, RFB 3.3 / 3.7 / 3.8.
+ *
+ * Security: with r.password set the server offers only VNC
+ * authentication (DES challenge-response, first 8 characters) and takes
+ * pointer input from viewers that passed it. Without a password it
+ * offers None and is view-only: pointer events are read and dropped.
+ * VNC authentication keeps other LAN hosts from driving the UI; it does
+ * not encrypt the session.
+ *
+ * Updates: the framebuffer is cut into 16×16 tiles (the Hextile grid).
+ * Each tile's hash is compared with the hash last sent to the client;
+ * runs of changed tiles along a tile row become one rectangle. The
+ * framebuffer is only read, one tile row at a time with io.yield() in
+ * between. Incremental requests with nothing changed stay pending and
+ * are rescanned every CKB_RFB_SCAN_MS.
+ *
+ * Encodings: Hextile, RRE and Raw — whichever the client lists first.
+ * Rectangles (and Hextile tiles) that would encode larger than raw are
+ * sent raw. Any true-colour client pixel format at 8/16/32 bpp works.
+ *
+ * Input: pointer events go to on_pointer(buttons, x, y) once the viewer
+ * has authenticated; keys and clipboard are ignored.
+ *
+ * The server only talks through ckb_rfb_io_t, so the same code runs on
+ * the device (WiFiClient) and on a host (sockets, tools/rfb_host.cpp).
+ *
+ * Usage:
+ *   static ckb_rfb_t rfb;
+ *   ckb_rfb_init(rfb, fb, W, H, "CKB Wallet");
+ *   rfb.on_pointer = my_pointer;
+ *   rfb.password = "secret";             // NULL / "": view-only
+ *   if (ckb_rfb_handshake(rfb, io))
+ *       while (ckb_rfb_poll(rfb, millis())) delay(10);
+ *   else if (rfb.auth_failures) ...      // back off before the next accept
+ */
+
+#pragma once
+
+#if defined(ESP32)
+#include <Arduino.h>
+#include <esp_random.h>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#endif
+
+#define CKB_RFB_TILE        16
+#define CKB_RFB_MAX_TILES   1024
+#define CKB_RFB_MAX_W       1024
+#define CKB_RFB_OUT_SIZE    4096
+#ifndef CKB_RFB_SCAN_MS
+#define CKB_RFB_SCAN_MS     100
+#endif
+
+#define CKB_RFB_SEC_NONE     1
+#define CKB_RFB_SEC_VNC      2
+
+#define CKB_RFB_ENC_RAW      0
+#define CKB_RFB_ENC_RRE      2
+#define CKB_RFB_ENC_HEXTILE  5
+
+/* Hextile sub-encoding bits */
+#define CKB_HEX_RAW          0x01
+#define CKB_HEX_BG           0x02
+#define CKB_HEX_FG           0x04
+#define CKB_HEX_SUBRECTS     0x08
+#define CKB_HEX_COLOURED     0x10
+
+/* dirty[] flags */
+#define CKB_RFB_CHANGED      0x01
+#define CKB_RFB_FORCED       0x02
+
+struct ckb_rfb_io_t {
+    bool (*read)(void *ctx, uint8_t *buf, size_t n);         /* exactly n, false on error */
+    bool (*write)(void *ctx, const uint8_t *buf, size_t n);  /* all of it, false on error */
+    int  (*available)(void *ctx);                            /* bytes readable now, < 0 closed */
+    void (*yield)(void *ctx);                                /* optional, NULL = none */
+    void *ctx;
+};
+
+typedef void (*ckb_rfb_pointer_fn)(uint8_t buttons, uint16_t x, uint16_t y);
+
+struct ckb_rfb_t {
+    const uint16_t *fb;
+    uint16_t w, h;
+    const char *name;
+    ckb_rfb_io_t io;
+    ckb_rfb_pointer_fn on_pointer;
+    const char *password;                          /* VNC auth; NULL / "": view-only */
+    bool     input;                                /* this viewer may send pointer events */
+
+    /* Client pixel format */
+    uint8_t  bytes_pp;
+    bool     big_endian;
+    uint32_t lut_r[32], lut_g[64], lut_b[32];
+    int32_t  encoding;
+
+    /* Outstanding FramebufferUpdateRequest */
+    bool     pending;
+    uint16_t req_x, req_y, req_w, req_h;
+    uint32_t last_scan_ms;
+
+    /* Dirty tracking, relative to what this client has */
+    uint8_t  tiles_x, tiles_y;
+    uint32_t sent[CKB_RFB_MAX_TILES];
+    uint32_t now[CKB_RFB_MAX_TILES];
+    uint8_t  dirty[CKB_RFB_MAX_TILES];
+
+    /* Encoder scratch */
+    uint16_t done[CKB_RFB_MAX_W];                  /* bit y set = pixel (x, y) covered */
+    uint16_t tile_px[CKB_RFB_TILE * CKB_RFB_TILE];
+    uint8_t  tile_out[1 + 2 * 4 + 1 + 255 * 6];
+    uint8_t  out[CKB_RFB_OUT_SIZE];
+    size_t   used;
+    bool     io_ok;
+
+    /* Statistics */
+    uint32_t updates, rects, bytes;
+    uint32_t auth_failures;                        /* since ckb_rfb_init() */
+};
+
+/* ── Output ────────────────────────────────────────────────────── */
+static void ckb_rfb_flush(ckb_rfb_t &r) {
+    if (r.used && r.io_ok) r.io_ok = r.io.write(r.io.ctx, r.out, r.used);
+    r.bytes += r.used;
+    r.used = 0;
+}
+
+/* Room for n contiguous bytes (n <= CKB_RFB_OUT_SIZE) */
+static uint8_t *ckb_rfb_reserve(ckb_rfb_t &r, size_t n) {
+    if (r.used + n > CKB_RFB_OUT_SIZE) ckb_rfb_flush(r);
+    uint8_t *p = r.out + r.used;
+    r.used += n;
+    return p;
+}
+
+static uint8_t *ckb_rfb_be16(uint8_t *p, uint16_t v) { p[0] = v >> 8; p[1] = v; return p + 2; }
+static uint8_t *ckb_rfb_be32(uint8_t *p, uint32_t v) {
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+    return p + 4;
+}
+static uint16_t ckb_rfb_get16(const uint8_t *p) { return (uint16_t)(p[0] << 8 | p[1]); }
+static uint32_t ckb_rfb_get32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+/* RGB565 → client pixel */
+static uint8_t *ckb_rfb_pixel(const ckb_rfb_t &r, uint8_t *p, uint16_t c) {
+    uint32_t v = r.lut_r[c >> 11] | r.lut_g[(c >> 5) & 0x3F] | r.lut_b[c & 0x1F];
+    if (r.bytes_pp == 1) {
+        *p++ = v;
+    } else if (r.bytes_pp == 2) {
+        if (r.big_endian) { *p++ = v >> 8; *p++ = v; }
+        else              { *p++ = v; *p++ = v >> 8; }
+    } else {
+        if (r.big_endian) { *p++ = v >> 24; *p++ = v >> 16; *p++ = v >> 8; *p++ = v; }
+        else              { *p++ = v; *p++ = v >> 8; *p++ = v >> 16; *p++ = v >> 24; }
+    }
+    return p;
+}
+
+/* ── Pixel format ──────────────────────────────────────────────── */
+static void ckb_rfb_lut(uint32_t *lut, uint8_t src_bits, uint16_t max, uint8_t shift) {
+    uint16_t src_max = (1 << src_bits) - 1;
+    for (uint16_t v = 0; v <= src_max; v++)
+        lut[v] = ((uint32_t)(v * max + src_max / 2) / src_max) << shift;
+}
+
+/* pf: the 16-byte RFB PIXEL_FORMAT */
+static bool ckb_rfb_set_format(ckb_rfb_t &r, const uint8_t *pf) {
+    uint8_t bpp = pf[0];
+    if ((bpp != 8 && bpp != 16 && bpp != 32) || !pf[3]) return false;   /* no colour maps */
+    r.bytes_pp   = bpp / 8;
+    r.big_endian = pf[2] != 0;
+    ckb_rfb_lut(r.lut_r, 5, ckb_rfb_get16(pf + 4), pf[10]);
+    ckb_rfb_lut(r.lut_g, 6, ckb_rfb_get16(pf + 6), pf[11]);
+    ckb_rfb_lut(r.lut_b, 5, ckb_rfb_get16(pf + 8), pf[12]);
+    return true;
+}
+
+/* Native format: RGB565 little-endian, what ServerInit advertises */
+static void ckb_rfb_native_format(uint8_t *pf) {
+    memset(pf, 0, 16);
+    pf[0] = 16; pf[1] = 16; pf[2] = 0; pf[3] = 1;
+    ckb_rfb_be16(pf + 4, 31);
+    ckb_rfb_be16(pf + 6, 63);
+    ckb_rfb_be16(pf + 8, 31);
+    pf[10] = 11; pf[11] = 5; pf[12] = 0;
+}
+
+/* ── VNC authentication: DES-ECB of a 16-byte challenge ────────── */
+/* Encrypt only, one bit at a time: two blocks per handshake */
+static const uint8_t ckb_des_ip[64] = {
+    58,50,42,34,26,18,10, 2, 60,52,44,36,28,20,12, 4, 62,54,46,38,30,22,14, 6, 64,56,48,40,32,24,16, 8,
+    57,49,41,33,25,17, 9, 1, 59,51,43,35,27,19,11, 3, 61,53,45,37,29,21,13, 5, 63,55,47,39,31,23,15, 7 };
+static const uint8_t ckb_des_fp[64] = {
+    40, 8,48,16,56,24,64,32, 39, 7,47,15,55,23,63,31, 38, 6,46,14,54,22,62,30, 37, 5,45,13,53,21,61,29,
+    36, 4,44,12,52,20,60,28, 35, 3,43,11,51,19,59,27, 34, 2,42,10,50,18,58,26, 33, 1,41, 9,49,17,57,25 };
+static const uint8_t ckb_des_e[48] = {
+    32, 1, 2, 3, 4, 5,  4, 5, 6, 7, 8, 9,  8, 9,10,11,12,13, 12,13,14,15,16,17,
+    16,17,18,19,20,21, 20,21,22,23,24,25, 24,25,26,27,28,29, 28,29,30,31,32, 1 };
+static const uint8_t ckb_des_p[32] = {
+    16, 7,20,21,29,12,28,17,  1,15,23,26, 5,18,31,10,  2, 8,24,14,32,27, 3, 9, 19,13,30, 6,22,11, 4,25 };
+static const uint8_t ckb_des_pc1[56] = {
+    57,49,41,33,25,17, 9, 1,58,50,42,34,26,18, 10, 2,59,51,43,35,27,19,11, 3,60,52,44,36,
+    63,55,47,39,31,23,15, 7,62,54,46,38,30,22, 14, 6,61,53,45,37,29,21,13, 5,28,20,12, 4 };
+static const uint8_t ckb_des_pc2[48] = {
+    14,17,11,24, 1, 5, 3,28,15, 6,21,10, 23,19,12, 4,26, 8,16, 7,27,20,13, 2,
+    41,52,31,37,47,55,30,40,51,45,33,48, 44,49,39,56,34,53,46,42,50,36,29,32 };
+static const uint8_t ckb_des_shift[16] = { 1,1,2,2,2,2,2,2,1,2,2,2,2,2,2,1 };
+static const uint8_t ckb_des_sbox[8][64] = {
+    { 14, 4,13, 1, 2,15,11, 8, 3,10, 6,12, 5, 9, 0, 7,  0,15, 7, 4,14, 2,13, 1,10, 6,12,11, 9, 5, 3, 8,
+       4, 1,14, 8,13, 6, 2,11,15,12, 9, 7, 3,10, 5, 0, 15,12, 8, 2, 4, 9, 1, 7, 5,11, 3,14,10, 0, 6,13 },
+    { 15, 1, 8,14, 6,11, 3, 4, 9, 7, 2,13,12, 0, 5,10,  3,13, 4, 7,15, 2, 8,14,12, 0, 1,10, 6, 9,11, 5,
+       0,14, 7,11,10, 4,13, 1, 5, 8,12, 6, 9, 3, 2,15, 13, 8,10, 1, 3,15, 4, 2,11, 6, 7,12, 0, 5,14, 9 },
+    { 10, 0, 9,14, 6, 3,15, 5, 1,13,12, 7,11, 4, 2, 8, 13, 7, 0, 9, 3, 4, 6,10, 2, 8, 5,14,12,11,15, 1,
+      13, 6, 4, 9, 8,15, 3, 0,11, 1, 2,12, 5,10,14, 7,  1,10,13, 0, 6, 9, 8, 7, 4,15,14, 3,11, 5, 2,12 },
+    {  7,13,14, 3, 0, 6, 9,10, 1, 2, 8, 5,11,12, 4,15, 13, 8,11, 5, 6,15, 0, 3, 4, 7, 2,12, 1,10,14, 9,
+      10, 6, 9, 0,12,11, 7,13,15, 1, 3,14, 5, 2, 8, 4,  3,15, 0, 6,10, 1,13, 8, 9, 4, 5,11,12, 7, 2,14 },
+    {  2,12, 4, 1, 7,10,11, 6, 8, 5, 3,15,13, 0,14, 9, 14,11, 2,12, 4, 7,13, 1, 5, 0,15,10, 3, 9, 8, 6,
+       4, 2, 1,11,10,13, 7, 8,15, 9,12, 5, 6, 3, 0,14, 11, 8,12, 7, 1,14, 2,13, 6,15, 0, 9,10, 4, 5, 3 },
+    { 12, 1,10,15, 9, 2, 6, 8, 0,13, 3, 4,14, 7, 5,11, 10,15, 4, 2, 7,12, 9, 5, 6, 1,13,14, 0,11, 3, 8,
+       9,14,15, 5, 2, 8,12, 3, 7, 0, 4,10, 1,13,11, 6,  4, 3, 2,12, 9, 5,15,10,11,14, 1, 7, 6, 0, 8,13 },
+    {  4,11, 2,14,15, 0, 8,13, 3,12, 9, 7, 5,10, 6, 1, 13, 0,11, 7, 4, 9, 1,10,14, 3, 5,12, 2,15, 8, 6,
+       1, 4,11,13,12, 3, 7,14,10,15, 6, 8, 0, 5, 9, 2,  6,11,13, 8, 1, 4,10, 7, 9, 5, 0,15,14, 2, 3,12 },
+    { 13, 2, 8, 4, 6,15,11, 1,10, 9, 3,14, 5, 0,12, 7,  1,15,13, 8,10, 3, 7, 4,12, 5, 6,11, 0,14, 9, 2,
+       7,11, 4, 1, 9,12,14, 2, 0, 6,10,13,15, 3, 5, 8,  2, 1,14, 7, 4,10, 8,13,15,12, 9, 0, 3, 5, 6,11 },
+};
+
+/* Bit i of the result = bit t[i] of in (1-based, from the MSB of in_bits) */
+static uint64_t ckb_des_perm(uint64_t in, uint8_t in_bits, const uint8_t *t, uint8_t n) {
+    uint64_t out = 0;
+    for (uint8_t i = 0; i < n; i++) out = out << 1 | ((in >> (in_bits - t[i])) & 1);
+    return out;
+}
+
+static uint64_t ckb_des_get64(const uint8_t *p) {
+    uint64_t v = 0;
+    for (uint8_t i = 0; i < 8; i++) v = v << 8 | p[i];
+    return v;
+}
+
+static void ckb_des_encrypt(const uint8_t key[8], const uint8_t in[8], uint8_t out[8]) {
+    uint64_t cd = ckb_des_perm(ckb_des_get64(key), 64, ckb_des_pc1, 56);
+    uint32_t c = cd >> 28, d = cd & 0xFFFFFFF;
+    uint64_t b = ckb_des_perm(ckb_des_get64(in), 64, ckb_des_ip, 64);
+    uint32_t l = b >> 32, r = (uint32_t)b;
+    for (uint8_t round = 0; round < 16; round++) {
+        uint8_t s = ckb_des_shift[round];
+        c = ((c << s) | (c >> (28 - s))) & 0xFFFFFFF;
+        d = ((d << s) | (d >> (28 - s))) & 0xFFFFFFF;
+        uint64_t e = ckb_des_perm(r, 32, ckb_des_e, 48) ^
+                     ckb_des_perm((uint64_t)c << 28 | d, 56, ckb_des_pc2, 48);
+        uint32_t f = 0;
+        for (uint8_t j = 0; j < 8; j++) {
+            uint8_t six = (e >> (42 - 6 * j)) & 0x3F;
+            f = f << 4 | ckb_des_sbox[j][(six & 0x20) | (six & 1) << 4 | (six >> 1 & 0xF)];
+        }
+        f = (uint32_t)ckb_des_perm(f, 32, ckb_des_p, 32);
+        uint32_t t = r;
+        r = l ^ f;
+        l = t;
+    }
+    b = ckb_des_perm((uint64_t)r << 32 | l, 64, ckb_des_fp, 64);
+    for (int8_t i = 7; i >= 0; i--, b >>= 8) out[i] = (uint8_t)b;
+}
+
+/* VNC's key: the password's first 8 bytes, zero padded, each bit-reversed */
+static bool ckb_rfb_vnc_check(const char *password, const uint8_t challenge[16],
+                              const uint8_t response[16]) {
+    uint8_t key[8] = {}, expect[16], diff = 0;
+    for (uint8_t i = 0; i < 8 && password[i]; i++) {
+        uint8_t c = (uint8_t)password[i], v = 0;
+        for (uint8_t bit = 0; bit < 8; bit++) v |= ((c >> bit) & 1) << (7 - bit);
+        key[i] = v;
+    }
+    ckb_des_encrypt(key, challenge, expect);
+    ckb_des_encrypt(key, challenge + 8, expect + 8);
+    for (uint8_t i = 0; i < 16; i++) diff |= expect[i] ^ response[i];
+    return diff == 0;
+}
+
+static bool ckb_rfb_random(uint8_t *buf, size_t n) {
+#if defined(ESP32)
+    esp_fill_random(buf, n);              /* hardware RNG; WiFi is up */
+    return true;
+#else
+    FILE *f = fopen("/dev/urandom", "rb");
+    bool ok = f && fread(buf, 1, n, f) == n;
+    if (f) fclose(f);
+    return ok;
+#endif
+}
+
+/* ── Setup ─────────────────────────────────────────────────────── */
+static bool ckb_rfb_init(ckb_rfb_t &r, const uint16_t *fb, uint16_t w, uint16_t h,
+                         const char *name) {
+    uint16_t tx = (w + CKB_RFB_TILE - 1) / CKB_RFB_TILE;
+    uint16_t ty = (h + CKB_RFB_TILE - 1) / CKB_RFB_TILE;
+    if (!fb || w > CKB_RFB_MAX_W || tx * ty > CKB_RFB_MAX_TILES) return false;
+    memset(&r, 0, sizeof(r));
+    r.fb = fb;
+    r.w = w;
+    r.h = h;
+    r.name = name;
+    r.tiles_x = tx;
+    r.tiles_y = ty;
+    return true;
+}
+
+/* Version, security (VNC auth or None), ClientInit/ServerInit. Resets
+ * per-client state. */
+static bool ckb_rfb_handshake(ckb_rfb_t &r, const ckb_rfb_io_t &io) {
+    r.io = io;
+    r.io_ok = true;
+    r.used = 0;
+    r.pending = false;
+    r.encoding = CKB_RFB_ENC_RAW;
+    r.updates = r.rects = r.bytes = 0;
+    memset(r.sent, 0, sizeof(r.sent));
+    memset(r.dirty, 0, sizeof(r.dirty));
+
+    uint8_t buf[24];
+    if (!io.write(io.ctx, (const uint8_t *)"RFB 003.008\n", 12)) return false;
+    if (!io.read(io.ctx, buf, 12) || memcmp(buf, "RFB 003.", 8) != 0) return false;
+    int minor = (buf[8] - '0') * 100 + (buf[9] - '0') * 10 + (buf[10] - '0');
+
+    bool auth = r.password && r.password[0];
+    uint8_t type = auth ? CKB_RFB_SEC_VNC : CKB_RFB_SEC_NONE;
+    r.input = false;
+    if (minor < 7) {
+        ckb_rfb_be32(buf, type);                                 /* 3.3: server picks */
+        if (!io.write(io.ctx, buf, 4)) return false;
+    } else {
+        buf[0] = 1; buf[1] = type;                               /* the one type offered */
+        if (!io.write(io.ctx, buf, 2) || !io.read(io.ctx, buf, 1)) return false;
+        if (buf[0] != type) return false;
+    }
+    if (auth) {
+        uint8_t challenge[16], response[16];
+        if (!ckb_rfb_random(challenge, sizeof(challenge))) return false;
+        if (!io.write(io.ctx, challenge, 16) || !io.read(io.ctx, response, 16)) return false;
+        if (!ckb_rfb_vnc_check(r.password, challenge, response)) {
+            r.auth_failures++;
+            ckb_rfb_be32(buf, 1);                                /* SecurityResult failed */
+            if (minor >= 8) {
+                ckb_rfb_be32(buf + 4, 11);
+                memcpy(buf + 8, "auth failed", 11);
+                io.write(io.ctx, buf, 19);
+            } else {
+                io.write(io.ctx, buf, 4);
+            }
+            return false;
+        }
+    }
+    if (auth || minor >= 8) {
+        ckb_rfb_be32(buf, 0);                                    /* SecurityResult OK */
+        if (!io.write(io.ctx, buf, 4)) return false;
+    }
+    r.input = auth;
+
+    if (!io.read(io.ctx, buf, 1)) return false;                  /* ClientInit, shared flag */
+
+    uint8_t pf[16];
+    ckb_rfb_native_format(pf);
+    ckb_rfb_set_format(r, pf);
+    size_t nlen = strlen(r.name);
+    uint8_t *p = ckb_rfb_reserve(r, 24);
+    p = ckb_rfb_be16(p, r.w);
+    p = ckb_rfb_be16(p, r.h);
+    memcpy(p, pf, 16); p += 16;
+    ckb_rfb_be32(p, nlen);
+    memcpy(ckb_rfb_reserve(r, nlen), r.name, nlen);
+    ckb_rfb_flush(r);
+    return r.io_ok;
+}
+
+/* ── Subrectangles ─────────────────────────────────────────────── */
+enum ckb_rfb_sub_mode_t {
+    CKB_SUB_COUNT,          /* count only, give up past limit */
+    CKB_SUB_RRE,            /* pixel + x, y, w, h (u16) to the stream */
+    CKB_SUB_HEX_MONO,       /* xy, wh bytes into *pp, bounded by end */
+    CKB_SUB_HEX_COLOURED    /* pixel + xy, wh into *pp, bounded by end */
+};
+
+/* Greedy cover of every non-bg pixel of a w×h block (h <= 16) with
+ * single-colour rectangles, using r.done as the coverage mask.
+ * Returns the number of rectangles, or -1 past the limit / buffer end. */
+static int ckb_rfb_subrects(ckb_rfb_t &r, const uint16_t *px, uint32_t stride,
+                            uint16_t w, uint16_t h, uint16_t bg, ckb_rfb_sub_mode_t mode,
+                            int limit, uint8_t **pp, const uint8_t *end) {
+    memset(r.done, 0, w * sizeof(r.done[0]));
+    int n = 0;
+    for (uint16_t y = 0; y < h; y++) {
+        const uint16_t *row = px + y * stride;
+        for (uint16_t x = 0; x < w; x++) {
+            uint16_t c = row[x];
+            if (c == bg || (r.done[x] >> y) & 1) continue;
+            uint16_t x2 = x;
+            while (x2 + 1 < w && row[x2 + 1] == c && !((r.done[x2 + 1] >> y) & 1)) x2++;
+            uint16_t y2 = y;
+            while (y2 + 1 < h) {
+                const uint16_t *next = px + (y2 + 1) * stride;
+                uint16_t i = x;
+                while (i <= x2 && next[i] == c && !((r.done[i] >> (y2 + 1)) & 1)) i++;
+                if (i <= x2) break;
+                y2++;
+            }
+            uint16_t bits = (uint16_t)(((1u << (y2 - y + 1)) - 1) << y);
+            for (uint16_t i = x; i <= x2; i++) r.done[i] |= bits;
+
+            if (mode == CKB_SUB_COUNT) {
+                if (n >= limit) return -1;
+            } else if (mode == CKB_SUB_RRE) {
+                uint8_t *p = ckb_rfb_reserve(r, r.bytes_pp + 8);
+                p = ckb_rfb_pixel(r, p, c);
+                p = ckb_rfb_be16(p, x);
+                p = ckb_rfb_be16(p, y);
+                p = ckb_rfb_be16(p, x2 - x + 1);
+                ckb_rfb_be16(p, y2 - y + 1);
+            } else {
+                uint8_t *p = *pp;
+                size_t need = (mode == CKB_SUB_HEX_COLOURED) ? r.bytes_pp + 2 : 2;
+                if (p + need > end) return -1;
+                if (mode == CKB_SUB_HEX_COLOURED) p = ckb_rfb_pixel(r, p, c);
+                *p++ = (uint8_t)(x << 4 | y);
+                *p++ = (uint8_t)((x2 - x) << 4 | (y2 - y));
+                *pp = p;
+            }
+            n++;
+            x = x2;
+        }
+    }
+    return n;
+}
+
+/* Most frequent colour (Misra–Gries with 4 candidates, then exact count) */
+static uint16_t ckb_rfb_background(const uint16_t *px, uint32_t stride, uint16_t w, uint16_t h,
+                                   uint16_t *second, int *distinct) {
+    uint16_t cand[4];
+    uint32_t cnt[4] = { 0, 0, 0, 0 };
+    uint16_t seen[3];
+    int nseen = 0;
+    for (uint16_t y = 0; y < h; y++) {
+        const uint16_t *row = px + y * stride;
+        for (uint16_t x = 0; x < w; x++) {
+            uint16_t c = row[x];
+            if (nseen < 3) {
+                int k = 0;
+                while (k < nseen && seen[k] != c) k++;
+                if (k == nseen) seen[nseen++] = c;
+            }
+            int k = 0;
+            while (k < 4 && !(cnt[k] && cand[k] == c)) k++;
+            if (k < 4) { cnt[k]++; continue; }
+            k = 0;
+            while (k < 4 && cnt[k]) k++;
+            if (k < 4) { cand[k] = c; cnt[k] = 1; continue; }
+            for (k = 0; k < 4; k++) cnt[k]--;
+        }
+    }
+    *distinct = nseen;                               /* 1, 2 or 3 (= more than two) */
+    uint16_t best = px[0], next = px[0];
+    uint32_t best_n = 0, next_n = 0;
+    for (int k = 0; k < 4; k++) {
+        if (!cnt[k]) continue;
+        uint32_t n = 0;
+        for (uint16_t y = 0; y < h; y++)
+            for (uint16_t x = 0; x < w; x++) n += px[y * stride + x] == cand[k];
+        if (n > best_n) { next = best; next_n = best_n; best = cand[k]; best_n = n; }
+        else if (n > next_n) { next = cand[k]; next_n = n; }
+    }
+    if (nseen == 2) next = (seen[0] == best) ? seen[1] : seen[0];
+    if (second) *second = next;
+    return best;
+}
+
+/* ── Encoders ──────────────────────────────────────────────────── */
+static void ckb_rfb_rect_header(ckb_rfb_t &r, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                                int32_t enc) {
+    uint8_t *p = ckb_rfb_reserve(r, 12);
+    p = ckb_rfb_be16(p, x);
+    p = ckb_rfb_be16(p, y);
+    p = ckb_rfb_be16(p, w);
+    p = ckb_rfb_be16(p, h);
+    ckb_rfb_be32(p, (uint32_t)enc);
+}
+
+static void ckb_rfb_raw(ckb_rfb_t &r, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    ckb_rfb_rect_header(r, x, y, w, h, CKB_RFB_ENC_RAW);
+    const uint16_t *row = r.fb + (uint32_t)y * r.w + x;
+    for (uint16_t j = 0; j < h; j++, row += r.w) {
+        for (uint16_t i = 0; i < w; ) {
+            uint16_t n = (CKB_RFB_OUT_SIZE / 4 < w - i) ? CKB_RFB_OUT_SIZE / 4 : w - i;
+            uint8_t *p = ckb_rfb_reserve(r, n * r.bytes_pp);
+            for (uint16_t k = 0; k < n; k++) p = ckb_rfb_pixel(r, p, row[i + k]);
+            i += n;
+        }
+    }
+}
+
+static void ckb_rfb_rre(ckb_rfb_t &r, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    const uint16_t *px = r.fb + (uint32_t)y * r.w + x;
+    int distinct;
+    uint16_t bg = ckb_rfb_background(px, r.w, w, h, NULL, &distinct);
+
+    /* Only worth it while smaller than raw */
+    int limit = (int)(((uint32_t)w * h * r.bytes_pp - 4 - r.bytes_pp) / (r.bytes_pp + 8));
+    int n = ckb_rfb_subrects(r, px, r.w, w, h, bg, CKB_SUB_COUNT, limit, NULL, NULL);
+    if (n < 0) {
+        ckb_rfb_raw(r, x, y, w, h);
+        return;
+    }
+    ckb_rfb_rect_header(r, x, y, w, h, CKB_RFB_ENC_RRE);
+    uint8_t *p = ckb_rfb_reserve(r, 4 + r.bytes_pp);
+    p = ckb_rfb_be32(p, (uint32_t)n);
+    ckb_rfb_pixel(r, p, bg);
+    ckb_rfb_subrects(r, px, r.w, w, h, bg, CKB_SUB_RRE, 0, NULL, NULL);
+}
+
+static void ckb_rfb_hextile(ckb_rfb_t &r, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    ckb_rfb_rect_header(r, x, y, w, h, CKB_RFB_ENC_HEXTILE);
+    bool bg_valid = false, fg_valid = false;
+    uint16_t bg_last = 0, fg_last = 0;
+
+    for (uint16_t ty = 0; ty < h; ty += CKB_RFB_TILE) {
+        uint16_t th = (h - ty < CKB_RFB_TILE) ? h - ty : CKB_RFB_TILE;
+        for (uint16_t tx = 0; tx < w; tx += CKB_RFB_TILE) {
+            uint16_t tw = (w - tx < CKB_RFB_TILE) ? w - tx : CKB_RFB_TILE;
+            const uint16_t *src = r.fb + (uint32_t)(y + ty) * r.w + x + tx;
+            for (uint16_t j = 0; j < th; j++)
+                memcpy(r.tile_px + j * tw, src + (uint32_t)j * r.w, tw * 2);
+
+            int distinct;
+            uint16_t fg;
+            uint16_t bg = ckb_rfb_background(r.tile_px, tw, tw, th, &fg, &distinct);
+            size_t raw = 1 + (size_t)tw * th * r.bytes_pp;
+
+            /* Encode into tile_out; fall back to raw if it comes out bigger */
+            uint8_t *p = r.tile_out + 1;
+            uint8_t flags = 0;
+            if (!bg_valid || bg != bg_last) {
+                flags |= CKB_HEX_BG;
+                p = ckb_rfb_pixel(r, p, bg);
+            }
+            bool ok = true;
+            if (distinct > 1) {
+                bool coloured = distinct > 2;
+                flags |= CKB_HEX_SUBRECTS;
+                if (coloured) {
+                    flags |= CKB_HEX_COLOURED;
+                } else if (!fg_valid || fg != fg_last) {
+                    flags |= CKB_HEX_FG;
+                    p = ckb_rfb_pixel(r, p, fg);
+                }
+                uint8_t *count = p++;
+                const uint8_t *end = r.tile_out + (raw < sizeof(r.tile_out) ? raw : sizeof(r.tile_out));
+                int n = ckb_rfb_subrects(r, r.tile_px, tw, tw, th, bg,
+                    coloured ? CKB_SUB_HEX_COLOURED : CKB_SUB_HEX_MONO, 0, &p, end);
+                ok = n >= 0 && n <= 255;
+                *count = (uint8_t)n;
+            }
+
+            if (ok) {
+                r.tile_out[0] = flags;
+                memcpy(ckb_rfb_reserve(r, p - r.tile_out), r.tile_out, p - r.tile_out);
+                bg_valid = true;
+                bg_last = bg;
+                if (flags & CKB_HEX_COLOURED) fg_valid = false;
+                else if (flags & CKB_HEX_FG) { fg_valid = true; fg_last = fg; }
+            } else {
+                uint8_t *q = ckb_rfb_reserve(r, raw);
+                *q++ = CKB_HEX_RAW;
+                for (uint16_t k = 0; k < tw * th; k++) q = ckb_rfb_pixel(r, q, r.tile_px[k]);
+                bg_valid = fg_valid = false;
+            }
+        }
+    }
+}
+
+/* ── Updates ───────────────────────────────────────────────────── */
+static uint32_t ckb_rfb_hash_tile(const ckb_rfb_t &r, uint16_t tx, uint16_t ty) {
+    uint16_t x = tx * CKB_RFB_TILE, y = ty * CKB_RFB_TILE;
+    uint16_t w = (r.w - x < CKB_RFB_TILE) ? r.w - x : CKB_RFB_TILE;
+    uint16_t h = (r.h - y < CKB_RFB_TILE) ? r.h - y : CKB_RFB_TILE;
+    uint32_t hash = 2166136261u;
+    const uint16_t *row = r.fb + (uint32_t)y * r.w + x;
+    for (uint16_t j = 0; j < h; j++, row += r.w)
+        for (uint16_t i = 0; i < w; i++) {
+            hash ^= row[i];
+            hash *= 16777619u;
+        }
+    return hash | 1;                                 /* 0 = never sent */
+}
+
+/* Tile rows/columns overlapping the requested region */
+static void ckb_rfb_req_tiles(const ckb_rfb_t &r, uint8_t *tx0, uint8_t *tx1,
+                              uint8_t *ty0, uint8_t *ty1) {
+    *tx0 = r.req_x / CKB_RFB_TILE;
+    *tx1 = (r.req_x + r.req_w - 1) / CKB_RFB_TILE;
+    *ty0 = r.req_y / CKB_RFB_TILE;
+    *ty1 = (r.req_y + r.req_h - 1) / CKB_RFB_TILE;
+}
+
+/* Walk the runs of dirty tiles in the region, clipped to it. Counts
+ * them, and with send set also encodes each one and marks it sent. */
+static uint16_t ckb_rfb_rects(ckb_rfb_t &r, bool send) {
+    uint8_t tx0, tx1, ty0, ty1;
+    ckb_rfb_req_tiles(r, &tx0, &tx1, &ty0, &ty1);
+    uint16_t n = 0;
+    for (uint16_t ty = ty0; ty <= ty1; ty++) {
+        for (uint16_t tx = tx0; tx <= tx1; tx++) {
+            if (!r.dirty[ty * r.tiles_x + tx]) continue;
+            uint16_t end = tx;
+            while (end + 1 <= tx1 && r.dirty[ty * r.tiles_x + end + 1]) end++;
+            n++;
+            if (send) {
+                int32_t x1 = tx * CKB_RFB_TILE, y1 = ty * CKB_RFB_TILE;
+                int32_t x2 = (end + 1) * CKB_RFB_TILE, y2 = y1 + CKB_RFB_TILE;
+                if (x1 < r.req_x) x1 = r.req_x;
+                if (y1 < r.req_y) y1 = r.req_y;
+                if (x2 > r.req_x + r.req_w) x2 = r.req_x + r.req_w;
+                if (y2 > r.req_y + r.req_h) y2 = r.req_y + r.req_h;
+                uint16_t w = x2 - x1, h = y2 - y1;
+                if (r.encoding == CKB_RFB_ENC_HEXTILE)  ckb_rfb_hextile(r, x1, y1, w, h);
+                else if (r.encoding == CKB_RFB_ENC_RRE) ckb_rfb_rre(r, x1, y1, w, h);
+                else                                    ckb_rfb_raw(r, x1, y1, w, h);
+                for (uint16_t t = tx; t <= end; t++) {
+                    uint16_t i = ty * r.tiles_x + t;
+                    r.sent[i] = r.now[i];
+                    r.dirty[i] = 0;
+                }
+            }
+            tx = end;
+        }
+    }
+    return n;
+}
+
+/* Scan the requested region; if anything differs, send one update */
+static bool ckb_rfb_send_update(ckb_rfb_t &r) {
+    uint8_t tx0, tx1, ty0, ty1;
+    ckb_rfb_req_tiles(r, &tx0, &tx1, &ty0, &ty1);
+    bool any = false;
+    for (uint16_t ty = ty0; ty <= ty1; ty++) {
+        for (uint16_t tx = tx0; tx <= tx1; tx++) {
+            uint16_t i = ty * r.tiles_x + tx;
+            r.now[i] = ckb_rfb_hash_tile(r, tx, ty);
+            r.dirty[i] = (r.now[i] != r.sent[i] || (r.dirty[i] & CKB_RFB_FORCED)) ? CKB_RFB_CHANGED : 0;
+            any |= r.dirty[i] != 0;
+        }
+        if (r.io.yield) r.io.yield(r.io.ctx);
+    }
+    if (!any) return false;
+
+    uint16_t n = ckb_rfb_rects(r, false);
+    uint8_t *p = ckb_rfb_reserve(r, 4);
+    p[0] = 0;                                        /* FramebufferUpdate */
+    p[1] = 0;
+    ckb_rfb_be16(p + 2, n);
+    ckb_rfb_rects(r, true);
+    ckb_rfb_flush(r);
+
+    r.pending = false;
+    r.updates++;
+    r.rects += n;
+    return true;
+}
+
+/* ── Client messages ───────────────────────────────────────────── */
+static bool ckb_rfb_skip(ckb_rfb_t &r, uint32_t n) {
+    uint8_t buf[64];
+    while (n) {
+        uint32_t k = n < sizeof(buf) ? n : sizeof(buf);
+        if (!r.io.read(r.io.ctx, buf, k)) return false;
+        n -= k;
+    }
+    return true;
+}
+
+static bool ckb_rfb_message(ckb_rfb_t &r) {
+    uint8_t buf[20];
+    if (!r.io.read(r.io.ctx, buf, 1)) return false;
+    switch (buf[0]) {
+        case 0:                                      /* SetPixelFormat */
+            if (!r.io.read(r.io.ctx, buf, 19)) return false;
+            ckb_rfb_set_format(r, buf + 3);
+            memset(r.sent, 0, sizeof(r.sent));       /* client repaints in the new format */
+            return true;
+        case 2: {                                    /* SetEncodings */
+            if (!r.io.read(r.io.ctx, buf, 3)) return false;
+            uint16_t n = ckb_rfb_get16(buf + 1);
+            r.encoding = CKB_RFB_ENC_RAW;
+            bool chosen = false;
+            for (uint16_t i = 0; i < n; i++) {
+                if (!r.io.read(r.io.ctx, buf, 4)) return false;
+                int32_t e = (int32_t)ckb_rfb_get32(buf);
+                if (!chosen && (e == CKB_RFB_ENC_HEXTILE || e == CKB_RFB_ENC_RRE ||
+                                e == CKB_RFB_ENC_RAW)) {
+                    r.encoding = e;
+                    chosen = true;
+                }
+            }
+            return true;
+        }
+        case 3: {                                    /* FramebufferUpdateRequest */
+            if (!r.io.read(r.io.ctx, buf, 9)) return false;
+            uint16_t x = ckb_rfb_get16(buf + 1), y = ckb_rfb_get16(buf + 3);
+            uint16_t w = ckb_rfb_get16(buf + 5), h = ckb_rfb_get16(buf + 7);
+            if (x >= r.w || y >= r.h || !w || !h) return true;
+            if (w > r.w - x) w = r.w - x;
+            if (h > r.h - y) h = r.h - y;
+            r.req_x = x; r.req_y = y; r.req_w = w; r.req_h = h;
+            r.pending = true;
+            if (!buf[0]) {                           /* non-incremental: resend the region */
+                uint8_t tx0, tx1, ty0, ty1;
+                ckb_rfb_req_tiles(r, &tx0, &tx1, &ty0, &ty1);
+                for (uint16_t ty = ty0; ty <= ty1; ty++)
+                    for (uint16_t tx = tx0; tx <= tx1; tx++)
+                        r.dirty[ty * r.tiles_x + tx] |= CKB_RFB_FORCED;
+                r.last_scan_ms -= CKB_RFB_SCAN_MS;   /* answer on this poll */
+            }
+            return true;
+        }
+        case 4:                                      /* KeyEvent — ignored */
+            return r.io.read(r.io.ctx, buf, 7);
+        case 5:                                      /* PointerEvent */
+            if (!r.io.read(r.io.ctx, buf, 5)) return false;
+            if (r.on_pointer && r.input) {       /* view-only without auth */
+                uint16_t x = ckb_rfb_get16(buf + 1), y = ckb_rfb_get16(buf + 3);
+                r.on_pointer(buf[0], x < r.w ? x : r.w - 1, y < r.h ? y : r.h - 1);
+            }
+            return true;
+        case 6:                                      /* ClientCutText — ignored */
+            if (!r.io.read(r.io.ctx, buf, 7)) return false;
+            return ckb_rfb_skip(r, ckb_rfb_get32(buf + 3));
+        default:
+            return false;                            /* unknown: can't resync */
+    }
+}
+
+/* Handle input and answer an outstanding request. false = drop the client. */
+static bool ckb_rfb_poll(ckb_rfb_t &r, uint32_t now_ms) {
+    int avail;
+    while ((avail = r.io.available(r.io.ctx)) > 0)
+        if (!ckb_rfb_message(r)) return false;
+    if (avail < 0) return false;
+    if (r.pending && now_ms - r.last_scan_ms >= CKB_RFB_SCAN_MS) {
+        r.last_scan_ms = now_ms;
+        ckb_rfb_send_update(r);
+    }
+    return r.io_ok;
+}
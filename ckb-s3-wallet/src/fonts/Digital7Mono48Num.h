@@ -0,0 +1,208 @@
+// Subset of Digital7Mono48.h by tools/gfxfont_subset.py --rle
+// chars: " %-.0123456789TX"
+const uint8_t digital_7__mono_48pt7b_numBitmaps[] PROGMEM = {
+  0x01, 0x03, 0x0C, 0x11, 0x04, 0x09, 0x0C, 0x02, 0x03, 0x0C, 0x06, 0x07,
+  0x0D, 0x02, 0x04, 0x0B, 0x07, 0x05, 0x0E, 0x02, 0x05, 0x09, 0x09, 0x05,
+  0x0C, 0x02, 0x06, 0x09, 0x09, 0x07, 0x0A, 0x02, 0x06, 0x08, 0x09, 0x05,
+  0x01, 0x05, 0x06, 0x02, 0x07, 0x08, 0x09, 0x05, 0x04, 0x0A, 0x07, 0x07,
+  0x09, 0x06, 0x06, 0x08, 0x07, 0x07, 0x09, 0x06, 0x07, 0x07, 0x07, 0x06,
+  0x09, 0x07, 0x07, 0x07, 0x07, 0x06, 0x09, 0x07, 0x07, 0x07, 0x07, 0x06,
+  0x08, 0x08, 0x07, 0x08, 0x06, 0x05, 0x09, 0x08, 0x07, 0x0A, 0x04, 0x05,
+  0x08, 0x09, 0x07, 0x02, 0x06, 0x05, 0x01, 0x04, 0x09, 0x09, 0x06, 0x02,
+  0x0A, 0x07, 0x08, 0x0A, 0x06, 0x02, 0x0C, 0x04, 0x09, 0x0A, 0x06, 0x01,
+  0x0E, 0x03, 0x08, 0x0C, 0x04, 0x02, 0x0D, 0x03, 0x09, 0x0D, 0x03, 0x02,
+  0x0C, 0x04, 0x08, 0x0F, 0x01, 0x02, 0x0C, 0x04, 0x09, 0x22, 0x08, 0x23,
+  0x08, 0x23, 0x07, 0x24, 0x07, 0x24, 0x06, 0x25, 0x06, 0x25, 0x05, 0x26,
+  0x05, 0x26, 0x04, 0x78, 0x04, 0x26, 0x05, 0x26, 0x05, 0x25, 0x06, 0x25,
+  0x06, 0x24, 0x07, 0x24, 0x07, 0x23, 0x08, 0x23, 0x08, 0x22, 0x09, 0x04,
+  0x0C, 0x12, 0x08, 0x04, 0x0C, 0x02, 0x03, 0x0D, 0x09, 0x03, 0x0D, 0x02,
+  0x04, 0x0C, 0x08, 0x03, 0x0E, 0x02, 0x05, 0x0A, 0x09, 0x04, 0x0C, 0x02,
+  0x06, 0x0A, 0x08, 0x07, 0x0A, 0x02, 0x06, 0x09, 0x09, 0x04, 0x01, 0x05,
+  0x06, 0x02, 0x07, 0x09, 0x08, 0x05, 0x04, 0x0A, 0x07, 0x08, 0x09, 0x05,
+  0x06, 0x08, 0x07, 0x08, 0x08, 0x06, 0x07, 0x07, 0x07, 0x07, 0x09, 0x06,
+  0x07, 0x07, 0x07, 0x07, 0x09, 0x06, 0x07, 0x07, 0x07, 0x06, 0x09, 0x07,
+  0x07, 0x08, 0x06, 0x06, 0x09, 0x07, 0x07, 0x0A, 0x04, 0x06, 0x08, 0x08,
+  0x07, 0x02, 0x06, 0x05, 0x01, 0x05, 0x09, 0x08, 0x06, 0x02, 0x0A, 0x08,
+  0x08, 0x09, 0x06, 0x02, 0x0C, 0x05, 0x09, 0x09, 0x06, 0x01, 0x0E, 0x05,
+  0x07, 0x0B, 0x04, 0x02, 0x0D, 0x06, 0x07, 0x0C, 0x03, 0x02, 0x0C, 0x09,
+  0x04, 0x0E, 0x01, 0x02, 0x0C, 0x03, 0x03, 0x17, 0x05, 0x19, 0x03, 0x1B,
+  0x01, 0x1D, 0x01, 0x1B, 0x03, 0x19, 0x05, 0x17, 0x03, 0x00, 0x31, 0x03,
+  0x1B, 0x01, 0x02, 0x05, 0x1B, 0x02, 0x03, 0x03, 0x1C, 0x02, 0x04, 0x01,
+  0x1D, 0x01, 0x22, 0x02, 0x06, 0x03, 0x19, 0x02, 0x07, 0x05, 0x16, 0x01,
+  0x0B, 0x19, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0D, 0x18, 0x0B, 0x1A, 0x09, 0x1C, 0x07, 0x1E, 0x03, 0x01, 0x01, 0x20,
+  0x01, 0x4A, 0x01, 0x20, 0x01, 0x01, 0x03, 0x1E, 0x07, 0x1C, 0x09, 0x1A,
+  0x0B, 0x18, 0x0D, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0B, 0x19, 0x08, 0x05, 0x16, 0x01, 0x07, 0x03, 0x19, 0x02, 0x22, 0x02,
+  0x23, 0x01, 0x06, 0x01, 0x1C, 0x02, 0x04, 0x03, 0x1B, 0x02, 0x03, 0x05,
+  0x1B, 0x01, 0x02, 0x03, 0x02, 0x02, 0x05, 0x03, 0x04, 0x04, 0x02, 0x06,
+  0x01, 0x92, 0x01, 0x06, 0x02, 0x05, 0x03, 0x04, 0x04, 0x03, 0x05, 0x01,
+  0x14, 0x01, 0x05, 0x03, 0x03, 0x04, 0x02, 0x05, 0x01, 0x8B, 0x01, 0x06,
+  0x01, 0x06, 0x01, 0x06, 0x02, 0x04, 0x03, 0x03, 0x04, 0x02, 0x03, 0x03,
+  0x1B, 0x01, 0x02, 0x05, 0x1B, 0x02, 0x03, 0x03, 0x1C, 0x02, 0x04, 0x01,
+  0x1D, 0x01, 0x22, 0x02, 0x06, 0x03, 0x19, 0x02, 0x06, 0x06, 0x16, 0x01,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1E, 0x06, 0x1F, 0x05, 0x20, 0x04, 0x06, 0x17, 0x04, 0x03, 0x06,
+  0x18, 0x04, 0x01, 0x06, 0x1A, 0x09, 0x1C, 0x05, 0x01, 0x03, 0x1A, 0x05,
+  0x03, 0x03, 0x18, 0x06, 0x04, 0x03, 0x17, 0x06, 0x05, 0x1F, 0x06, 0x1E,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x04, 0x20,
+  0x01, 0x05, 0x18, 0x09, 0x1C, 0x05, 0x1F, 0x05, 0x1F, 0x06, 0x1F, 0x06,
+  0x1E, 0x07, 0x1D, 0x04, 0x03, 0x1B, 0x01, 0x02, 0x05, 0x1B, 0x02, 0x03,
+  0x03, 0x1C, 0x02, 0x04, 0x01, 0x1D, 0x01, 0x22, 0x02, 0x06, 0x03, 0x19,
+  0x02, 0x06, 0x06, 0x16, 0x01, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1E, 0x06, 0x1F, 0x05, 0x20, 0x04,
+  0x06, 0x17, 0x04, 0x03, 0x05, 0x19, 0x04, 0x01, 0x05, 0x1B, 0x08, 0x1D,
+  0x08, 0x1B, 0x03, 0x01, 0x06, 0x19, 0x03, 0x03, 0x06, 0x18, 0x02, 0x04,
+  0x1F, 0x05, 0x1E, 0x06, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x05, 0x17, 0x01, 0x07, 0x03, 0x19, 0x02, 0x22,
+  0x02, 0x23, 0x01, 0x06, 0x01, 0x1C, 0x02, 0x04, 0x02, 0x1C, 0x02, 0x03,
+  0x05, 0x1B, 0x01, 0x02, 0x03, 0x1F, 0x02, 0x22, 0x03, 0x21, 0x04, 0x1F,
+  0x09, 0x1B, 0x0C, 0x17, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0D, 0x18, 0x0B, 0x1A, 0x09, 0x1C,
+  0x07, 0x03, 0x17, 0x04, 0x03, 0x01, 0x01, 0x04, 0x18, 0x04, 0x01, 0x06,
+  0x1A, 0x09, 0x1C, 0x09, 0x1A, 0x03, 0x01, 0x07, 0x18, 0x03, 0x03, 0x07,
+  0x17, 0x02, 0x04, 0x1F, 0x05, 0x1E, 0x06, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1E, 0x06, 0x1E,
+  0x06, 0x1E, 0x06, 0x1F, 0x04, 0x20, 0x03, 0x21, 0x02, 0x03, 0x03, 0x1D,
+  0x06, 0x1E, 0x05, 0x1F, 0x04, 0x1F, 0x05, 0x1F, 0x08, 0x1B, 0x06, 0x01,
+  0x05, 0x18, 0x06, 0x04, 0x20, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x06, 0x1E, 0x05, 0x1F, 0x04, 0x20, 0x03, 0x03, 0x17,
+  0x08, 0x01, 0x04, 0x18, 0x0B, 0x1A, 0x09, 0x1C, 0x09, 0x1A, 0x03, 0x01,
+  0x07, 0x18, 0x03, 0x03, 0x07, 0x17, 0x02, 0x04, 0x1F, 0x05, 0x1E, 0x06,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x06, 0x16, 0x01, 0x07, 0x03, 0x19, 0x02, 0x22, 0x02, 0x23, 0x01, 0x06,
+  0x01, 0x1C, 0x02, 0x04, 0x03, 0x1B, 0x02, 0x03, 0x05, 0x1B, 0x01, 0x02,
+  0x03, 0x03, 0x1D, 0x06, 0x1E, 0x05, 0x1F, 0x04, 0x1F, 0x05, 0x1F, 0x08,
+  0x1B, 0x06, 0x01, 0x05, 0x18, 0x06, 0x04, 0x20, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x06, 0x1E, 0x05, 0x1F, 0x04, 0x20,
+  0x03, 0x03, 0x17, 0x08, 0x01, 0x04, 0x18, 0x0B, 0x1A, 0x09, 0x1C, 0x05,
+  0x01, 0x03, 0x1A, 0x03, 0x01, 0x01, 0x03, 0x03, 0x18, 0x03, 0x07, 0x03,
+  0x17, 0x02, 0x09, 0x1A, 0x0B, 0x18, 0x0D, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0B, 0x19, 0x08, 0x05, 0x16, 0x01, 0x07, 0x03,
+  0x19, 0x02, 0x22, 0x02, 0x23, 0x01, 0x06, 0x01, 0x1C, 0x02, 0x04, 0x03,
+  0x1B, 0x02, 0x03, 0x05, 0x1B, 0x01, 0x02, 0x03, 0x03, 0x1B, 0x01, 0x02,
+  0x05, 0x1B, 0x02, 0x03, 0x03, 0x1C, 0x02, 0x04, 0x01, 0x1D, 0x01, 0x22,
+  0x02, 0x06, 0x03, 0x19, 0x02, 0x07, 0x05, 0x16, 0x01, 0x0B, 0x19, 0x0E,
+  0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E,
+  0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E,
+  0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0D, 0x18, 0x0B,
+  0x1A, 0x09, 0x1C, 0x07, 0x1E, 0x03, 0x01, 0x01, 0x20, 0x01, 0x6B, 0x01,
+  0x22, 0x03, 0x20, 0x04, 0x1F, 0x05, 0x1E, 0x06, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1E, 0x06,
+  0x1E, 0x06, 0x1E, 0x06, 0x1F, 0x04, 0x20, 0x03, 0x21, 0x02, 0x03, 0x03,
+  0x1B, 0x01, 0x02, 0x05, 0x1B, 0x02, 0x03, 0x03, 0x1C, 0x02, 0x04, 0x01,
+  0x1D, 0x01, 0x22, 0x02, 0x06, 0x03, 0x19, 0x02, 0x07, 0x05, 0x16, 0x01,
+  0x0B, 0x19, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0D, 0x18, 0x0B, 0x1A, 0x09, 0x1C, 0x07, 0x03, 0x17, 0x04, 0x03, 0x01,
+  0x01, 0x04, 0x18, 0x04, 0x01, 0x06, 0x1A, 0x09, 0x1C, 0x05, 0x01, 0x03,
+  0x1A, 0x03, 0x01, 0x01, 0x03, 0x03, 0x18, 0x03, 0x07, 0x03, 0x17, 0x02,
+  0x09, 0x1A, 0x0B, 0x18, 0x0D, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16,
+  0x0E, 0x16, 0x0B, 0x19, 0x08, 0x05, 0x16, 0x01, 0x07, 0x03, 0x19, 0x02,
+  0x22, 0x02, 0x23, 0x01, 0x06, 0x01, 0x1C, 0x02, 0x04, 0x03, 0x1B, 0x02,
+  0x03, 0x05, 0x1B, 0x01, 0x02, 0x03, 0x03, 0x1B, 0x01, 0x02, 0x05, 0x1B,
+  0x02, 0x03, 0x03, 0x1C, 0x02, 0x04, 0x01, 0x1D, 0x01, 0x22, 0x02, 0x06,
+  0x03, 0x19, 0x02, 0x07, 0x05, 0x16, 0x01, 0x0B, 0x19, 0x0E, 0x16, 0x0E,
+  0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E,
+  0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E,
+  0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0D, 0x18, 0x0B, 0x1A, 0x09,
+  0x1C, 0x07, 0x03, 0x17, 0x04, 0x03, 0x01, 0x01, 0x04, 0x18, 0x04, 0x01,
+  0x06, 0x1A, 0x09, 0x1C, 0x09, 0x1A, 0x03, 0x01, 0x07, 0x18, 0x03, 0x03,
+  0x07, 0x17, 0x02, 0x04, 0x1F, 0x05, 0x1E, 0x06, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07,
+  0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x06, 0x16, 0x01, 0x07,
+  0x03, 0x19, 0x02, 0x22, 0x02, 0x23, 0x01, 0x06, 0x01, 0x1C, 0x02, 0x04,
+  0x03, 0x1B, 0x02, 0x03, 0x05, 0x1B, 0x01, 0x02, 0x03, 0x03, 0x1E, 0x05,
+  0x21, 0x02, 0x23, 0x01, 0x23, 0x01, 0x23, 0x03, 0x1E, 0x09, 0x19, 0x5C,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1E,
+  0x05, 0x20, 0x03, 0x22, 0x01, 0x6B, 0x01, 0x22, 0x03, 0x20, 0x05, 0x1E,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1D,
+  0x07, 0x1D, 0x07, 0x1D, 0x07, 0x1E, 0x06, 0x1E, 0x06, 0x1E, 0x06, 0x1F,
+  0x04, 0x20, 0x03, 0x21, 0x02, 0x11, 0x03, 0x04, 0x16, 0x04, 0x05, 0x06,
+  0x14, 0x06, 0x03, 0x07, 0x14, 0x07, 0x01, 0x09, 0x12, 0x09, 0x01, 0x08,
+  0x12, 0x09, 0x01, 0x09, 0x10, 0x09, 0x03, 0x08, 0x10, 0x09, 0x03, 0x09,
+  0x0E, 0x09, 0x05, 0x08, 0x0E, 0x09, 0x05, 0x08, 0x0D, 0x09, 0x06, 0x09,
+  0x0C, 0x09, 0x07, 0x08, 0x0C, 0x08, 0x08, 0x09, 0x0A, 0x09, 0x09, 0x08,
+  0x0A, 0x08, 0x0A, 0x09, 0x08, 0x09, 0x0B, 0x08, 0x08, 0x08, 0x0C, 0x09,
+  0x06, 0x09, 0x0D, 0x08, 0x06, 0x08, 0x0E, 0x09, 0x04, 0x09, 0x0F, 0x08,
+  0x04, 0x08, 0x10, 0x09, 0x02, 0x09, 0x11, 0x08, 0x02, 0x08, 0x12, 0x08,
+  0x02, 0x08, 0x13, 0x07, 0x02, 0x07, 0x14, 0x07, 0x02, 0x07, 0x15, 0x06,
+  0x02, 0x06, 0x16, 0x06, 0x02, 0x06, 0x17, 0x05, 0x02, 0x05, 0x18, 0x05,
+  0x02, 0x05, 0x19, 0x04, 0x02, 0x04, 0x62, 0x04, 0x02, 0x04, 0x19, 0x05,
+  0x02, 0x05, 0x18, 0x05, 0x02, 0x05, 0x17, 0x06, 0x02, 0x06, 0x16, 0x06,
+  0x02, 0x06, 0x15, 0x07, 0x02, 0x07, 0x14, 0x07, 0x02, 0x07, 0x13, 0x08,
+  0x02, 0x08, 0x12, 0x08, 0x02, 0x08, 0x11, 0x09, 0x02, 0x09, 0x10, 0x08,
+  0x04, 0x08, 0x0F, 0x09, 0x04, 0x09, 0x0E, 0x08, 0x06, 0x08, 0x0D, 0x09,
+  0x06, 0x09, 0x0C, 0x08, 0x08, 0x08, 0x0B, 0x09, 0x08, 0x09, 0x0A, 0x08,
+  0x0A, 0x08, 0x09, 0x09, 0x0A, 0x08, 0x09, 0x08, 0x0C, 0x08, 0x07, 0x09,
+  0x0C, 0x08, 0x07, 0x09, 0x0C, 0x09, 0x05, 0x09, 0x0E, 0x08, 0x05, 0x09,
+  0x0E, 0x09, 0x04, 0x08, 0x10, 0x08, 0x03, 0x09, 0x10, 0x09, 0x02, 0x08,
+  0x12, 0x08, 0x01, 0x09, 0x12, 0x09, 0x01, 0x07, 0x14, 0x07, 0x02, 0x07,
+  0x14, 0x07, 0x04, 0x04, 0x16, 0x04, 0x03 };
+
+const GFXglyph digital_7__mono_48pt7b_numGlyphs[] PROGMEM = {
+  {     0,   1,   1,  43,    0,    0 },   // 0x20 ' '
+  {     1,  43,  62,  44,    0,  -61 },   // 0x25 '%'
+  {   294,  29,   7,  43,    7,  -33 },   // 0x2D '-'
+  {   309,   7,   7,  43,   18,   -6 },   // 0x2E '.'
+  {   311,  36,  62,  42,    3,  -61 },   // 0x30 '0'
+  {   460,   7,  62,  42,   32,  -61 },   // 0x31 '1'
+  {   503,  36,  62,  42,    3,  -61 },   // 0x32 '2'
+  {   652,  36,  62,  42,    3,  -61 },   // 0x33 '3'
+  {   809,  36,  62,  42,    3,  -61 },   // 0x34 '4'
+  {   946,  36,  62,  42,    3,  -61 },   // 0x35 '5'
+  {  1093,  36,  62,  42,    3,  -61 },   // 0x36 '6'
+  {  1244,  36,  62,  42,    3,  -61 },   // 0x37 '7'
+  {  1379,  36,  62,  42,    3,  -61 },   // 0x38 '8'
+  {  1542,  36,  62,  42,    3,  -61 },   // 0x39 '9'
+  {  1701,  36,  62,  43,    3,  -61 },   // 0x54 'T'
+  {  1818,  36,  62,  43,    3,  -61 } };   // 0x58 'X'
+
+const uint8_t digital_7__mono_48pt7b_numRemap[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+  0x0C, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0xFF, 0xFF, 0xFF, 0x0F };
+
+const GFXsubfont digital_7__mono_48pt7b_num PROGMEM = { {
+  (uint8_t  *)digital_7__mono_48pt7b_numBitmaps,
+  (GFXglyph *)digital_7__mono_48pt7b_numGlyphs,
+  0x20, 0x58, 96 },
+  (uint8_t  *)digital_7__mono_48pt7b_numRemap, true };
+
+// Approx. 2240 bytes
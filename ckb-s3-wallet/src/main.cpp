@@ -11,13 +11,24 @@
  *   - Broadcast via send_transaction RPC or delegated to ckb-s3-node
  *
  * Screens:
- *   BOOT      — splash + WiFi connect
+ *   BOOT      — splash; WiFi joins in the background (ckb_wifi.h)
  *   HOME      — address (truncated), balance, Send / Receive buttons
  *   SEND      — address input (touch keyboard), amount input, confirm
  *   CONFIRM   — review tx details, swipe/hold to sign & broadcast
  *   RECEIVE   — display own address as QR (future) + text
  *   RESULT    — tx hash or error message
  *
+ *   Static chrome of each screen is cached in PSRAM (see PAGE CACHE);
+ *   navigation is one framebuffer copy plus the dynamic fields.
+ *
+ * Remote operation (build with -DCKB_RFB_PORT=5900): VNC server on core 0
+ * serving the panel framebuffer. View-only unless -DCKB_RFB_PASSWORD is
+ * set; then authenticated viewers' clicks arrive as touches (see RFB).
+ *
+ * Animated splash (env guition4848-splash): an MJPEG from LittleFS plays
+ * under the logo until the first balance query after WiFi joins, or
+ * SPLASH_TIMEOUT_MS (ckb_mjpeg.h).
+ *
  * Platform: PlatformIO + espressif32@6.5.0 (IDF 4.4.6)
  * Library:  CKB-ESP32 (SIGNER profile), Arduino_GFX 1.2.9 (local)
  */
@@ -27,12 +38,19 @@
 #include <HTTPClient.h>
 #include <Preferences.h>
 #include "ckb_config.h"
+#include "ckb_wifi.h"
 #include "gt911.h"
 #include <Arduino_GFX_Library.h>
-
-/* Fonts */
-#include "fonts/Digital7Mono48.h"
-#include "fonts/Digital7Mono28.h"
+#if defined(CKB_RFB_PORT)
+#include "ckb_rfb.h"
+#endif
+#if defined(CKB_SPLASH_MJPEG)
+#include <LittleFS.h>
+#include "ckb_mjpeg.h"
+#endif
+
+/* Fonts — Digital7Mono28Num is a " %-.0123456789TX" subset (tools/gfxfont_subset.py) */
+#include "fonts/Digital7Mono28Num.h"
 #include "fonts/Digital7Mono14.h"
 #include "fonts/JMHTypewriterBold18.h"
 #include "fonts/JMHTypewriterBold16.h"
@@ -40,7 +58,7 @@
 #include "fonts/JMHTypewriterBold12.h"
 #include "fonts/JMHTypewriter14.h"
 
-#define FONT_HERO    (&digital_7__mono_28pt7b)
+#define FONT_HERO    (&digital_7__mono_28pt7b_num)
 #define FONT_MED     (&digital_7__mono_14pt7b)
 #define FONT_LABEL   (&JMH_Typewriter_Bold16pt7b)
 #define FONT_SMALL   (&JMH_Typewriter_Bold12pt7b)
@@ -60,10 +78,14 @@
 
 /* ═══════════════════════════════════════════════════════════════════
  * COLOURS (RGB565)
- * ═══════════════════════════════════════════════════════════════════ */
-#define COL_BG          0x0841   /* #101020 near-black */
+ * ═══════════════════════════════════════════════════════════════════
+ * Background and accent come from config and can change at run time;
+ * apply_config() drops the cached pages and redraws. */
+static uint16_t col_bg     = 0x0841;  /* #101020 near-black */
+static uint16_t col_accent = 0xFD00;  /* #FF6800 CKB orange */
+#define COL_BG          col_bg
 #define COL_PANEL       0x10A3   /* #21264A dark card */
-#define COL_ACCENT      0xFD00   /* #FF6800 CKB orange */
+#define COL_ACCENT      col_accent
 #define COL_OK          0x2FC6   /* green */
 #define COL_WARN        0xFE60   /* amber */
 #define COL_ERR         0xF800   /* red */
@@ -131,18 +153,65 @@ static void fill_rect(int x, int y, int w, int h, uint16_t col) {
 }
 
 /* ─── Rounded button helper ─────────────────────────────────────── */
-static void draw_button(int x, int y, int w, int h,
+static void draw_button(Arduino_GFX *g, int x, int y, int w, int h,
                         uint16_t col, const char *label,
                         const GFXfont *font = nullptr) {
-    gfx->fillRoundRect(x, y, w, h, 10, col);
-    if (font) gfx->setFont(font);
-    gfx->setTextColor(COL_TEXT);
-    gfx->setTextSize(1);
+    g->fillRoundRect(x, y, w, h, 10, col);
+    if (font) g->setFont(font);
+    g->setTextColor(COL_TEXT);
+    g->setTextSize(1);
     int16_t tx, ty; uint16_t tw, th;
-    gfx->getTextBounds(label, 0, 0, &tx, &ty, &tw, &th);
-    gfx->setCursor(x + (w - tw)/2 - tx, y + (h + th)/2 - ty/2);
-    gfx->print(label);
-    gfx->setFont(nullptr);
+    g->getTextBounds(label, 0, 0, &tx, &ty, &tw, &th);
+    g->setCursor(x + (w - tw)/2 - tx, y + (h + th)/2 - ty/2);
+    g->print(label);
+    g->setFont(nullptr);
+}
+
+/* ═══════════════════════════════════════════════════════════════════
+ * PAGE CACHE
+ * Each screen is split into static chrome (chrome_*, drawn on any
+ * target) and dynamic fields (fields_*, drawn on the panel). The chrome
+ * is rendered once into a full-screen canvas in PSRAM; showing a screen
+ * copies that canvas into the panel framebuffer in one pass and then
+ * overlays the fields, instead of repainting top to bottom.
+ * Without PSRAM the chrome is drawn straight to the panel as before.
+ * ═══════════════════════════════════════════════════════════════════ */
+typedef void (*chrome_fn_t)(Arduino_GFX *g);
+
+static Arduino_Canvas *page_cache[SCREEN_RESULT + 1] = {};
+
+static void show_page(Screen s, chrome_fn_t chrome) {
+    Arduino_Canvas *page = page_cache[s];
+    if (!page) {
+        /* Only in PSRAM: without it Arduino_Canvas::begin() falls back to a
+         * split internal-RAM buffer that flushAll() would overrun */
+        if (!psramFound() || ESP.getMaxAllocPsram() < (size_t)W * H * 2) {
+            chrome(gfx);
+            return;
+        }
+        page = new Arduino_Canvas(W, H, gfx);
+        page->begin(GFX_SKIP_OUTPUT_BEGIN);
+        if (!page->getFramebuffer()) {
+            delete page;
+            chrome(gfx);
+            return;
+        }
+        chrome(page);
+        page_cache[s] = page;
+        Serial.printf("[page] screen %d cached, %u KB free PSRAM\n",
+            (int)s, (unsigned)(ESP.getFreePsram() / 1024));
+    }
+    page->flushAll();
+}
+
+/* Drop a cached page (or all, s < 0) so the next show re-renders its
+ * chrome — after a colour or node URL change */
+static void page_cache_invalidate(int s = -1) {
+    for (int i = 0; i <= SCREEN_RESULT; i++) {
+        if (s >= 0 && i != s) continue;
+        delete page_cache[i];
+        page_cache[i] = nullptr;
+    }
 }
 
 /* ═══════════════════════════════════════════════════════════════════
@@ -153,19 +222,41 @@ static void draw_button(int x, int y, int w, int h,
  *   [92  – 220] Balance (large 7-seg)
  *   [220 – 260] "CKB" label
  *   [260 – 360] [  SEND  ] [RECEIVE] buttons
- *   [360 – 480] Footer — node URL, last update
+ *   [360 – 480] Footer — node URL, device IP
  * ═══════════════════════════════════════════════════════════════════ */
-static void draw_home() {
-    gfx->fillScreen(COL_BG);
+static void chrome_home(Arduino_GFX *g) {
+    g->fillScreen(COL_BG);
 
     /* Header */
-    fill_rect(0, 0, W, 52, COL_ACCENT);
-    gfx->setFont(FONT_LABEL); gfx->setTextColor(COL_TEXT); gfx->setTextSize(1);
-    gfx->setCursor(16, 34); gfx->print("CKB WALLET");
+    g->fillRect(0, 0, W, 52, COL_ACCENT);
+    g->setFont(FONT_LABEL); g->setTextColor(COL_TEXT); g->setTextSize(1);
+    g->setCursor(16, 34); g->print("CKB WALLET");
+    g->setFont(nullptr);
+
+    /* "CKB" sub-label */
+    g->setFont(FONT_SMALL); g->setTextColor(COL_DIM); g->setTextSize(1);
+    g->setCursor(W/2 - 14, 250); g->print("CKB");
+    g->setFont(nullptr);
+
+    /* Buttons */
+    draw_button(g, 20,  278, 200, 64, COL_BTN_SEND, "SEND",    FONT_LABEL);
+    draw_button(g, 260, 278, 200, 64, COL_BTN_RECV, "RECEIVE", FONT_LABEL);
+
+    /* Footer */
+    g->fillRect(0, 360, W, 120, COL_PANEL);
+    g->drawFastHLine(0, 360, W, COL_DIVIDER);
+    g->setFont(FONT_SMALL); g->setTextColor(COL_DIM); g->setTextSize(1);
+    const char *rpc = (cfg.valid && cfg.node_url[0]) ? cfg.node_url : CKB_RPC;
+    g->setCursor(12, 388); g->print(rpc);
+    g->setFont(nullptr);
+}
+
+/* Dynamic HOME fields — each clears its own band, so a balance refresh
+ * can call this alone without re-showing the page */
+static void fields_home() {
     /* Status dot */
     uint16_t dot = wallet.balance_ok ? COL_OK : COL_WARN;
     gfx->fillCircle(W - 24, 26, 8, dot);
-    gfx->setFont(nullptr);
 
     /* Address (truncated: first 12 + … + last 6) */
     fill_rect(0, 52, W, 40, COL_PANEL);
@@ -193,32 +284,27 @@ static void draw_home() {
     gfx->print(bal_buf);
     gfx->setFont(nullptr);
 
-    /* "CKB" sub-label */
-    fill_rect(0, 220, W, 40, COL_BG);
+    /* Device IP — can change after a reconnect */
+    fill_rect(0, 396, W, 28, COL_PANEL);
     gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
-    gfx->setCursor(W/2 - 14, 250); gfx->print("CKB");
-    gfx->setFont(nullptr);
-
-    /* Buttons */
-    fill_rect(0, 260, W, 100, COL_BG);
-    draw_button(20,  278, 200, 64, COL_BTN_SEND, "SEND",    FONT_LABEL);
-    draw_button(260, 278, 200, 64, COL_BTN_RECV, "RECEIVE", FONT_LABEL);
-
-    /* Footer */
-    fill_rect(0, 360, W, 120, COL_PANEL);
-    gfx->drawFastHLine(0, 360, W, COL_DIVIDER);
-    gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
-    const char *rpc = (cfg.valid && cfg.node_url[0]) ? cfg.node_url : CKB_RPC;
-    gfx->setCursor(12, 388); gfx->print(rpc);
     gfx->setCursor(12, 416); gfx->print(WiFi.localIP().toString().c_str());
     gfx->setFont(nullptr);
 }
 
+static void draw_home() {
+    show_page(SCREEN_HOME, chrome_home);
+    fields_home();
+}
+
 /* ═══════════════════════════════════════════════════════════════════
  * SCREEN: RESULT
  * ═══════════════════════════════════════════════════════════════════ */
-static void draw_result() {
-    gfx->fillScreen(COL_BG);
+static void chrome_result(Arduino_GFX *g) {
+    g->fillScreen(COL_BG);
+    draw_button(g, 20, 380, 440, 64, COL_BTN_CANCEL, "BACK TO HOME", FONT_LABEL);
+}
+
+static void fields_result() {
     uint16_t hcol = wallet.tx_ok ? COL_OK : COL_ERR;
     fill_rect(0, 0, W, 52, hcol);
     gfx->setFont(FONT_LABEL); gfx->setTextColor(COL_TEXT); gfx->setTextSize(1);
@@ -242,24 +328,39 @@ static void draw_result() {
         gfx->setCursor(12, 130); gfx->print(wallet.last_error);
     }
     gfx->setFont(nullptr);
+}
 
-    draw_button(20, 380, 440, 64, COL_BTN_CANCEL, "BACK TO HOME", FONT_LABEL);
+static void draw_result() {
+    show_page(SCREEN_RESULT, chrome_result);
+    fields_result();
 }
 
 /* ═══════════════════════════════════════════════════════════════════
  * SCREEN: RECEIVE
  * ═══════════════════════════════════════════════════════════════════ */
-static void draw_receive() {
-    gfx->fillScreen(COL_BG);
-    fill_rect(0, 0, W, 52, COL_BTN_RECV);
-    gfx->setFont(FONT_LABEL); gfx->setTextColor(COL_TEXT); gfx->setTextSize(1);
-    gfx->setCursor(16, 34); gfx->print("RECEIVE CKB");
-    gfx->setFont(nullptr);
+static void chrome_receive(Arduino_GFX *g) {
+    g->fillScreen(COL_BG);
+    g->fillRect(0, 0, W, 52, COL_BTN_RECV);
+    g->setFont(FONT_LABEL); g->setTextColor(COL_TEXT); g->setTextSize(1);
+    g->setCursor(16, 34); g->print("RECEIVE CKB");
+    g->setFont(nullptr);
+
+    g->setFont(FONT_SMALL); g->setTextColor(COL_TEXT); g->setTextSize(1);
+    g->setCursor(12, 90); g->print("Your address:");
+    g->setFont(nullptr);
+
+    /* QR placeholder */
+    g->fillRect(140, 260, 200, 200, COL_PANEL);
+    g->setFont(FONT_SMALL); g->setTextColor(COL_DIM); g->setTextSize(1);
+    g->setCursor(158, 368); g->print("QR coming soon");
+    g->setFont(nullptr);
+
+    draw_button(g, 20, 420, 440, 52, COL_BTN_CANCEL, "BACK", FONT_LABEL);
+}
 
+static void fields_receive() {
     /* Address in chunks */
-    gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_TEXT); gfx->setTextSize(1);
-    gfx->setCursor(12, 90); gfx->print("Your address:");
-    gfx->setTextColor(COL_ACCENT);
+    gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_ACCENT); gfx->setTextSize(1);
     /* Print address in 3 lines of ~30 chars */
     int alen = strlen(wallet.address);
     char chunk[32];
@@ -268,32 +369,24 @@ static void draw_receive() {
         gfx->setCursor(12, 118 + line * 28); gfx->print(chunk);
     }
     gfx->setFont(nullptr);
+}
 
-    /* QR placeholder */
-    fill_rect(140, 260, 200, 200, COL_PANEL);
-    gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
-    gfx->setCursor(158, 368); gfx->print("QR coming soon");
-    gfx->setFont(nullptr);
-
-    draw_button(20, 420, 440, 52, COL_BTN_CANCEL, "BACK", FONT_LABEL);
+static void draw_receive() {
+    show_page(SCREEN_RECEIVE, chrome_receive);
+    fields_receive();
 }
 
 /* ═══════════════════════════════════════════════════════════════════
  * WIFI + BALANCE
  * ═══════════════════════════════════════════════════════════════════ */
-static void connect_wifi() {
-    const char *ssid = (cfg.valid && cfg.wifi_ssid[0]) ? cfg.wifi_ssid : WIFI_SSID;
-    const char *pass = (cfg.valid && cfg.wifi_pass[0]) ? cfg.wifi_pass : WIFI_PASS;
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, pass);
-    uint32_t t0 = millis();
-    while (WiFi.status() != WL_CONNECTED && millis() - t0 < 20000) delay(300);
-}
+static uint32_t last_balance_ms = 0;
+static bool     balance_queried = false;  /* a query has run since boot */
+#define BALANCE_INTERVAL_MS  30000   /* refresh balance every 30s */
 
 /* TODO: replace with CKB-ESP32 getBalance() once library linked in */
 static void refresh_balance() {
     /* Placeholder — calls get_cells_capacity via indexer */
-    if (WiFi.status() != WL_CONNECTED || !wallet.key_loaded) return;
+    if (!ckb_wifi_up() || !wallet.key_loaded) return;
     HTTPClient http;
     const char *url = (cfg.valid && cfg.node_url[0]) ? cfg.node_url : CKB_RPC;
     http.begin(url);
@@ -306,6 +399,7 @@ static void refresh_balance() {
         "\"hash_type\":\"type\",\"args\":\"%s\"},\"script_type\":\"lock\"}],"
         "\"id\":1}", "0x4454b23e1523b8f9e88a00c4c521179f444351f4"); /* TODO: derive from key */
     int code = http.POST(body);
+    balance_queried = true;
     if (code == 200) {
         String resp = http.getString();
         /* parse "capacity":"0x..." */
@@ -346,7 +440,14 @@ static void load_key() {
  * TOUCH (GT911 via gt911.h)
  * SDA=19, SCL=45, INT=40, RST=41 — Guition 4848S040 standard
  * ═══════════════════════════════════════════════════════════════════ */
+#if defined(CKB_RFB_PORT)
+static bool rfb_tap(int *tx, int *ty);
+#endif
+
 static bool touch_get(int *tx, int *ty) {
+#if defined(CKB_RFB_PORT)
+    if (rfb_tap(tx, ty)) return true;
+#endif
     if (touch.read() && touch.pressed) {
         *tx = touch.x;
         *ty = touch.y;
@@ -355,6 +456,115 @@ static bool touch_get(int *tx, int *ty) {
     return false;
 }
 
+#if defined(CKB_RFB_PORT)
+/* ═══════════════════════════════════════════════════════════════════
+ * RFB — VNC server for remote operation (ckb_rfb.h)
+ * One viewer at a time. Without CKB_RFB_PASSWORD the viewer can only
+ * watch; with it, VNC authentication is required and a failed attempt
+ * blocks the port for CKB_RFB_AUTH_BACKOFF_MS.
+ * Runs on core 0; a button-1 press is queued and picked up by
+ * touch_get() on the loop task like a GT911 tap.
+ * ═══════════════════════════════════════════════════════════════════ */
+#ifndef CKB_RFB_AUTH_BACKOFF_MS
+#define CKB_RFB_AUTH_BACKOFF_MS 3000
+#endif
+
+struct rfb_point_t { uint16_t x, y; };
+
+static WiFiServer     rfb_server(CKB_RFB_PORT);
+static ckb_rfb_t      rfb;
+static QueueHandle_t  rfb_taps = nullptr;
+
+static bool rfb_tap(int *tx, int *ty) {
+    rfb_point_t p;
+    if (!rfb_taps || xQueueReceive(rfb_taps, &p, 0) != pdTRUE) return false;
+    *tx = p.x;
+    *ty = p.y;
+    return true;
+}
+
+static void rfb_pointer(uint8_t buttons, uint16_t x, uint16_t y) {
+    static uint8_t last = 0;
+    if ((buttons & 1) && !(last & 1)) {
+        rfb_point_t p = { x, y };
+        xQueueSend(rfb_taps, &p, 0);                 /* drop if the UI is behind */
+    }
+    last = buttons;
+}
+
+static bool rfb_read(void *ctx, uint8_t *buf, size_t n) {
+    WiFiClient *c = (WiFiClient *)ctx;
+    uint32_t t0 = millis();
+    while (n) {
+        int k = c->read(buf, n);
+        if (k > 0) { buf += k; n -= k; t0 = millis(); continue; }
+        if (!c->connected() || millis() - t0 > 5000) return false;
+        vTaskDelay(1);
+    }
+    return true;
+}
+
+static bool rfb_write(void *ctx, const uint8_t *buf, size_t n) {
+    WiFiClient *c = (WiFiClient *)ctx;
+    while (n) {
+        size_t k = c->write(buf, n);
+        if (!k) return false;
+        buf += k;
+        n -= k;
+    }
+    return true;
+}
+
+static int rfb_available(void *ctx) {
+    WiFiClient *c = (WiFiClient *)ctx;
+    return c->connected() ? c->available() : -1;
+}
+
+static void rfb_yield(void *) {
+    vTaskDelay(1);
+}
+
+static void rfb_task(void *) {
+    for (;;) {
+        WiFiClient client = rfb_server.available();
+        if (!client) { vTaskDelay(pdMS_TO_TICKS(200)); continue; }
+        client.setNoDelay(true);
+        ckb_rfb_io_t io = { rfb_read, rfb_write, rfb_available, rfb_yield, &client };
+        uint32_t failures = rfb.auth_failures;
+        if (ckb_rfb_handshake(rfb, io)) {
+            Serial.printf("[rfb] viewer %s connected%s\n", client.remoteIP().toString().c_str(),
+                rfb.input ? "" : " (view-only)");
+            while (ckb_rfb_poll(rfb, millis())) vTaskDelay(pdMS_TO_TICKS(10));
+            Serial.printf("[rfb] viewer gone: %lu updates, %lu rects, %lu KB\n",
+                (unsigned long)rfb.updates, (unsigned long)rfb.rects,
+                (unsigned long)(rfb.bytes / 1024));
+        }
+        bool failed = rfb.auth_failures != failures;
+        if (failed)
+            Serial.printf("[rfb] auth failed from %s (%lu total)\n",
+                client.remoteIP().toString().c_str(), (unsigned long)rfb.auth_failures);
+        client.stop();
+        if (failed) vTaskDelay(pdMS_TO_TICKS(CKB_RFB_AUTH_BACKOFF_MS));
+    }
+}
+
+static void start_rfb() {
+    if (!ckb_rfb_init(rfb, gfx->getFramebuffer(), W, H, "CKB Wallet")) {
+        Serial.println("[rfb] no framebuffer — VNC disabled");
+        return;
+    }
+    rfb.on_pointer = rfb_pointer;
+#if defined(CKB_RFB_PASSWORD)
+    rfb.password = CKB_RFB_PASSWORD;
+#endif
+    rfb_taps = xQueueCreate(4, sizeof(rfb_point_t));
+    rfb_server.begin();
+    xTaskCreatePinnedToCore(rfb_task, "rfb", 6144, nullptr, 1, nullptr, 0);
+    Serial.printf("[rfb] VNC on :%d, %s\n", CKB_RFB_PORT,
+        rfb.password ? "password required for input" : "view-only");
+}
+#endif
+
 /* ═══════════════════════════════════════════════════════════════════
  * TOUCH ROUTING
  * ═══════════════════════════════════════════════════════════════════ */
@@ -385,6 +595,90 @@ static void handle_touch(int tx, int ty) {
     }
 }
 
+/* ═══════════════════════════════════════════════════════════════════
+ * LIVE CONFIG
+ * ═══════════════════════════════════════════════════════════════════
+ * Serial config sessions land here through ckb_config.h, on the loop
+ * task: nothing restarts, and only what changed is touched. */
+static void apply_colours() {
+    col_accent = cfg.valid ? cfg.accent_col : 0xFD00;
+    col_bg     = cfg.valid ? cfg.bg_col     : 0x0841;
+}
+
+static void redraw_screen() {
+    switch (current_screen) {
+        case SCREEN_HOME:    draw_home();    break;
+        case SCREEN_RECEIVE: draw_receive(); break;
+        case SCREEN_RESULT:  draw_result();  break;
+        default:             break;
+    }
+}
+
+static void apply_config() {
+    uint8_t ch = ckb_config_changes(cfg);
+    if (!ch) return;
+    Serial.printf("[cfg] applying live:%s%s%s\n",
+        ch & CKB_CFG_CH_WIFI ? " wifi" : "", ch & CKB_CFG_CH_URL ? " node_url" : "",
+        ch & CKB_CFG_CH_COLOUR ? " colours" : "");
+
+    if (ch & CKB_CFG_CH_WIFI)
+        ckb_wifi_set((cfg.valid && cfg.wifi_ssid[0]) ? cfg.wifi_ssid : WIFI_SSID,
+                     (cfg.valid && cfg.wifi_pass[0]) ? cfg.wifi_pass : WIFI_PASS);
+    if (ch & CKB_CFG_CH_COLOUR) {
+        apply_colours();
+        page_cache_invalidate();
+    } else if (ch & CKB_CFG_CH_URL) {
+        page_cache_invalidate(SCREEN_HOME);   /* footer shows the node URL */
+    }
+    if (ch & CKB_CFG_CH_URL) {
+        /* Another node may mean another chain: don't show the old balance */
+        wallet.balance_ok = false;
+        refresh_balance();
+        last_balance_ms = millis();
+    }
+    if (current_screen != SCREEN_BOOT) redraw_screen();
+}
+
+#if defined(CKB_SPLASH_MJPEG)
+/* ═══════════════════════════════════════════════════════════════════
+ * SPLASH ANIMATION — pipelined MJPEG below the logo (ckb_mjpeg.h)
+ * Runs on its own tasks, so the blocking boot steps keep it moving.
+ * ═══════════════════════════════════════════════════════════════════ */
+#define SPLASH_Y    280
+#define SPLASH_FPS  15
+#define SPLASH_TIMEOUT_MS  15000     /* home page even without WiFi or a reply */
+
+static void start_splash() {
+    if (!LittleFS.begin()) {
+        Serial.println("[splash] LittleFS mount failed");
+        return;
+    }
+    File f = LittleFS.open(CKB_SPLASH_MJPEG, "r");
+    if (!f || f.isDirectory()) {
+        Serial.println("[splash] " CKB_SPLASH_MJPEG " not found");
+        return;
+    }
+    ckb_mjpeg_play(gfx, f, 0, SPLASH_Y, W, H - SPLASH_Y, SPLASH_FPS, true);
+}
+
+/* Called from loop() while on the boot screen: the splash gives way to
+ * the home page once the first balance query has run (or there is no
+ * key to query for and WiFi is up), on timeout, or if it never started. */
+static void poll_splash() {
+    const char *why = !ckb_mjpeg_playing()                      ? "not playing"
+                    : balance_queried                            ? "balance"
+                    : !wallet.key_loaded && ckb_wifi_up()        ? "wifi"
+                    : millis() > SPLASH_TIMEOUT_MS               ? "timeout"
+                    : nullptr;
+    if (!why) return;
+    ckb_mjpeg_stop();
+    ckb_mjpeg_report();
+    Serial.printf("[splash] done at %lu ms (%s)\n", (unsigned long)millis(), why);
+    current_screen = SCREEN_HOME;
+    draw_home();
+}
+#endif
+
 /* ═══════════════════════════════════════════════════════════════════
  * SETUP / LOOP
  * ═══════════════════════════════════════════════════════════════════ */
@@ -393,14 +687,20 @@ void setup() {
     delay(500);
     Serial.println("[boot] CKB S3 Wallet");
 
-    ckb_config_check(3000);
+    ckb_config_start();
     cfg = ckb_config_load();
+    apply_colours();
+    /* Radio first: it joins in the background while the panel comes up */
+    ckb_wifi_begin((cfg.valid && cfg.wifi_ssid[0]) ? cfg.wifi_ssid : WIFI_SSID,
+                   (cfg.valid && cfg.wifi_pass[0]) ? cfg.wifi_pass : WIFI_PASS);
 
     init_display();
     pinMode(BL_PIN, OUTPUT);
     digitalWrite(BL_PIN, LOW);
     gfx->begin();
     gfx->fillScreen(0x0000);
+    static const int16_t radii[] = { 8, 10 };   /* status dot, buttons */
+    gfx->prewarmRadii(radii, sizeof(radii) / sizeof(radii[0]));
     digitalWrite(BL_PIN, HIGH);
 
     /* Splash */
@@ -409,9 +709,11 @@ void setup() {
     gfx->setFont(FONT_SMALL); gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
     gfx->setCursor(160, 260); gfx->print("starting...");
     gfx->setFont(nullptr);
+#if defined(CKB_SPLASH_MJPEG)
+    start_splash();
+#endif
 
     load_key();
-    connect_wifi();
 
     /* Touch — scan I2C first to verify pins, then init GT911 */
     GT911::scanI2C();
@@ -421,22 +723,34 @@ void setup() {
         Serial.println("[boot] GT911 touch ready");
     }
 
-    refresh_balance();
+#if defined(CKB_RFB_PORT)
+    start_rfb();
+#endif
 
+#if defined(CKB_SPLASH_MJPEG)
+    /* Stay on the splash; loop() leaves it after the first balance */
+#else
+    refresh_balance();
     current_screen = SCREEN_HOME;
     draw_home();
+#endif
 }
 
-static uint32_t last_balance_ms = 0;
-#define BALANCE_INTERVAL_MS  30000   /* refresh balance every 30s */
-
 void loop() {
-    /* Balance refresh */
-    if (millis() - last_balance_ms > BALANCE_INTERVAL_MS) {
+    apply_config();
+
+    /* Balance refresh: on schedule, and as soon as the link comes (back) up */
+    static uint32_t last_connects = 0;
+    uint32_t connects = _ckb_wifi.info.connects;
+    if (connects != last_connects || millis() - last_balance_ms > BALANCE_INTERVAL_MS) {
+        last_connects = connects;
         refresh_balance();
         last_balance_ms = millis();
-        if (current_screen == SCREEN_HOME) draw_home();
+        if (current_screen == SCREEN_HOME) fields_home();  /* page already on screen */
     }
+#if defined(CKB_SPLASH_MJPEG)
+    if (current_screen == SCREEN_BOOT) poll_splash();
+#endif
 
     /* Touch */
     int tx, ty;
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""
+eaglesong_tables.py — constant tables for the node's PoW check
+==============================================================
+Pulls the three Eaglesong constant arrays out of the reference C
+implementation (eaglesong.c from the Eaglesong / CKB sources) and writes
+them as the header ckb-s3-node/src/ckb_pow.h looks for. Arrays are picked
+by length, so the reference's own names don't matter:
+
+  256 bits   bit matrix, row-major → ckb_es_bitmatrix (output j takes
+                                     input k when [k * 16 + j] is 1)
+   48 ints   rotation coefficients → ckb_es_coeff
+  688 words  injection constants   → ckb_es_inject (43 rounds × 16)
+
+Before writing anything the tables are checked:
+
+  - the injection constants must equal their published derivation, the
+    first 2752 bytes of SHAKE-256 over the Hayek quote in INJECTION_SEED
+    read as little-endian words, so a garbled or truncated copy of the
+    reference is caught;
+  - the bit matrix must be 0/1 and invertible over GF(2), or the
+    permutation would not be one;
+  - every coefficient triple must start with 0 and stay below 32.
+
+  - the whole permutation and sponge, run here with the candidate tables,
+    must give the published digest of "Hello, world!\n" from the
+    Eaglesong reference README. That is the only check on the bit matrix
+    and coefficients short of real headers.
+
+Then run tools/pow_host.cpp, which checks the C sponge against a 48-byte
+answer from this script, and on the mainnet header fixture when there
+is one.
+
+Usage:
+  tools/eaglesong_tables.py path/to/eaglesong.c \\
+      ckb-s3-node/src/ckb_eaglesong_tables.h
+
+Rebuild the node afterwards; the boot log then reports "pow: eaglesong".
+"""
+
+import hashlib
+import re
+import sys
+
+ARRAY = re.compile(r'(\w+)\s*\[\s*\d*\s*\]\s*=\s*\{([^}]*)\}', re.S)
+WANT = {256: ('uint8_t', 'ckb_es_bitmatrix'),
+        48: ('uint8_t', 'ckb_es_coeff'),
+        688: ('uint32_t', 'ckb_es_inject')}
+
+INJECTION_SEED = (
+    'The various ways in which the knowledge on which people base their plan '
+    'is communicated to them is the crucial problem for any theory explaining '
+    'the economic process, and the problem of what is the best way to '
+    'utilizing knowledge initially dispersed among all the people is at least '
+    'one of the main problems of economic policy - or of designing an '
+    'efficient economic system.')
+
+
+# Published answer of the reference: echo "Hello, world!" | ./hash
+KNOWN_INPUT = b'Hello, world!\n'
+KNOWN_DIGEST = '64867e2441d162615dc2430b6bcb4d3f4b95e4d0db529fca1eece73c077d72d6'
+
+
+def arrays(src):
+    src = re.sub(r'/\*.*?\*/|//[^\n]*', '', src, flags=re.S)
+    for name, body in ARRAY.findall(src):
+        vals = [int(v, 0) for v in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body)]
+        yield name, vals
+
+
+def injection_constants(n):
+    d = hashlib.shake_256(INJECTION_SEED.encode()).digest(4 * n)
+    return [int.from_bytes(d[4 * i:4 * i + 4], 'little') for i in range(n)]
+
+
+def invertible(bits):
+    rows = [sum(bits[k * 16 + j] << j for j in range(16)) for k in range(16)]
+    for col in range(16):
+        pivot = next((r for r in range(col, 16) if rows[r] >> col & 1), None)
+        if pivot is None:
+            return False
+        rows[col], rows[pivot] = rows[pivot], rows[col]
+        for r in range(16):
+            if r != col and rows[r] >> col & 1:
+                rows[r] ^= rows[col]
+    return True
+
+
+def rotl(x, n):
+    return (x << n | x >> (32 - n)) & 0xffffffff if n else x
+
+
+def permute(state, bits, coeff, inject):
+    for r in range(43):
+        s = [0] * 16
+        for j in range(16):
+            for k in range(16):
+                if bits[k * 16 + j]:
+                    s[j] ^= state[k]
+        s = [rotl(v, coeff[3 * i]) ^ rotl(v, coeff[3 * i + 1]) ^ rotl(v, coeff[3 * i + 2])
+             ^ inject[r * 16 + i] for i, v in enumerate(s)]
+        for i in range(0, 16, 2):
+            s[i] = rotl((s[i] + s[i + 1]) & 0xffffffff, 8)
+            s[i + 1] = (rotl(s[i + 1], 24) + s[i]) & 0xffffffff
+        state = s
+    return state
+
+
+def eaglesong(msg, bits, coeff, inject):
+    """Reference sponge, rate 256, delimiter 0x06, 32-byte digest. Words
+    absorb big-endian; shifting stops at the delimiter, so it lands in the
+    low byte of its word."""
+    state = [0] * 16
+    for i in range(((len(msg) + 1) * 8 + 255) // 256):
+        for j in range(8):
+            word = 0
+            for k in range(4):
+                pos = i * 32 + j * 4 + k
+                if pos < len(msg):
+                    word = word << 8 | msg[pos]
+                elif pos == len(msg):
+                    word = word << 8 | 0x06
+            state[j] ^= word
+        state = permute(state, bits, coeff, inject)
+    return b''.join(v.to_bytes(4, 'little') for v in state[:8]).hex()
+
+
+def check(found):
+    bits, coeff, inject = found[256][1], found[48][1], found[688][1]
+    if inject != injection_constants(688):
+        return 'injection constants differ from SHAKE-256 of the seed'
+    if any(b not in (0, 1) for b in bits):
+        return 'bit matrix is not 0/1'
+    if not invertible(bits):
+        return 'bit matrix is singular'
+    if any(c > 31 for c in coeff) or any(coeff[3 * j] for j in range(16)):
+        return 'coefficients out of range, or a triple not starting with 0'
+    if eaglesong(KNOWN_INPUT, bits, coeff, inject) != KNOWN_DIGEST:
+        return 'eaglesong("Hello, world!\\n") differs from the published digest'
+    return None
+
+
+def main(argv):
+    if len(argv) != 3:
+        print(__doc__)
+        return 1
+    found = {}
+    for name, vals in arrays(open(argv[1]).read()):
+        if len(vals) in WANT and len(vals) not in found:
+            found[len(vals)] = (name, vals)
+    missing = [WANT[n][1] for n in WANT if n not in found]
+    if missing:
+        print('no array for: ' + ', '.join(missing), file=sys.stderr)
+        return 1
+    err = check(found)
+    if err:
+        print(err, file=sys.stderr)
+        return 1
+
+    out = ['/* Eaglesong constants, generated by tools/eaglesong_tables.py',
+           ' * from %s — do not edit */' % argv[1], '', '#pragma once', '']
+    for n, (ctype, cname) in WANT.items():
+        name, vals = found[n]
+        per = 8 if ctype == 'uint32_t' else 16
+        fmt = '0x%08x' if ctype == 'uint32_t' else '%2d'
+        out.append('/* %s */' % name)
+        out.append('static const %s %s[%d] = {' % (ctype, cname, n))
+        for i in range(0, n, per):
+            out.append('    ' + ', '.join(fmt % v for v in vals[i:i + per]) + ',')
+        out.append('};')
+        out.append('')
+    with open(argv[2], 'w') as f:
+        f.write('\n'.join(out))
+    print('%s: bit matrix, %d coefficients, %d injection constants (checked)'
+          % (argv[2], len(found[48][1]), len(found[688][1])))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,82 @@
+/*
+ * failover_host.cpp — drive the node's RPC router (ckb_failover.h) on a host
+ * ==========================================================================
+ * Sends get_tip_header through ckb_fo_call() at a fixed interval, like the
+ * dashboard's poll loop, and prints which endpoint answered and how long
+ * the call took. Every 20 calls, and at the end, it prints each
+ * endpoint's health: latency EWMA / p95, error rate, breaker, and
+ * wins / hedges / trips. Point it at tools/mock_rpc.py to inject faults.
+ *
+ *   g++ -O2 -std=gnu++17 -Ickb-s3-node/src tools/failover_host.cpp -o failover_host
+ *   tools/mock_rpc.py 19001:delay=30,tail=0.1,tail_ms=800 19002:delay=60 \
+ *                     19003:delay=20,down=15-45 &
+ *   ./failover_host "a=http://127.0.0.1:19001 b=http://127.0.0.1:19002 c=http://127.0.0.1:19003" 300 200
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ckb_failover.h"
+
+static void table(const ckb_fo_snapshot_t &s) {
+    printf("  %-10s %-9s %6s %6s %5s %6s %6s %6s %6s %5s\n",
+        "endpoint", "breaker", "ewma", "p95", "err%", "calls", "errors", "wins", "hedges", "trips");
+    for (uint8_t i = 0; i < s.count; i++) {
+        const ckb_fo_info_t &e = s.ep[i];
+        printf("%c %-10s %-9s %6lu %6lu %5.1f %6lu %6lu %6lu %6lu %5lu\n",
+            i == s.primary ? '*' : ' ', e.name, ckb_fo_breaker_name(e.breaker),
+            (unsigned long)e.ewma_ms, (unsigned long)e.p95_ms, e.err_pm / 10.0,
+            (unsigned long)e.calls, (unsigned long)e.errors, (unsigned long)e.wins,
+            (unsigned long)e.hedges, (unsigned long)e.trips);
+    }
+    printf("  calls %lu, failed %lu, hedges %lu (won %lu), primary switches %lu\n",
+        (unsigned long)s.calls, (unsigned long)s.failed, (unsigned long)s.hedges,
+        (unsigned long)s.hedge_wins, (unsigned long)s.switches);
+}
+
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s \"name=http://host:port ...\" [calls] [interval_ms]\n", argv[0]);
+        return 2;
+    }
+    int calls = argc > 2 ? atoi(argv[2]) : 100;
+    int interval = argc > 3 ? atoi(argv[3]) : 500;
+    if (!ckb_fo_begin() || !ckb_fo_add_list(argv[1])) {
+        fprintf(stderr, "no usable endpoints\n");
+        return 2;
+    }
+
+    static const char body[] =
+        "{\"jsonrpc\":\"2.0\",\"method\":\"get_tip_header\",\"params\":[],\"id\":1}";
+    uint32_t *took = (uint32_t *)malloc(sizeof(uint32_t) * calls);
+    ckb_fo_snapshot_t s;
+    for (int c = 0; c < calls; c++) {
+        uint32_t t0 = ckb_fo_millis();
+        uint32_t len = 0;
+        const char *json = ckb_fo_call(body, &len);
+        took[c] = ckb_fo_millis() - t0;
+        ckb_fo_copy(&s);
+        const char *num = json ? strstr(json, "\"number\":\"") : nullptr;
+        printf("#%-4d %5lu ms  %-10s %.*s\n", c, (unsigned long)took[c],
+            s.last >= 0 ? s.ep[s.last].name : "FAILED", num ? 22 : 0, num ? num + 10 : "");
+        if (c % 20 == 19) table(s);
+        if (took[c] < (uint32_t)interval) {
+            struct timespec ts = { 0, (long)(interval - took[c]) * 1000000L };
+            nanosleep(&ts, nullptr);
+        }
+    }
+
+    qsort(took, calls, sizeof(uint32_t), cmp_u32);
+    printf("\ncall latency: p50 %lu ms, p95 %lu ms, p99 %lu ms, max %lu ms\n",
+        (unsigned long)took[calls / 2], (unsigned long)took[calls * 95 / 100],
+        (unsigned long)took[calls * 99 / 100], (unsigned long)took[calls - 1]);
+    table(s);
+    free(took);
+    return s.failed ? 1 : 0;
+}
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+fontpack.py — build the font pack flashed into the "fonts" partition
+====================================================================
+Packs GFXfont headers into one little-endian image that ckb_fonts.h maps
+with esp_partition_mmap (or mmap() on host) and serves by name.
+
+Usage:
+  tools/fontpack.py fonts.bin                 # default pack (see DEFAULT_PACK)
+  tools/fontpack.py fonts.bin NAME=PATH[+rle][+chars=...] ...
+
+Flash (offset from partitions_fonts.csv):
+  esptool.py --chip esp32s3 write_flash 0x610000 fonts.bin
+
+Layout:
+  header  16 B   "CKBFPK1\\0", u16 count, u16 reserved, u32 total size
+  entries 32 B   char name[16], u32 glyphs, u32 bitmap, u32 remap (0 = none),
+                 u8 first, u8 last, u8 yAdvance, u8 flags (bit0 = RLE)
+  data           GFXglyph tables (8 B each, as laid out in RAM), bitmaps,
+                 remap tables — offsets are from the start of the image
+"""
+
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gfxfont_rle import parse_font, glyph_pixels, encode  # noqa: E402
+from gfxfont_subset import pack_bits  # noqa: E402
+
+FONTS = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'ckb-s3-node', 'src', 'fonts')
+NUMERIC = ' %-.0123456789TX'
+DEFAULT_PACK = [
+    ('jmh_bold18', 'JMHTypewriterBold18.h', False, None),
+    ('jmh_bold16', 'JMHTypewriterBold16.h', False, None),
+    ('jmh_bold14', 'JMHTypewriterBold14.h', False, None),
+    ('jmh_bold12', 'JMHTypewriterBold12.h', False, None),
+    ('jmh_14',     'JMHTypewriter14.h',     False, None),
+    ('d7m72_num',  'Digital7Mono72.h',      True,  NUMERIC),
+    ('d7m48_num',  'Digital7Mono48.h',      True,  NUMERIC),
+    ('d7m28_num',  'Digital7Mono28.h',      False, NUMERIC),
+    ('d7m14',      'Digital7Mono14.h',      False, None),
+]
+
+MAGIC = b'CKBFPK1\0'
+NAME_LEN = 16
+
+
+def build_font(path, rle, chars):
+    _, bitmap, glyphs, first, last, y_adv = parse_font(open(path).read())
+    codes = sorted(set(ord(c) for c in chars)) if chars else list(range(first, last + 1))
+    sub_first, sub_last = codes[0], codes[-1]
+    data, table, remap = [], [], []
+    for c in range(sub_first, sub_last + 1):
+        if c not in codes or not (first <= c <= last):
+            remap.append(0xFF)
+            continue
+        offset, w, h, x_adv, x_off, y_off, _ = glyphs[c - first]
+        px = glyph_pixels(bitmap, offset, w, h)
+        remap.append(len(table))
+        table.append(struct.pack('<HBBBbbx', len(data), w, h, x_adv, x_off, y_off))
+        data += encode(px) if rle else pack_bits(px)
+    if len(data) > 0xFFFF:
+        sys.exit('%s: bitmap exceeds 16-bit bitmapOffset' % path)
+    return {
+        'glyphs': b''.join(table),
+        'bitmap': bytes(data),
+        'remap': bytes(remap) if chars else b'',
+        'first': sub_first, 'last': sub_last, 'y_adv': y_adv,
+        'flags': 1 if rle else 0,
+    }
+
+
+def align4(buf):
+    buf += b'\0' * (-len(buf) % 4)
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    out = sys.argv[1]
+    specs = []
+    if len(sys.argv) == 2:
+        specs = [(n, os.path.join(FONTS, f), r, c) for (n, f, r, c) in DEFAULT_PACK]
+    for arg in sys.argv[2:]:
+        name, rest = arg.split('=', 1)
+        chars = None
+        if '+chars=' in rest:
+            rest, chars = rest.split('+chars=', 1)
+        rle = rest.endswith('+rle')
+        if rle:
+            rest = rest[:-4]
+        specs.append((name, rest, rle, chars))
+
+    fonts = []
+    for (name, path, rle, chars) in specs:
+        if len(name) >= NAME_LEN:
+            sys.exit('font name too long: %s' % name)
+        fonts.append((name, build_font(path, rle, chars)))
+
+    body = bytearray()
+    base = 16 + 32 * len(fonts)
+    entries = []
+    for (name, f) in fonts:
+        align4(body)
+        g = base + len(body)
+        body += f['glyphs']
+        b = base + len(body)
+        body += f['bitmap']
+        r = 0
+        if f['remap']:
+            r = base + len(body)
+            body += f['remap']
+        entries.append(struct.pack('<16sIIIBBBB', name.encode(), g, b, r,
+                                   f['first'], f['last'], f['y_adv'], f['flags']))
+    align4(body)
+    total = base + len(body)
+    image = MAGIC + struct.pack('<HHI', len(fonts), 0, total) + b''.join(entries) + bytes(body)
+    open(out, 'wb').write(image)
+    for (name, f) in fonts:
+        print('%-12s %6d bytes' % (name, len(f['glyphs']) + len(f['bitmap']) + len(f['remap'])))
+    print('total        %6d bytes -> %s' % (total, out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+gfxfont_rle.py — run-length encode a whole Adafruit/Arduino_GFX font
+====================================================================
+Reads a fontconvert-style header (NAMEBitmaps[], NAMEGlyphs[], NAME) and
+writes a GFXsubfont with every glyph, no remap table and rle set, for
+Arduino_GFX::setFont(const GFXsubfont *). Each glyph box is walked
+row-major and stored as alternating background/foreground run lengths,
+background first. Runs longer than 255 are split as 255, 0, remainder.
+gfxfont_subset.py and fontpack.py use the same encoder.
+
+Usage:
+  tools/gfxfont_rle.py ckb-s3-node/src/fonts/Digital7Mono48.h \
+                       ckb-s3-node/src/fonts/Digital7Mono48Rle.h
+
+The output symbol is NAME with the "pt7b" suffix turned into "pt7b_rle",
+e.g. digital_7__mono_48pt7b -> digital_7__mono_48pt7b_rle.
+"""
+
+import re
+import sys
+
+
+def parse_font(text):
+    bm = re.search(r'const\s+uint8_t\s+(\w+)Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S)
+    gl = re.search(r'const\s+GFXglyph\s+(\w+)Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)(?=const\s+GFXfont)', text, re.S)
+    ft = re.search(r'const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{(.*?)\};', text, re.S)
+    if not (bm and gl and ft):
+        sys.exit("not a GFXfont header")
+    name = ft.group(1)
+    bitmap = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', bm.group(2))]
+    glyphs = []
+    for m in re.finditer(r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}([^\n]*)', gl.group(2)):
+        comment = m.group(7).split('//', 1)[1].strip() if '//' in m.group(7) else ''
+        glyphs.append([int(m.group(i)) for i in range(1, 7)] + [comment])
+    first, last, y_adv = re.findall(r'(0x[0-9A-Fa-f]+|\d+)\s*(?:,|$)', ft.group(2).split(')', 2)[-1].strip().lstrip(','))[-3:]
+    return name, bitmap, glyphs, int(first, 0), int(last, 0), int(y_adv, 0)
+
+
+def glyph_pixels(bitmap, offset, w, h):
+    px = []
+    for i in range(w * h):
+        px.append((bitmap[offset + (i >> 3)] >> (7 - (i & 7))) & 1)
+    return px
+
+
+def encode(px):
+    runs = []
+    fg = 0
+    i = 0
+    while i < len(px):
+        n = 0
+        while i < len(px) and px[i] == fg:
+            n += 1
+            i += 1
+        while n > 255:
+            runs += [255, 0]
+            n -= 255
+        runs.append(n)
+        fg ^= 1
+    if not runs:
+        runs.append(0)
+    return runs
+
+
+def decode(runs, total):
+    px = []
+    fg = 0
+    for n in runs:
+        if len(px) >= total:
+            break
+        px += [fg] * n
+        fg ^= 1
+    return px
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    text = open(sys.argv[1]).read()
+    name, bitmap, glyphs, first, last, y_adv = parse_font(text)
+    out_name = name + '_rle'
+
+    runs = []
+    out_glyphs = []
+    for (offset, w, h, x_adv, x_off, y_off, comment) in glyphs:
+        px = glyph_pixels(bitmap, offset, w, h)
+        r = encode(px)
+        if decode(r, w * h) != px:
+            sys.exit("round trip failed for %s" % comment)
+        out_glyphs.append((len(runs), w, h, x_adv, x_off, y_off, comment))
+        runs += r
+    if len(runs) > 0xFFFF:
+        sys.exit("run stream exceeds 16-bit bitmapOffset")
+
+    o = []
+    o.append('// Run-length encoded from %s by tools/gfxfont_rle.py' % sys.argv[1].split('/')[-1])
+    o.append('// %d bitmap bytes -> %d run bytes' % (len(bitmap), len(runs)))
+    o.append('const uint8_t %sRuns[] PROGMEM = {' % out_name)
+    for i in range(0, len(runs), 12):
+        line = ', '.join('0x%02X' % v for v in runs[i:i + 12])
+        o.append('  ' + line + (',' if i + 12 < len(runs) else ' };'))
+    o.append('')
+    o.append('const GFXglyph %sGlyphs[] PROGMEM = {' % out_name)
+    for i, (offset, w, h, x_adv, x_off, y_off, comment) in enumerate(out_glyphs):
+        end = ' },' if i + 1 < len(out_glyphs) else ' } };'
+        o.append('  { %5d, %3d, %3d, %3d, %4d, %4d%s   // %s' % (offset, w, h, x_adv, x_off, y_off, end, comment))
+    o.append('')
+    o.append('const GFXsubfont %s PROGMEM = { {' % out_name)
+    o.append('  (uint8_t  *)%sRuns,' % out_name)
+    o.append('  (GFXglyph *)%sGlyphs,' % out_name)
+    o.append('  0x%02X, 0x%02X, %d },' % (first, last, y_adv))
+    o.append('  NULL, true };')
+    o.append('')
+    o.append('// Approx. %d bytes' % (len(runs) + len(out_glyphs) * 7 + 12))
+    open(sys.argv[2], 'w').write('\n'.join(o) + '\n')
+    print('%s: %d -> %d bytes' % (out_name, len(bitmap), len(runs)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+gfxfont_subset.py — cut a GFXfont header down to a declared character set
+=========================================================================
+Writes a GFXsubfont: a dense glyph table holding only the requested
+characters plus a remap table indexed by (c - first), so drawChar()
+lookups stay O(1). With --rle the bitmaps are also run-length encoded
+(see gfxfont_rle.py).
+
+Usage:
+  tools/gfxfont_subset.py [--rle] --chars " %-.0123456789" \
+      ckb-s3-node/src/fonts/Digital7Mono28.h \
+      ckb-s3-node/src/fonts/Digital7Mono28Num.h NAME
+
+NAME is the C symbol of the generated GFXsubfont.
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gfxfont_rle import parse_font, glyph_pixels, encode  # noqa: E402
+
+
+def pack_bits(px):
+    out = []
+    for i in range(0, len(px), 8):
+        b = 0
+        for j, p in enumerate(px[i:i + 8]):
+            b |= p << (7 - j)
+        out.append(b)
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('--chars', required=True)
+    ap.add_argument('--rle', action='store_true')
+    ap.add_argument('src')
+    ap.add_argument('dst')
+    ap.add_argument('name')
+    a = ap.parse_args()
+
+    _, bitmap, glyphs, first, last, y_adv = parse_font(open(a.src).read())
+    chars = sorted(set(ord(c) for c in a.chars))
+    missing = [chr(c) for c in chars if not (first <= c <= last)]
+    if missing:
+        sys.exit("characters not in font: %r" % ''.join(missing))
+    sub_first, sub_last = chars[0], chars[-1]
+
+    data = []
+    out_glyphs = []
+    remap = []
+    for c in range(sub_first, sub_last + 1):
+        if c not in chars:
+            remap.append(0xFF)
+            continue
+        offset, w, h, x_adv, x_off, y_off, comment = glyphs[c - first]
+        px = glyph_pixels(bitmap, offset, w, h)
+        remap.append(len(out_glyphs))
+        out_glyphs.append((len(data), w, h, x_adv, x_off, y_off, comment))
+        data += encode(px) if a.rle else pack_bits(px)
+    if len(data) > 0xFFFF:
+        sys.exit("bitmap exceeds 16-bit bitmapOffset")
+
+    name = a.name
+    o = []
+    o.append('// Subset of %s by tools/gfxfont_subset.py%s' % (os.path.basename(a.src), ' --rle' if a.rle else ''))
+    o.append('// chars: "%s"' % ''.join(chr(c) for c in chars).replace('\\', '\\\\'))
+    o.append('const uint8_t %sBitmaps[] PROGMEM = {' % name)
+    for i in range(0, len(data), 12):
+        line = ', '.join('0x%02X' % v for v in data[i:i + 12])
+        o.append('  ' + line + (',' if i + 12 < len(data) else ' };'))
+    o.append('')
+    o.append('const GFXglyph %sGlyphs[] PROGMEM = {' % name)
+    for i, (offset, w, h, x_adv, x_off, y_off, comment) in enumerate(out_glyphs):
+        end = ' },' if i + 1 < len(out_glyphs) else ' } };'
+        o.append('  { %5d, %3d, %3d, %3d, %4d, %4d%s   // %s' % (offset, w, h, x_adv, x_off, y_off, end, comment))
+    o.append('')
+    o.append('const uint8_t %sRemap[] PROGMEM = {' % name)
+    for i in range(0, len(remap), 12):
+        line = ', '.join('0x%02X' % v for v in remap[i:i + 12])
+        o.append('  ' + line + (',' if i + 12 < len(remap) else ' };'))
+    o.append('')
+    o.append('const GFXsubfont %s PROGMEM = { {' % name)
+    o.append('  (uint8_t  *)%sBitmaps,' % name)
+    o.append('  (GFXglyph *)%sGlyphs,' % name)
+    o.append('  0x%02X, 0x%02X, %d },' % (sub_first, sub_last, y_adv))
+    o.append('  (uint8_t  *)%sRemap, %s };' % (name, 'true' if a.rle else 'false'))
+    o.append('')
+    total = len(data) + len(out_glyphs) * 7 + len(remap) + 12
+    o.append('// Approx. %d bytes' % total)
+    open(a.dst, 'w').write('\n'.join(o) + '\n')
+    print('%s: %d glyphs, %d bytes' % (name, len(out_glyphs), total))
+
+
+if __name__ == '__main__':
+    main()
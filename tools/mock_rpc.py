@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+mock_rpc.py — fake CKB JSON-RPC endpoints with injected delays and faults
+=========================================================================
+Serves a chain that grows one block every --block seconds on each port
+given, answering get_tip_header, get_header_by_number, local_node_info,
+get_peers, get_raw_tx_pool and sync_state (single or batch). Each port
+takes its own fault spec, so failover and hedging can be exercised on a
+host (tools/failover_host.cpp) or against a device on the LAN.
+
+Usage:
+  tools/mock_rpc.py 19001:delay=30 19002:delay=60,jitter=40 \\
+                    19003:delay=20,tail=0.1,tail_ms=900,err=0.05 \\
+                    19004:down=10-40
+
+Spec keys (comma separated, all optional):
+  delay=MS      fixed latency before the reply
+  jitter=MS     plus uniform 0..MS
+  tail=P        probability of a slow reply, tail_ms=MS extra (default 1000)
+  err=P         probability of HTTP 500
+  drop=P        probability of closing the connection without a reply
+  hang=P        probability of never replying (client must time out)
+  down=A-B      seconds after start during which every request is dropped
+  slow=A-B      seconds after start during which every reply takes
+                slow_ms=MS longer (default 1000)
+
+Ctrl-C prints per-port counters.
+"""
+
+import argparse
+import asyncio
+import json
+import random
+import sys
+import time
+
+START = time.time()
+
+
+class Endpoint:
+    def __init__(self, port, spec):
+        self.port = port
+        self.delay = self.jitter = self.tail = self.err = self.drop = self.hang = 0.0
+        self.tail_ms = self.slow_ms = 1000.0
+        self.down = self.slow = None
+        self.stats = dict(requests=0, ok=0, err=0, drop=0, hang=0, down=0, slow=0)
+        for kv in filter(None, spec.split(',')):
+            k, _, v = kv.partition('=')
+            if k in ('down', 'slow'):
+                a, _, b = v.partition('-')
+                setattr(self, k, (float(a), float(b)))
+            elif hasattr(self, k):
+                setattr(self, k, float(v))
+            else:
+                raise SystemExit('unknown spec key: %s' % k)
+
+
+def header(number, block_s):
+    h = '%064x' % (number * 0x9E3779B97F4A7C15 & (2**256 - 1))
+    p = '%064x' % ((number - 1) * 0x9E3779B97F4A7C15 & (2**256 - 1))
+    return {
+        'compact_target': '0x1a08a97e', 'dao': '0x' + '0' * 64,
+        'epoch': hex(1800 << 40 | (number % 1800) << 24 | number // 1800),
+        'extra_hash': '0x' + '0' * 64, 'hash': '0x' + h, 'nonce': '0x0',
+        'number': hex(number), 'parent_hash': '0x' + p,
+        'proposals_hash': '0x' + '0' * 64,
+        'timestamp': hex(int((START + (number - TIP0) * block_s) * 1000)),
+        'transactions_root': '0x' + '0' * 64, 'version': '0x0',
+    }
+
+
+TIP0 = 10_000_000
+
+
+def answer(req, block_s, port):
+    tip = TIP0 + int((time.time() - START) / block_s)
+    m, rid = req.get('method'), req.get('id')
+    if m == 'get_tip_header':
+        res = header(tip, block_s)
+    elif m == 'get_header_by_number':
+        n = int(req['params'][0], 16)
+        res = header(n, block_s) if n <= tip else None
+    elif m == 'local_node_info':
+        res = {'node_id': 'QmMockNode%05d' % port, 'connections': '0x8',
+               'version': '0.0.0-mock', 'active': True, 'addresses': [], 'protocols': []}
+    elif m == 'get_peers':
+        res = [{'node_id': 'QmPeer%d' % i, 'addresses': []} for i in range(8)]
+    elif m == 'get_raw_tx_pool':
+        res = {'pending': ['0x%064x' % i for i in range(12)], 'proposed': []}
+    elif m == 'sync_state':
+        res = {'best_known_block_number': hex(tip)}
+    else:
+        return {'jsonrpc': '2.0', 'error': {'code': -32601, 'message': 'Method not found'}, 'id': rid}
+    return {'jsonrpc': '2.0', 'result': res, 'id': rid}
+
+
+async def handle(ep, block_s, r, w):
+    try:
+        data = b''
+        while b'\r\n\r\n' not in data:
+            chunk = await r.read(4096)
+            if not chunk:
+                return
+            data += chunk
+        head, body = data.split(b'\r\n\r\n', 1)
+        length = 0
+        for line in head.split(b'\r\n')[1:]:
+            k, _, v = line.partition(b':')
+            if k.strip().lower() == b'content-length':
+                length = int(v)
+        while len(body) < length:
+            chunk = await r.read(4096)
+            if not chunk:
+                return
+            body += chunk
+        ep.stats['requests'] += 1
+
+        t = time.time() - START
+        if ep.down and ep.down[0] <= t < ep.down[1]:
+            ep.stats['down'] += 1
+            return
+        roll = random.random()
+        if roll < ep.drop:
+            ep.stats['drop'] += 1
+            return
+        if roll < ep.drop + ep.hang:
+            ep.stats['hang'] += 1
+            await asyncio.sleep(3600)
+            return
+        ms = ep.delay + random.random() * ep.jitter
+        if random.random() < ep.tail:
+            ep.stats['slow'] += 1
+            ms += ep.tail_ms
+        if ep.slow and ep.slow[0] <= t < ep.slow[1]:
+            ms += ep.slow_ms
+        await asyncio.sleep(ms / 1000)
+        if random.random() < ep.err:
+            ep.stats['err'] += 1
+            w.write(b'HTTP/1.1 500 Internal Server Error\r\nContent-Length: 0\r\n\r\n')
+            return
+
+        req = json.loads(body)
+        if isinstance(req, list):
+            out = [answer(q, block_s, ep.port) for q in req]
+        else:
+            out = answer(req, block_s, ep.port)
+        js = json.dumps(out, separators=(',', ':')).encode()   # compact, like ckb
+        w.write(b'HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n'
+                b'Content-Length: %d\r\n\r\n' % len(js) + js)
+        await w.drain()
+        ep.stats['ok'] += 1
+    except (ConnectionError, asyncio.CancelledError):
+        pass
+    finally:
+        w.close()
+
+
+async def serve(eps, block_s):
+    for ep in eps:
+        await asyncio.start_server(lambda r, w, ep=ep: handle(ep, block_s, r, w), '0.0.0.0', ep.port)
+        print('[mock] :%d %s' % (ep.port, {k: v for k, v in vars(ep).items()
+                                           if k not in ('port', 'stats') and v}))
+    await asyncio.Event().wait()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    ap.add_argument('ports', nargs='+', help='PORT[:spec]')
+    ap.add_argument('--block', type=float, default=8.0, help='seconds per block')
+    ap.add_argument('--seed', type=int, help='random seed, for repeatable runs')
+    a = ap.parse_args()
+    if a.seed is not None:
+        random.seed(a.seed)
+    eps = []
+    for arg in a.ports:
+        port, _, spec = arg.partition(':')
+        eps.append(Endpoint(int(port), spec))
+    try:
+        asyncio.run(serve(eps, a.block))
+    except KeyboardInterrupt:
+        for ep in eps:
+            print('[mock] :%d %s' % (ep.port, ep.stats))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+pow_fixture.py — mainnet header fixture for tools/pow_host.cpp
+==============================================================
+Fetches headers spread over the whole mainnet chain from a node and
+writes them as one batch get_header_by_number reply, the format
+pow_host reads. The node must be on mainnet (genesis hash checked), so
+every header in the file has to pass both the hash and the PoW check;
+a failure means the verifier or the Eaglesong tables are wrong.
+
+The last reply is the tip again with one nonce bit flipped and its hash
+recomputed, tagged "expect":"bad_pow": only the PoW check can reject
+it, so a verifier that passes everything fails the fixture.
+
+Usage:
+  tools/pow_fixture.py http://<mainnet-node>:8114 tools/pow_mainnet.json [count]
+  ./pow_host tools/pow_mainnet.json
+
+Heights: block 1, the current tip and count - 2 evenly spaced in between
+(default count 32), so the file spans every difficulty era so far.
+"""
+
+import hashlib
+import json
+import sys
+import urllib.request
+
+MAINNET_GENESIS = '0x92b197aa1fba0f63633922c61c92375c9c074a93e85963554f5499fe1450d0e5'
+
+
+def rpc(url, calls):
+    body = json.dumps([{'jsonrpc': '2.0', 'method': m, 'params': p, 'id': i}
+                       for i, (m, p) in enumerate(calls)]).encode()
+    req = urllib.request.Request(url, body, {'content-type': 'application/json'})
+    with urllib.request.urlopen(req, timeout=30) as r:
+        replies = sorted(json.load(r), key=lambda x: x['id'])
+    for x in replies:
+        if 'error' in x:
+            raise RuntimeError(x['error'])
+    return replies
+
+
+def header_hash(h):
+    """blake2b-256("ckb-default-hash") of the molecule Header"""
+    le = lambda k, n: int(h[k], 16).to_bytes(n, 'little')
+    raw = (le('version', 4) + le('compact_target', 4) + le('timestamp', 8) +
+           le('number', 8) + le('epoch', 8) +
+           b''.join(bytes.fromhex(h[k][2:]) for k in
+                    ('parent_hash', 'transactions_root', 'proposals_hash', 'extra_hash', 'dao')) +
+           le('nonce', 16))
+    return '0x' + hashlib.blake2b(raw, digest_size=32, person=b'ckb-default-hash').hexdigest()
+
+
+def flipped(reply):
+    """reply with nonce bit 0 flipped and the hash redone to match"""
+    h = dict(reply['result'])
+    if header_hash(h) != h['hash']:
+        raise RuntimeError('header #%d: hash does not match its fields' % int(h['number'], 16))
+    h['nonce'] = hex(int(h['nonce'], 16) ^ 1)
+    h['hash'] = header_hash(h)
+    return {'jsonrpc': '2.0', 'result': h, 'id': reply['id'] + 1, 'expect': 'bad_pow'}
+
+
+def main(argv):
+    if len(argv) not in (3, 4):
+        print(__doc__)
+        return 1
+    url, out = argv[1], argv[2]
+    count = int(argv[3]) if len(argv) == 4 else 32
+    genesis, tip = rpc(url, [('get_block_hash', ['0x0']), ('get_tip_block_number', [])])
+    if genesis['result'] != MAINNET_GENESIS:
+        print('%s is not a mainnet node' % url, file=sys.stderr)
+        return 1
+    top = int(tip['result'], 16)
+    heights = sorted({1 + (top - 1) * i // (count - 1) for i in range(count)})
+    replies = rpc(url, [('get_header_by_number', [hex(h)]) for h in heights])
+    replies.append(flipped(replies[-1]))
+    with open(out, 'w') as f:
+        json.dump(replies, f, separators=(',', ':'))
+        f.write('\n')
+    print('%s: %d mainnet headers, #1 .. #%d, + 1 flipped nonce' % (out, len(heights), top))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,121 @@
+/*
+ * pow_host.cpp — run the node's header verifier (ckb_pow.h) on a host
+ * ===================================================================
+ * Reads get_tip_header / get_header_by_number replies (single or batch)
+ * and checks every header in them: the blake2b header hash always, and
+ * Eaglesong PoW against compact_target (ckb_eaglesong_tables.h). Every
+ * mainnet header must pass. A failure means the
+ * verifier or the tables are wrong, not the chain.
+ *
+ * The fixture is a batch reply of headers spread over mainnet, written
+ * by tools/pow_fixture.py. A reply tagged "expect":"bad_pow" (or
+ * "bad_hash") after its result must fail that way instead; the fixture
+ * ends with a flipped-nonce copy of the tip. Exits non-zero on any
+ * mismatch. Build with -DCKB_POW_TESTNET=1 for testnet headers.
+ *
+ *   g++ -O2 -std=gnu++17 -Ickb-s3-node/src tools/pow_host.cpp -o pow_host
+ *   tools/pow_fixture.py http://<mainnet-node>:8114 tools/pow_mainnet.json
+ *   ./pow_host tools/pow_mainnet.json   # or pipe a reply into ./pow_host -
+ *   ./pow_host --bench                  # header checks and Eaglesong alone
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+#include "ckb_pow.h"
+
+/* The result a reply's "expect" tag asks for, CKB_POW_OK when untagged.
+ * The tag follows "result":{...} inside the same reply object. */
+static uint8_t expected(const char *after, const char *end) {
+    const char *close = (const char *)memchr(after, '}', end - after);
+    const char *tag = strstr(after, "\"expect\":\"");
+    if (!close || !tag || tag > close) return CKB_POW_OK;
+    tag += 10;
+    return !strncmp(tag, "bad_pow\"", 8)  ? CKB_POW_BAD_POW
+         : !strncmp(tag, "bad_hash\"", 9) ? CKB_POW_BAD_HASH : CKB_POW_OK;
+}
+
+static const char *result_name(uint8_t r) {
+    switch (r) {
+    case CKB_POW_OK:         return "ok (hash + pow)";
+    case CKB_POW_HASH_OK:    return "ok (hash)";
+    case CKB_POW_BAD_HASH:   return "BAD HASH";
+    case CKB_POW_BAD_TARGET: return "BAD TARGET";
+    default:                 return "BAD POW";
+    }
+}
+
+/* blake2b-256 with the CKB personalisation of the empty string, and the
+ * Eaglesong sponge on one 48-byte PoW message */
+static bool self_test() {
+    static const uint8_t empty[32] = {
+        0x44, 0xf4, 0xc6, 0x97, 0x44, 0xd5, 0xf8, 0xc5, 0x5d, 0x64, 0x20, 0x62, 0x94, 0x9d, 0xca, 0xe4,
+        0x9b, 0xc4, 0xe7, 0xef, 0x43, 0xd3, 0x88, 0xc5, 0xa1, 0x2f, 0x42, 0xb5, 0x63, 0x3d, 0x16, 0x3e,
+    };
+    uint8_t out[32];
+    ckb_blake2b_256(nullptr, 0, out);
+    if (memcmp(out, empty, 32)) return false;
+#if CKB_POW_EAGLESONG
+    /* eaglesong of bytes i * 53 + 5, as computed by tools/eaglesong_tables.py
+     * (whose sponge matches the reference's published answer) */
+    static const uint8_t es48[32] = {
+        0xa4, 0x64, 0x42, 0x63, 0x3a, 0xa7, 0xee, 0xb0, 0xbe, 0xc2, 0xb2, 0x2e, 0x16, 0x0b, 0x0a, 0x71,
+        0x6c, 0x8e, 0xd6, 0xd3, 0x0b, 0x78, 0x3a, 0xa5, 0xab, 0x95, 0x6a, 0x0e, 0x37, 0x91, 0x5b, 0x66,
+    };
+    uint8_t msg[48];
+    for (int i = 0; i < 48; i++) msg[i] = (uint8_t)(i * 53 + 5);
+    ckb_es_init();
+    ckb_eaglesong48(msg, out);
+    if (memcmp(out, es48, 32)) return false;
+#endif
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (!self_test()) {
+        printf("[pow] self-test FAILED\n");
+        return 1;
+    }
+    ckb_pow_begin();
+    printf("[pow] %s, %u headers/s, %u eaglesong/s\n",
+        !CKB_POW_EAGLESONG ? "hash only (no eaglesong tables)"
+        : CKB_POW_TESTNET ? "eaglesong + blake2b (testnet)" : "eaglesong (mainnet)",
+        _ckb_pow.bench_hps, _ckb_pow.bench_es_hps);
+    if (argc < 2 || !strcmp(argv[1], "--bench")) return 0;
+
+    FILE *f = strcmp(argv[1], "-") ? fopen(argv[1], "rb") : stdin;
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    std::string json;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) json.append(buf, n);
+    if (f != stdin) fclose(f);
+
+    const char *p = json.c_str(), *end = p + json.size();
+    int total = 0, bad = 0, wrong = 0;
+    for (p = strstr(p, "\"result\":{"); p; p = strstr(p, "\"result\":{")) {
+        p += 10;
+        const char *close = (const char *)memchr(p, '}', end - p);
+        if (!close) break;
+        ckb_pow_header_t h;
+        if (ckb_pow_parse(p, close, h)) {
+            uint8_t r = ckb_pow_verify(h), want = expected(close + 1, end);
+            bool pass = r == CKB_POW_OK || r == CKB_POW_HASH_OK;
+            bool match = want == CKB_POW_OK ? pass : r == want;
+            printf("#%llu  %s%s%s\n", (unsigned long long)h.number, result_name(r),
+                !match ? "  <- WRONG, expected " : want != CKB_POW_OK ? "  (expected)" : "",
+                !match ? result_name(want) : "");
+            total++;
+            bad += !pass;
+            wrong += !match;
+        }
+        p = close;
+    }
+    printf("[pow] %d headers, %d failed, %d not as expected%s\n", total, bad, wrong,
+        CKB_POW_EAGLESONG ? "" : "; PoW not checked, generate the eaglesong tables");
+    return wrong || !total;
+}
@@ -0,0 +1,141 @@
+/*
+ * rfb_host.cpp — run the wallet's RFB server (ckb_rfb.h) on a host
+ * =================================================================
+ * Serves a 480×480 in-memory RGB565 framebuffer on :5900 so the server
+ * can be exercised with any stock VNC viewer. The frame shows colour
+ * bars, a sweeping block and a frame counter strip. With a password the
+ * viewer must pass VNC authentication, and clicking or dragging then
+ * paints into the frame, the way pointer events reach the wallet's touch
+ * handler on the device. Without one the server is view-only.
+ *
+ *   g++ -O2 -std=gnu++17 -Ickb-s3-wallet/src tools/rfb_host.cpp -o rfb_host
+ *   ./rfb_host [port] [password]
+ *   vncviewer localhost:5900
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ckb_rfb.h"
+
+#define W 480
+#define H 480
+
+static uint16_t fb[W * H];
+static ckb_rfb_t rfb;
+
+static uint32_t now_ms() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+/* ── In-memory framebuffer ─────────────────────────────────────── */
+static void fill(int x, int y, int w, int h, uint16_t c) {
+    for (int j = y; j < y + h && j < H; j++)
+        for (int i = x; i < x + w && i < W; i++)
+            if (i >= 0 && j >= 0) fb[j * W + i] = c;
+}
+
+static void frame(uint32_t n) {
+    static const uint16_t bars[] = { 0xFFFF, 0xFFE0, 0x07FF, 0x07E0, 0xF81F, 0xF800, 0x001F, 0x0000 };
+    fill(0, 0, W, 300, 0x0841);
+    for (int i = 0; i < 8; i++) fill(i * W / 8, 0, W / 8, 120, bars[i]);
+    fill((n * 4) % (W - 40), 160, 40, 40, 0xFD00);
+    for (int b = 0; b < 16; b++)                     /* binary frame counter */
+        fill(8 + b * 29, 240, 25, 20, (n >> (15 - b)) & 1 ? 0x2FC6 : 0x2965);
+}
+
+/* ── Socket transport ──────────────────────────────────────────── */
+static bool sock_read(void *ctx, uint8_t *buf, size_t n) {
+    int fd = *(int *)ctx;
+    while (n) {
+        struct pollfd p = { fd, POLLIN, 0 };
+        if (poll(&p, 1, 5000) <= 0) return false;
+        ssize_t k = recv(fd, buf, n, 0);
+        if (k <= 0) return false;
+        buf += k;
+        n -= k;
+    }
+    return true;
+}
+
+static bool sock_write(void *ctx, const uint8_t *buf, size_t n) {
+    int fd = *(int *)ctx;
+    while (n) {
+        ssize_t k = send(fd, buf, n, MSG_NOSIGNAL);
+        if (k <= 0) return false;
+        buf += k;
+        n -= k;
+    }
+    return true;
+}
+
+static int sock_available(void *ctx) {
+    int fd = *(int *)ctx;
+    struct pollfd p = { fd, POLLIN, 0 };
+    if (poll(&p, 1, 0) <= 0) return 0;
+    int n = 0;
+    ioctl(fd, FIONREAD, &n);
+    return n > 0 ? n : -1;                           /* readable with 0 bytes = closed */
+}
+
+static void on_pointer(uint8_t buttons, uint16_t x, uint16_t y) {
+    if (buttons & 1) fill(x - 3, y - 3, 7, 7, 0xFFFF);
+}
+
+int main(int argc, char **argv) {
+    int port = argc > 1 ? atoi(argv[1]) : 5900;
+    signal(SIGPIPE, SIG_IGN);
+
+    int ls = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(port);
+    a.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(ls, (struct sockaddr *)&a, sizeof(a)) != 0 || listen(ls, 1) != 0) {
+        perror("listen");
+        return 1;
+    }
+    printf("[rfb] listening on :%d\n", port);
+
+    ckb_rfb_init(rfb, fb, W, H, "CKB Wallet (host)");
+    rfb.on_pointer = on_pointer;
+    rfb.password = argc > 2 ? argv[2] : NULL;
+    uint32_t n = 0;
+    frame(n);
+
+    for (;;) {
+        int fd = accept(ls, NULL, NULL);
+        if (fd < 0) continue;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        ckb_rfb_io_t io = { sock_read, sock_write, sock_available, NULL, &fd };
+        if (ckb_rfb_handshake(rfb, io)) {
+            printf("[rfb] client connected%s\n", rfb.input ? "" : " (view-only)");
+            uint32_t last = now_ms();
+            while (ckb_rfb_poll(rfb, now_ms())) {
+                if (now_ms() - last >= 50) {         /* 20 fps animation */
+                    last = now_ms();
+                    frame(++n);
+                }
+                usleep(5000);
+            }
+            printf("[rfb] client gone: %u updates, %u rects, %u bytes\n",
+                rfb.updates, rfb.rects, rfb.bytes);
+        } else if (rfb.auth_failures) {
+            printf("[rfb] handshake failed (%u auth failures)\n", rfb.auth_failures);
+        }
+        close(fd);
+    }
+}
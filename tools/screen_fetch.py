@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+screen_fetch.py — mirror a node's display from GET /screen
+==========================================================
+Fetches a full framebuffer snapshot, then (with --watch) polls for the
+tiles that changed since the last sequence number and patches them in.
+Every frame is written as a PNG.
+
+Usage:
+  tools/screen_fetch.py 192.168.1.50 screen.png
+  tools/screen_fetch.py 192.168.1.50 screen.png --watch 1.0
+
+Stream format is documented in ckb-s3-node/src/ckb_screen.h.
+"""
+
+import struct
+import sys
+import time
+import urllib.request
+import zlib
+
+HDR = struct.Struct('<4sBBBBHHIIH2x')
+
+
+class Mirror:
+    def __init__(self):
+        self.w = self.h = 0
+        self.px = []
+        self.session = 0
+        self.seq = 0
+
+    def apply(self, data):
+        magic, ver, tile, flags, _, w, h, session, seq, count = HDR.unpack_from(data, 0)
+        if magic != b'CKBS' or ver != 1:
+            raise ValueError('not a CKBS stream')
+        if flags & 1 or (w, h) != (self.w, self.h):
+            self.w, self.h = w, h
+            self.px = [0] * (w * h)
+        self.session, self.seq = session, seq
+        tiles_x = (w + tile - 1) // tile
+        off = HDR.size
+        for _ in range(count):
+            idx, length = struct.unpack_from('<HH', data, off)
+            off += 4
+            self._tile(idx % tiles_x * tile, idx // tiles_x * tile, tile,
+                       data[off:off + length])
+            off += length
+        return count
+
+    def _tile(self, x0, y0, tile, rle):
+        tw = min(tile, self.w - x0)
+        th = min(tile, self.h - y0)
+        out = []
+        i = 0
+        while i < len(rle):
+            h = rle[i]
+            i += 1
+            if h & 0x80:
+                (v,) = struct.unpack_from('<H', rle, i)
+                out.extend([v] * ((h & 0x7F) + 1))
+                i += 2
+            else:
+                n = h + 1
+                out.extend(struct.unpack_from('<%dH' % n, rle, i))
+                i += 2 * n
+        if len(out) != tw * th:
+            raise ValueError('tile at %d,%d decoded %d px, expected %d' % (x0, y0, len(out), tw * th))
+        for r in range(th):
+            base = (y0 + r) * self.w + x0
+            self.px[base:base + tw] = out[r * tw:(r + 1) * tw]
+
+    def png(self, path):
+        raw = bytearray()
+        for y in range(self.h):
+            raw.append(0)
+            for v in self.px[y * self.w:(y + 1) * self.w]:
+                r, g, b = (v >> 11) & 0x1F, (v >> 5) & 0x3F, v & 0x1F
+                raw += bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+
+        def chunk(tag, body):
+            return (struct.pack('>I', len(body)) + tag + body +
+                    struct.pack('>I', zlib.crc32(tag + body) & 0xFFFFFFFF))
+
+        with open(path, 'wb') as f:
+            f.write(b'\x89PNG\r\n\x1a\n')
+            f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', self.w, self.h, 8, 2, 0, 0, 0)))
+            f.write(chunk(b'IDAT', zlib.compress(bytes(raw), 6)))
+            f.write(chunk(b'IEND', b''))
+
+
+def fetch(host, mirror):
+    url = 'http://%s:8080/screen' % host
+    if mirror.seq:
+        url += '?session=%d&since=%d' % (mirror.session, mirror.seq)
+    with urllib.request.urlopen(url, timeout=10) as r:
+        data = r.read()
+    return mirror.apply(data), len(data)
+
+
+def main(argv):
+    if len(argv) < 3:
+        print(__doc__)
+        return 1
+    host, path = argv[1], argv[2]
+    interval = float(argv[4]) if len(argv) > 4 and argv[3] == '--watch' else None
+    m = Mirror()
+    while True:
+        tiles, size = fetch(host, m)
+        if tiles:
+            m.png(path)
+        print('seq %d: %d tiles, %d bytes' % (m.seq, tiles, size))
+        if interval is None:
+            return 0
+        time.sleep(interval)
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))